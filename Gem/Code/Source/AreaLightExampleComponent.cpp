@@ -103,14 +103,14 @@ namespace AtomSampleViewer
                 return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::MaterialAsset>() &&
                     assetInfo.m_assetId.m_subId == 0; // no materials generated from models.
 
-            });
+            }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::MaterialAsset>()));
         m_materialBrowser.Activate();
         m_materialBrowserSettings.m_labels.m_root = "Materials";
 
         m_modelBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
             {
                 return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::ModelAsset>();
-            });
+            }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::ModelAsset>()));
         m_modelBrowser.Activate();
         m_modelBrowserSettings.m_labels.m_root = "Models";
 
@@ -14,11 +14,13 @@
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 
+#include <Automation/ScriptableImGui.h>
 #include <Automation/ScriptRunnerBus.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/MaterialInstancePool.h>
 
 AZ_DECLARE_BUDGET(AtomSampleViewer);
 
@@ -47,12 +49,12 @@ namespace AtomSampleViewer
         m_materialBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::MaterialAsset>();
-        });
+        }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::MaterialAsset>()));
 
         m_modelBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::ModelAsset>();
-        });
+        }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::ModelAsset>()));
 
         const AZStd::vector<AZStd::string> defaultMaterialAllowlist =
         {
@@ -76,6 +78,7 @@ namespace AtomSampleViewer
     void AssetLoadTestComponent::Activate()
     {
         AZ::TickBus::Handler::BusConnect();
+        AssetLoadTestRequestBus::Handler::BusConnect();
 
         m_imguiSidebar.Activate();
         m_materialBrowser.Activate();
@@ -113,6 +116,7 @@ namespace AtomSampleViewer
         m_materialBrowser.Deactivate();
         m_modelBrowser.Deactivate();
 
+        AssetLoadTestRequestBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         m_imguiSidebar.Deactivate();
         Base::Deactivate();
@@ -123,17 +127,24 @@ namespace AtomSampleViewer
         m_modelInstanceData.reserve(instanceCount);
     }
 
-    void AssetLoadTestComponent::CreateLatticeInstance(const AZ::Transform& transform)
+    void AssetLoadTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
     {
-        m_modelInstanceData.emplace_back<ModelInstanceData>({});
-        ModelInstanceData& data = m_modelInstanceData.back();
-        data.m_modelAssetId = GetRandomModelId();
-        data.m_materialAssetId = GetRandomMaterialId();
-        data.m_transform = transform;
+        const size_t firstInstance = m_modelInstanceData.size();
+        m_modelInstanceData.resize(firstInstance + transforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            ModelInstanceData& data = m_modelInstanceData[firstInstance + i];
+            data.m_modelAssetId = GetRandomModelId();
+            data.m_materialAssetId = GetRandomMaterialId();
+            data.m_transform = transforms[i];
+        }
     }
 
     void AssetLoadTestComponent::FinalizeLatticeInstances()
     {
+        // Instances that weren't swapped yet keep their old assets until the next switch reaches them
+        m_swapScheduler.Cancel();
+
         AZStd::set<AZ::Data::AssetId> assetIds;
 
         for (ModelInstanceData& instanceData : m_modelInstanceData)
@@ -173,46 +184,120 @@ namespace AtomSampleViewer
 
     void AssetLoadTestComponent::OnAllAssetsReadyActivate()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
-        {
-            AZ::Data::Instance<AZ::RPI::Material> materialInstance;
-            if (instanceData.m_materialAssetId.IsValid())
-            {
-                AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
-                materialAsset.Create(instanceData.m_materialAssetId, true);
-                materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
-
-                // cache the material when its loaded
-                m_cachedMaterials.insert(materialAsset);
-            }
+        // The instances are swapped to the loaded assets from OnTick, so the script waits until the switch is done
+        m_swapScheduler.SetStrategy(static_cast<AssetSwapScheduler::Strategy>(m_switchStrategy));
+        m_swapScheduler.SetFrameBudgetMs(m_switchBudgetMs);
+        m_swapScheduler.Begin(m_modelInstanceData.size());
 
-            if (instanceData.m_modelAssetId.IsValid())
-            {
-                AZ::Render::MeshHandleDescriptor descriptor;
-                descriptor.m_modelAsset.Create(instanceData.m_modelAssetId, true);
-                descriptor.m_customMaterials[AZ::Render::DefaultCustomMaterialId].m_material = materialInstance;
-                instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(descriptor);
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
-            }
+        if (m_swapScheduler.IsSwitching())
+        {
+            m_resumeScriptAfterSwitch = true;
+        }
+        else
+        {
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
         }
 
-        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
         AZ::TickBus::Handler::BusConnect();
     }
 
     void AssetLoadTestComponent::DestroyLatticeInstances()
     {
+        m_swapScheduler.Cancel();
+        if (m_resumeScriptAfterSwitch)
+        {
+            m_resumeScriptAfterSwitch = false;
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+        }
+
         DestroyHandles();
         m_modelInstanceData.clear();
     }
 
     void AssetLoadTestComponent::DestroyHandles()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
+        for (size_t instanceIndex = 0; instanceIndex < m_modelInstanceData.size(); ++instanceIndex)
+        {
+            ReleaseInstance(instanceIndex);
+        }
+    }
+
+    void AssetLoadTestComponent::SwapInstance(size_t instanceIndex)
+    {
+        ModelInstanceData& instanceData = m_modelInstanceData[instanceIndex];
+
+        // The new assets are acquired before the old ones are released, so a material or model that's used before and
+        // after the switch keeps its instance instead of being destroyed and created again
+        AZ::Render::MeshFeatureProcessorInterface::MeshHandle oldMeshHandle = AZStd::move(instanceData.m_meshHandle);
+        AZ::Data::Instance<AZ::RPI::Material> oldMaterial = AZStd::move(instanceData.m_material);
+        instanceData.m_meshHandle = {};
+        instanceData.m_material = nullptr;
+
+        if (instanceData.m_materialAssetId.IsValid())
+        {
+            AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
+            materialAsset.Create(instanceData.m_materialAssetId, true);
+            instanceData.m_material = MaterialInstancePool::GetInstance()->Acquire(materialAsset);
+
+            // cache the material when its loaded
+            m_cachedMaterials.insert(materialAsset);
+        }
+
+        if (instanceData.m_modelAssetId.IsValid())
         {
-            GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
-            instanceData.m_meshHandle = {};
+            AZ::Render::MeshHandleDescriptor descriptor;
+            descriptor.m_modelAsset.Create(instanceData.m_modelAssetId, true);
+            descriptor.m_customMaterials[AZ::Render::DefaultCustomMaterialId].m_material = instanceData.m_material;
+            instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(descriptor);
+            GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
         }
+
+        GetMeshFeatureProcessor()->ReleaseMesh(oldMeshHandle);
+        MaterialInstancePool::GetInstance()->Release(oldMaterial);
+    }
+
+    void AssetLoadTestComponent::ReleaseInstance(size_t instanceIndex)
+    {
+        ModelInstanceData& instanceData = m_modelInstanceData[instanceIndex];
+        GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
+        instanceData.m_meshHandle = {};
+        MaterialInstancePool::GetInstance()->Release(instanceData.m_material);
+        instanceData.m_material = nullptr;
+    }
+
+    bool AssetLoadTestComponent::WriteAssetSwitchStatistics(const AZStd::string& filePath)
+    {
+        return m_swapScheduler.WriteStatistics(filePath);
+    }
+
+    void AssetLoadTestComponent::DrawSwitchStrategyControls()
+    {
+        ImGui::Text("Asset Switch Strategy");
+        ScriptableImGui::RadioButton("All At Once", &m_switchStrategy, static_cast<int>(AssetSwapScheduler::Strategy::AllAtOnce));
+        ScriptableImGui::RadioButton("Amortized", &m_switchStrategy, static_cast<int>(AssetSwapScheduler::Strategy::Amortized));
+
+        ImGui::Text("Frame Budget (ms)");
+        ScriptableImGui::SliderFloat("##SwitchBudget", &m_switchBudgetMs, 0.1f, 16.0f, "%.1f");
+
+        if (ScriptableImGui::Button("Reset Switch Statistics"))
+        {
+            m_swapScheduler.ResetStatistics();
+        }
+
+        // A switch in progress finishes with the strategy it started with, changes apply from the next one
+        if (!m_swapScheduler.IsSwitching())
+        {
+            m_swapScheduler.SetStrategy(static_cast<AssetSwapScheduler::Strategy>(m_switchStrategy));
+        }
+        m_swapScheduler.SetFrameBudgetMs(m_switchBudgetMs);
+
+        if (m_swapScheduler.IsSwitching())
+        {
+            ImGui::Text("Switching: %zu instances left", m_swapScheduler.GetPendingCount());
+        }
+
+        ImGui::Spacing();
+        m_swapScheduler.DrawImGuiComparison();
     }
 
     AZ::Data::AssetId AssetLoadTestComponent::GetRandomModelId() const
@@ -250,6 +335,16 @@ namespace AtomSampleViewer
     {
         AZ_PROFILE_FUNCTION(AtomSampleViewer);
 
+        if (m_swapScheduler.IsSwitching())
+        {
+            const bool switchCompleted = m_swapScheduler.Update([this](size_t instanceIndex) { SwapInstance(instanceIndex); });
+            if (switchCompleted && m_resumeScriptAfterSwitch)
+            {
+                m_resumeScriptAfterSwitch = false;
+                ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+            }
+        }
+
         const float timeSeconds = static_cast<float>(scriptTime.GetSeconds());
 
         if (m_lastMaterialSwitchInSeconds == 0 || m_lastModelSwitchInSeconds == 0)
@@ -295,6 +390,12 @@ namespace AtomSampleViewer
             ImGui::Separator();
             ImGui::Spacing();
 
+            DrawSwitchStrategyControls();
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
             RenderImGuiLatticeControls();
 
             ImGui::Spacing();
@@ -363,7 +464,7 @@ namespace AtomSampleViewer
 
         if (materialSwitchRequested || materialsChanged || modelSwitchRequested || modelsChanged)
         {
-            DestroyHandles();
+            // The current meshes stay visible while the new assets load, they're swapped once the load is done
             FinalizeLatticeInstances();
         }
     }
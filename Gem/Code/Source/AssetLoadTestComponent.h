@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <AssetLoadTestBus.h>
 #include <EntityLatticeTestComponent.h>
+#include <Performance/AssetSwapScheduler.h>
 #include <Utils/ImGuiSidebar.h>
 #include <Utils/ImGuiAssetBrowser.h>
 #include <AzCore/Component/TickBus.h>
@@ -24,10 +26,14 @@ namespace AtomSampleViewer
         loaded on startup. This makes it easy to chose "working" assets to use in the test vs more development 
         assets that may not be working properly. It also allows you to build cases where we want
         to test instancing more than loading. UI to modify allow-list is a core part of this component.
+
+        Once the new assets are loaded, the entities are switched over either all in one frame or spread over
+        frames under a time budget, and the cost of each strategy is compared in the sidebar.
     */
     class AssetLoadTestComponent final
         : public EntityLatticeTestComponent
         , public AZ::TickBus::Handler
+        , public AssetLoadTestRequestBus::Handler
     {
         using Base = EntityLatticeTestComponent;
 
@@ -50,22 +56,32 @@ namespace AtomSampleViewer
 
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void FinalizeLatticeInstances() override;
         void DestroyLatticeInstances() override;
 
         void DestroyHandles();
 
+        // Acquires the mesh handle and material of the instance's current assets, then releases the ones it had before
+        void SwapInstance(size_t instanceIndex);
+        void ReleaseInstance(size_t instanceIndex);
+
         AZ::Data::AssetId GetRandomModelId() const;
         AZ::Data::AssetId GetRandomMaterialId() const;
 
         void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime) override;
 
+        // AssetLoadTestRequestBus::Handler overrides...
+        bool WriteAssetSwitchStatistics(const AZStd::string& filePath) override;
+
+        void DrawSwitchStrategyControls();
+
         struct ModelInstanceData
         {
             AZ::Transform m_transform;
             AZ::Data::AssetId m_modelAssetId;
             AZ::Data::AssetId m_materialAssetId;
+            AZ::Data::Instance<AZ::RPI::Material> m_material;   //!< Acquired from the MaterialInstancePool with the mesh handle
             AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
         };
 
@@ -99,5 +115,10 @@ namespace AtomSampleViewer
         bool m_materialSwitchEnabled = true;
         bool m_modelSwitchEnabled = true;
         bool m_updateTransformEnabled = false;
+
+        AssetSwapScheduler m_swapScheduler;
+        int m_switchStrategy = static_cast<int>(AssetSwapScheduler::Strategy::Amortized);
+        float m_switchBudgetMs = 2.0f;
+        bool m_resumeScriptAfterSwitch = false;     //!< The script was paused for the asset load and waits for the switch to finish
     };
 } // namespace AtomSampleViewer
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/BenchmarkComparison.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <math.h>
+
+namespace AtomSampleViewer
+{
+    namespace BenchmarkComparison
+    {
+        MannWhitneyResult MannWhitneyUTest(AZStd::span<const double> baseline, AZStd::span<const double> candidate)
+        {
+            MannWhitneyResult result;
+
+            const size_t baselineCount = baseline.size();
+            const size_t candidateCount = candidate.size();
+            if (baselineCount == 0 || candidateCount == 0)
+            {
+                return result;
+            }
+
+            struct RankedValue
+            {
+                double m_value;
+                bool m_isBaseline;
+            };
+
+            AZStd::vector<RankedValue> values;
+            values.reserve(baselineCount + candidateCount);
+            for (double value : baseline)
+            {
+                values.push_back({ value, true });
+            }
+            for (double value : candidate)
+            {
+                values.push_back({ value, false });
+            }
+            AZStd::sort(values.begin(), values.end(), [](const RankedValue& a, const RankedValue& b) { return a.m_value < b.m_value; });
+
+            // Tied values all get the average of their ranks
+            double baselineRankSum = 0.0;
+            double tieCorrection = 0.0;
+            for (size_t first = 0; first < values.size();)
+            {
+                size_t last = first + 1;
+                while (last < values.size() && values[last].m_value == values[first].m_value)
+                {
+                    ++last;
+                }
+
+                const double averageRank = (first + 1 + last) * 0.5;
+                for (size_t i = first; i < last; ++i)
+                {
+                    if (values[i].m_isBaseline)
+                    {
+                        baselineRankSum += averageRank;
+                    }
+                }
+
+                const double tieCount = static_cast<double>(last - first);
+                tieCorrection += tieCount * tieCount * tieCount - tieCount;
+                first = last;
+            }
+
+            const double n1 = static_cast<double>(baselineCount);
+            const double n2 = static_cast<double>(candidateCount);
+            const double n = n1 + n2;
+
+            result.m_u = baselineRankSum - n1 * (n1 + 1.0) * 0.5;
+
+            const double mean = n1 * n2 * 0.5;
+            const double variance = n1 * n2 / 12.0 * ((n + 1.0) - tieCorrection / (n * (n - 1.0)));
+            if (variance <= 0.0)
+            {
+                // Every value is the same
+                return result;
+            }
+
+            const double difference = result.m_u - mean;
+            const double continuityCorrection = AZStd::min(0.5, fabs(difference));
+            result.m_z = (difference > 0.0 ? difference - continuityCorrection : difference + continuityCorrection) / sqrt(variance);
+            result.m_pValue = AZStd::min(1.0, erfc(fabs(result.m_z) / sqrt(2.0)));
+            return result;
+        }
+
+        double Median(AZStd::span<double> values)
+        {
+            if (values.empty())
+            {
+                return 0.0;
+            }
+
+            const size_t middle = values.size() / 2;
+            AZStd::nth_element(values.begin(), values.begin() + middle, values.end());
+            const double upper = values[middle];
+            if (values.size() % 2 == 1)
+            {
+                return upper;
+            }
+
+            const double lower = *AZStd::max_element(values.begin(), values.begin() + middle);
+            return (lower + upper) * 0.5;
+        }
+
+        namespace
+        {
+            double ResampledMedian(AZStd::span<const double> values, AZStd::vector<double>& scratch, AZ::SimpleLcgRandom& random)
+            {
+                const uint32_t count = static_cast<uint32_t>(values.size());
+                for (double& value : scratch)
+                {
+                    value = values[random.GetRandom() % count];
+                }
+                return Median(scratch);
+            }
+
+            double Percentile(AZStd::span<double> sortedValues, double fraction)
+            {
+                const double position = fraction * (sortedValues.size() - 1);
+                const size_t index = static_cast<size_t>(position);
+                const size_t next = AZStd::min(index + 1, sortedValues.size() - 1);
+                return sortedValues[index] + (sortedValues[next] - sortedValues[index]) * (position - index);
+            }
+        } // namespace
+
+        ConfidenceInterval BootstrapMedianRatio(
+            AZStd::span<const double> baseline, AZStd::span<const double> candidate, uint32_t iterations, double confidenceLevel, uint64_t seed)
+        {
+            ConfidenceInterval interval;
+            if (baseline.empty() || candidate.empty() || iterations == 0)
+            {
+                return interval;
+            }
+
+            AZStd::vector<double> baselineScratch(baseline.begin(), baseline.end());
+            AZStd::vector<double> candidateScratch(candidate.begin(), candidate.end());
+
+            const double baselineMedian = Median(baselineScratch);
+            const double candidateMedian = Median(candidateScratch);
+            if (baselineMedian <= 0.0)
+            {
+                return interval;
+            }
+            interval.m_estimate = candidateMedian / baselineMedian;
+
+            AZ::SimpleLcgRandom random(seed);
+            AZStd::vector<double> ratios;
+            ratios.reserve(iterations);
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                const double resampledBaseline = ResampledMedian(baseline, baselineScratch, random);
+                const double resampledCandidate = ResampledMedian(candidate, candidateScratch, random);
+                if (resampledBaseline > 0.0)
+                {
+                    ratios.push_back(resampledCandidate / resampledBaseline);
+                }
+            }
+
+            if (ratios.empty())
+            {
+                interval.m_lower = interval.m_upper = interval.m_estimate;
+                return interval;
+            }
+
+            AZStd::sort(ratios.begin(), ratios.end());
+            const double tail = (1.0 - confidenceLevel) * 0.5;
+            interval.m_lower = Percentile(ratios, tail);
+            interval.m_upper = Percentile(ratios, 1.0 - tail);
+            return interval;
+        }
+
+        const char* ToString(Verdict verdict)
+        {
+            switch (verdict)
+            {
+            case Verdict::Unchanged:
+                return "unchanged";
+            case Verdict::Improved:
+                return "improved";
+            case Verdict::Regressed:
+                return "REGRESSED";
+            case Verdict::InsufficientData:
+                return "insufficient data";
+            }
+            return "";
+        }
+
+        SeriesComparison CompareSeries(
+            AZStd::string_view name, AZStd::span<const double> baseline, AZStd::span<const double> candidate, const Settings& settings)
+        {
+            SeriesComparison comparison;
+            comparison.m_name = AZStd::string(name);
+            comparison.m_baselineCount = baseline.size();
+            comparison.m_candidateCount = candidate.size();
+
+            AZStd::vector<double> scratch(baseline.begin(), baseline.end());
+            comparison.m_baselineMedian = Median(scratch);
+            scratch.assign(candidate.begin(), candidate.end());
+            comparison.m_candidateMedian = Median(scratch);
+
+            if (baseline.size() < settings.m_minimumSampleCount || candidate.size() < settings.m_minimumSampleCount ||
+                comparison.m_baselineMedian <= 0.0)
+            {
+                comparison.m_verdict = Verdict::InsufficientData;
+                return comparison;
+            }
+
+            comparison.m_mannWhitney = MannWhitneyUTest(baseline, candidate);
+            comparison.m_medianRatio = BootstrapMedianRatio(baseline, candidate, settings.m_bootstrapIterations, settings.m_confidenceLevel);
+
+            const bool significant = comparison.m_mannWhitney.m_pValue <= settings.m_significanceLevel;
+            const double ratio = comparison.m_medianRatio.m_estimate;
+            if (significant && comparison.m_medianRatio.m_lower > 1.0 && ratio >= 1.0 + settings.m_minimumRelativeChange)
+            {
+                comparison.m_verdict = Verdict::Regressed;
+            }
+            else if (significant && comparison.m_medianRatio.m_upper < 1.0 && ratio <= 1.0 - settings.m_minimumRelativeChange)
+            {
+                comparison.m_verdict = Verdict::Improved;
+            }
+            else
+            {
+                comparison.m_verdict = Verdict::Unchanged;
+            }
+            return comparison;
+        }
+    } // namespace BenchmarkComparison
+} // namespace AtomSampleViewer
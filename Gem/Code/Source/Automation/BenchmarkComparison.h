@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Robust statistics for comparing two sets of benchmark measurements, such as the per-frame durations of a pass
+    //! captured by two runs of the periodic benchmark suite. Frame times are heavy tailed and rarely normally distributed,
+    //! so these use ranks and resampling rather than means and t-tests.
+    namespace BenchmarkComparison
+    {
+        struct MannWhitneyResult
+        {
+            double m_u = 0.0;       //!< U statistic of the baseline sample
+            double m_z = 0.0;       //!< Normal approximation of U, with tie and continuity corrections
+            double m_pValue = 1.0;  //!< Two-sided p-value
+        };
+
+        //! Two-sided Mann-Whitney U test of whether one sample tends to have larger values than the other.
+        //! Uses the normal approximation, which is accurate for the sample sizes benchmark captures produce (more than ~20 values each).
+        MannWhitneyResult MannWhitneyUTest(AZStd::span<const double> baseline, AZStd::span<const double> candidate);
+
+        //! Returns the median of the values. The values are partially reordered.
+        double Median(AZStd::span<double> values);
+
+        struct ConfidenceInterval
+        {
+            double m_lower = 0.0;
+            double m_estimate = 0.0;
+            double m_upper = 0.0;
+        };
+
+        //! Percentile bootstrap confidence interval of median(candidate) / median(baseline).
+        //! The resampling uses a fixed seed so the same inputs always give the same interval.
+        ConfidenceInterval BootstrapMedianRatio(
+            AZStd::span<const double> baseline, AZStd::span<const double> candidate, uint32_t iterations, double confidenceLevel, uint64_t seed = 1234);
+
+        struct Settings
+        {
+            double m_significanceLevel = 0.01;       //!< Largest Mann-Whitney p-value that counts as a significant difference
+            double m_minimumRelativeChange = 0.05;   //!< Smallest change of the median that is reported, as a fraction of the baseline median
+            double m_confidenceLevel = 0.95;         //!< Confidence level of the bootstrap interval
+            uint32_t m_bootstrapIterations = 2000;
+            uint32_t m_minimumSampleCount = 10;      //!< Series with fewer values in either run are not tested
+        };
+
+        enum class Verdict
+        {
+            Unchanged,
+            Improved,
+            Regressed,
+            InsufficientData
+        };
+
+        const char* ToString(Verdict verdict);
+
+        struct SeriesComparison
+        {
+            AZStd::string m_name;
+            size_t m_baselineCount = 0;
+            size_t m_candidateCount = 0;
+            double m_baselineMedian = 0.0;
+            double m_candidateMedian = 0.0;
+            MannWhitneyResult m_mannWhitney;
+            ConfidenceInterval m_medianRatio;
+            Verdict m_verdict = Verdict::InsufficientData;
+        };
+
+        //! Compares two series where larger values are worse (durations).
+        //! A series regressed when the difference is significant, the whole confidence interval of the median ratio is above 1,
+        //! and the median grew by at least the minimum relative change. Improvements use the mirrored rules.
+        SeriesComparison CompareSeries(
+            AZStd::string_view name, AZStd::span<const double> baseline, AZStd::span<const double> candidate, const Settings& settings);
+    } // namespace BenchmarkComparison
+} // namespace AtomSampleViewer
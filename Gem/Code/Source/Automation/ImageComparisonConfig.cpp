@@ -34,13 +34,15 @@ namespace AtomSampleViewer
                 ->Field("name", &ImageComparisonToleranceLevel::m_name)
                 ->Field("threshold", &ImageComparisonToleranceLevel::m_threshold)
                 ->Field("filterImperceptibleDiffs", &ImageComparisonToleranceLevel::m_filterImperceptibleDiffs)
+                ->Field("usePerceptualScore", &ImageComparisonToleranceLevel::m_usePerceptualScore)
                 ;
         }
     }
 
     AZStd::string ImageComparisonToleranceLevel::ToString() const
     {
-        return AZStd::string::format("'%s' (threshold %f%s)", m_name.c_str(), m_threshold, m_filterImperceptibleDiffs ? ", filtered" : "");
+        return AZStd::string::format("'%s' (threshold %f%s%s)", m_name.c_str(), m_threshold, m_filterImperceptibleDiffs ? ", filtered" : "",
+            m_usePerceptualScore ? ", perceptual" : "");
     }
 
 } // namespace AtomSampleViewer
@@ -29,6 +29,7 @@ namespace AtomSampleViewer
         AZStd::string m_name;                     //!< A unique name for this tolerance level
         float m_threshold = 0.0f;                 //!< Range should be 0-1, with 0 meaning no error and 1 meaning as different as possible.
         bool m_filterImperceptibleDiffs = false;  //!< If true, visually imperceptible differences will be filtered out before scoring.
+        bool m_usePerceptualScore = false;        //!< If true, the threshold applies to the structural dissimilarity (SSIM based) of the luminance instead of the RMS diff score.
 
         AZStd::string ToString() const;
     };
@@ -0,0 +1,549 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/IncrementalTestCache.h>
+#include <Utils/JsonFile.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        // The file starts with the magic number, version, build identity and render API name, followed by the entries.
+        // Each entry is the script path, the asset hashes, the file hashes, and the reports of the script and the scripts it ran.
+        constexpr uint32_t CacheFileMagic = 0x49565341; // "ASVI"
+        constexpr uint32_t CacheFileVersion = 2;
+
+        constexpr uint64_t FnvOffsetBasis = 0xcbf29ce484222325ull;
+        constexpr uint64_t FnvPrime = 0x100000001b3ull;
+        constexpr uint64_t ReadChunkSize = 64 * 1024;
+
+        // 64-bit FNV-1a
+        uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * FnvPrime;
+            }
+            return hash;
+        }
+
+        // 64-bit FNV-1a of the file contents. Returns 0 if the file can't be read, so a missing file is a change too.
+        uint64_t HashFileContents(const char* filePath)
+        {
+            AZ::IO::FileIOBase* io = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+            if (!io || !io->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, handle))
+            {
+                return 0;
+            }
+
+            uint64_t remaining = 0;
+            io->Size(handle, remaining);
+
+            uint64_t hash = FnvOffsetBasis;
+            AZStd::vector<uint8_t> buffer(AZStd::min(remaining, ReadChunkSize));
+            while (remaining > 0)
+            {
+                const uint64_t chunkSize = AZStd::min(remaining, ReadChunkSize);
+                if (!io->Read(handle, buffer.data(), chunkSize, true))
+                {
+                    io->Close(handle);
+                    return 0;
+                }
+
+                hash = HashBytes(hash, buffer.data(), chunkSize);
+                remaining -= chunkSize;
+            }
+
+            io->Close(handle);
+            return hash != 0 ? hash : 1;
+        }
+
+        bool IsModuleFile(AZStd::string_view fileName)
+        {
+            return fileName.ends_with(".dll") || fileName.ends_with(".so") || fileName.ends_with(".dylib");
+        }
+
+        bool ReadCount(AZStd::span<const uint8_t>& data, uint32_t& count, size_t minimumItemSize)
+        {
+            // Guards against allocating huge vectors for a corrupted file
+            return ScriptReportJournal::Read(data, count) && data.size() >= count * minimumItemSize;
+        }
+    } // namespace
+
+    void IncrementalTestCache::Activate()
+    {
+        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
+    }
+
+    void IncrementalTestCache::Deactivate()
+    {
+        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
+
+        Save();
+        m_entries.clear();
+        m_isLoaded = false;
+        m_productHashes.clear();
+        m_fileHashes.clear();
+        m_catalogAssetIds.clear();
+        CancelScript();
+    }
+
+    uint64_t IncrementalTestCache::GetBuildIdentity()
+    {
+        static const uint64_t buildIdentity = []()
+        {
+            const AZStd::string executableFolder(AZ::Utils::GetExecutableDirectory().c_str());
+
+            // Samples live in the gem module and the renderer in other modules, so any of them may have been rebuilt.
+            // Monolithic builds only have the executable. Hashing the contents would read hundreds of megabytes on every run.
+            AZStd::vector<AZStd::string> filePaths;
+            char executablePath[AZ::IO::MaxPathLength];
+            if (AZ::Utils::GetExecutablePath(executablePath, AZ_ARRAY_SIZE(executablePath)).m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+            {
+                filePaths.push_back(executablePath);
+            }
+
+            AZ::IO::SystemFile::FindFiles(AZStd::string::format("%s/*", executableFolder.c_str()).c_str(),
+                [&executableFolder, &filePaths](const char* fileName, bool isFile)
+                {
+                    if (isFile && IsModuleFile(fileName))
+                    {
+                        filePaths.push_back(AZStd::string::format("%s/%s", executableFolder.c_str(), fileName));
+                    }
+                    return true;
+                });
+            AZStd::sort(filePaths.begin(), filePaths.end());
+
+            uint64_t hash = FnvOffsetBasis;
+            for (const AZStd::string& filePath : filePaths)
+            {
+                const uint64_t fileSize = AZ::IO::SystemFile::Length(filePath.c_str());
+                const uint64_t modificationTime = AZ::IO::SystemFile::ModificationTime(filePath.c_str());
+                hash = HashBytes(hash, filePath.data(), filePath.size());
+                hash = HashBytes(hash, &fileSize, sizeof(fileSize));
+                hash = HashBytes(hash, &modificationTime, sizeof(modificationTime));
+            }
+            return hash;
+        }();
+
+        return buildIdentity;
+    }
+
+    void IncrementalTestCache::SetCacheFolder(AZStd::string_view cacheFolder)
+    {
+        if (m_cacheFolder != cacheFolder)
+        {
+            Save();
+            m_cacheFolder = cacheFolder;
+            m_isLoaded = false;
+        }
+    }
+
+    AZStd::string IncrementalTestCache::GetCacheFilePath() const
+    {
+        AZStd::string cacheFilePath;
+        if (m_cacheFolder.empty())
+        {
+            AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), ScriptReporter::UserFolder, cacheFilePath);
+            AzFramework::StringFunc::Path::Join(cacheFilePath.c_str(), ScriptReporter::TestResultsFolder, cacheFilePath);
+        }
+        else
+        {
+            cacheFilePath = m_cacheFolder;
+        }
+        AzFramework::StringFunc::Path::Join(cacheFilePath.c_str(), m_cacheFileName.c_str(), cacheFilePath);
+        return cacheFilePath;
+    }
+
+    void IncrementalTestCache::Load(AZStd::string_view renderApiName, uint64_t buildIdentity, AZStd::string_view cacheFileName)
+    {
+        // Baseline images may have been updated since the last run
+        m_fileHashes.clear();
+
+        if (m_isLoaded && m_renderApiName == renderApiName && m_buildIdentity == buildIdentity && m_cacheFileName == cacheFileName)
+        {
+            return;
+        }
+
+        // Each test shard keeps its own file, so keep what was recorded with the previous one
+        Save();
+
+        m_entries.clear();
+        m_renderApiName = renderApiName;
+        m_buildIdentity = buildIdentity;
+        m_cacheFileName = cacheFileName;
+        m_isLoaded = true;
+        m_isModified = false;
+
+        const AZStd::string cacheFilePath = GetCacheFilePath();
+        if (!AZ::IO::SystemFile::Exists(cacheFilePath.c_str()))
+        {
+            return;
+        }
+
+        AZStd::vector<uint8_t> fileData(AZ::IO::SystemFile::Length(cacheFilePath.c_str()));
+        if (AZ::IO::SystemFile::Read(cacheFilePath.c_str(), fileData.data(), fileData.size()) != fileData.size())
+        {
+            AZ_Warning("IncrementalTestCache", false, "Failed to read '%s', all scripts will run.", cacheFilePath.c_str());
+            return;
+        }
+
+        using namespace ScriptReportJournal;
+
+        AZStd::span<const uint8_t> data = fileData;
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t fileBuildIdentity = 0;
+        AZStd::string_view fileRenderApiName;
+        uint32_t entryCount = 0;
+        if (!Read(data, magic) || magic != CacheFileMagic || !Read(data, version) || version != CacheFileVersion ||
+            !Read(data, fileBuildIdentity) || !ReadString(data, fileRenderApiName) || !ReadCount(data, entryCount, sizeof(uint32_t)))
+        {
+            AZ_Warning("IncrementalTestCache", false, "'%s' is not a supported incremental test cache, all scripts will run.", cacheFilePath.c_str());
+            m_isModified = true;
+            return;
+        }
+
+        if (fileBuildIdentity != buildIdentity)
+        {
+            AZ_TracePrintf("IncrementalTestCache", "Incremental test cache was recorded with a different build, all scripts will run.\n");
+            m_isModified = true;
+            return;
+        }
+
+        if (fileRenderApiName != renderApiName)
+        {
+            AZ_TracePrintf("IncrementalTestCache", "Incremental test cache was recorded with '%.*s', all scripts will run.\n", AZ_STRING_ARG(fileRenderApiName));
+            m_isModified = true;
+            return;
+        }
+
+        bool succeeded = true;
+        for (uint32_t entryIndex = 0; succeeded && entryIndex < entryCount; ++entryIndex)
+        {
+            AZStd::string_view scriptAssetPath;
+            uint32_t count = 0;
+            Entry entry;
+
+            succeeded = ReadString(data, scriptAssetPath) && ReadCount(data, count, sizeof(AZ::Uuid) + sizeof(uint32_t) + sizeof(uint64_t));
+            entry.m_assetHashes.resize(succeeded ? count : 0);
+            for (auto& [assetId, hash] : entry.m_assetHashes)
+            {
+                succeeded = succeeded && Read(data, assetId.m_guid) && Read(data, assetId.m_subId) && Read(data, hash);
+            }
+
+            succeeded = succeeded && ReadCount(data, count, sizeof(uint32_t) + sizeof(uint64_t));
+            entry.m_fileHashes.resize(succeeded ? count : 0);
+            for (auto& [filePath, hash] : entry.m_fileHashes)
+            {
+                AZStd::string_view path;
+                succeeded = succeeded && ReadString(data, path) && Read(data, hash);
+                filePath = path;
+            }
+
+            succeeded = succeeded && ReadCount(data, count, sizeof(uint32_t) * 4 + sizeof(uint64_t));
+            entry.m_reports.resize(succeeded ? count : 0);
+            for (CachedScriptReport& report : entry.m_reports)
+            {
+                AZStd::string_view reportScriptAssetPath;
+                uint32_t screenshotTestCount = 0;
+                uint64_t byteCount = 0;
+                succeeded = succeeded && ReadString(data, reportScriptAssetPath) && Read(data, report.m_generalWarningCount) &&
+                    Read(data, report.m_screenshotWarningCount) && Read(data, screenshotTestCount) && Read(data, byteCount) &&
+                    byteCount <= data.size() && screenshotTestCount <= byteCount &&
+                    ReadScreenshotTests(data.subspan(0, byteCount), screenshotTestCount, report.m_screenshotTests);
+                if (succeeded)
+                {
+                    report.m_scriptAssetPath = reportScriptAssetPath;
+                    data = data.subspan(byteCount);
+                }
+            }
+
+            if (succeeded)
+            {
+                m_entries[AZStd::string(scriptAssetPath)] = AZStd::move(entry);
+            }
+        }
+
+        if (!succeeded || !data.empty())
+        {
+            AZ_Warning("IncrementalTestCache", false, "'%s' is corrupted, all scripts will run.", cacheFilePath.c_str());
+            m_entries.clear();
+            m_isModified = true;
+        }
+    }
+
+    void IncrementalTestCache::Save()
+    {
+        if (!m_isLoaded || !m_isModified)
+        {
+            return;
+        }
+
+        using namespace ScriptReportJournal;
+
+        AZStd::vector<uint8_t> buffer;
+        Write(buffer, CacheFileMagic);
+        Write(buffer, CacheFileVersion);
+        Write(buffer, m_buildIdentity);
+        WriteString(buffer, m_renderApiName);
+        Write(buffer, aznumeric_cast<uint32_t>(m_entries.size()));
+        for (const auto& [scriptAssetPath, entry] : m_entries)
+        {
+            WriteString(buffer, scriptAssetPath);
+
+            Write(buffer, aznumeric_cast<uint32_t>(entry.m_assetHashes.size()));
+            for (const auto& [assetId, hash] : entry.m_assetHashes)
+            {
+                Write(buffer, assetId.m_guid);
+                Write(buffer, assetId.m_subId);
+                Write(buffer, hash);
+            }
+
+            Write(buffer, aznumeric_cast<uint32_t>(entry.m_fileHashes.size()));
+            for (const auto& [filePath, hash] : entry.m_fileHashes)
+            {
+                WriteString(buffer, filePath);
+                Write(buffer, hash);
+            }
+
+            Write(buffer, aznumeric_cast<uint32_t>(entry.m_reports.size()));
+            for (const CachedScriptReport& report : entry.m_reports)
+            {
+                WriteString(buffer, report.m_scriptAssetPath);
+                Write(buffer, report.m_generalWarningCount);
+                Write(buffer, report.m_screenshotWarningCount);
+                Write(buffer, aznumeric_cast<uint32_t>(report.m_screenshotTests.size()));
+                WriteScreenshotTests(buffer, report.m_screenshotTests);
+            }
+        }
+
+        const AZStd::string cacheFilePath = GetCacheFilePath();
+        if (!Utils::WriteFile(cacheFilePath, buffer.data(), buffer.size()))
+        {
+            AZ_Warning("IncrementalTestCache", false, "Failed to write '%s'.", cacheFilePath.c_str());
+            return;
+        }
+
+        m_isModified = false;
+    }
+
+    void IncrementalTestCache::Clear()
+    {
+        m_entries.clear();
+        m_isModified = false;
+
+        const AZStd::string cacheFilePath = GetCacheFilePath();
+        if (AZ::IO::SystemFile::Exists(cacheFilePath.c_str()))
+        {
+            AZ::IO::SystemFile::Delete(cacheFilePath.c_str());
+        }
+    }
+
+    const AZStd::vector<IncrementalTestCache::CachedScriptReport>* IncrementalTestCache::FindUpToDateReports(const AZStd::string& scriptAssetPath)
+    {
+        auto entryIter = m_entries.find(scriptAssetPath);
+        if (entryIter == m_entries.end())
+        {
+            return nullptr;
+        }
+
+        const Entry& entry = entryIter->second;
+        for (const auto& [assetId, hash] : entry.m_assetHashes)
+        {
+            if (GetProductHash(assetId) != hash)
+            {
+                return nullptr;
+            }
+        }
+
+        for (const auto& [filePath, hash] : entry.m_fileHashes)
+        {
+            if (GetFileHash(filePath) != hash)
+            {
+                return nullptr;
+            }
+        }
+
+        return &entry.m_reports;
+    }
+
+    void IncrementalTestCache::BeginScript(const AZStd::string& scriptAssetPath, size_t firstReportIndex)
+    {
+        AZ_Assert(!m_isRecording, "IncrementalTestCache is already recording '%s'", m_recordingScriptAssetPath.c_str());
+
+        m_isRecording = true;
+        m_recordingScriptAssetPath = scriptAssetPath;
+        m_recordingFirstReportIndex = firstReportIndex;
+        m_recordedAssets.clear();
+    }
+
+    void IncrementalTestCache::RecordLoadedAssets()
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        if (m_catalogAssetIds.empty())
+        {
+            auto startCB = []() {};
+
+            auto enumerateCB = [this](const AZ::Data::AssetId id, const AZ::Data::AssetInfo&)
+            {
+                m_catalogAssetIds.push_back(id);
+            };
+
+            auto endCB = []() {};
+
+            AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, startCB, enumerateCB, endCB);
+        }
+
+        // The asset manager has no list of loaded assets, so look up every asset in the catalog. NoLoad never starts loading an asset.
+        AZ::Data::AssetManager& assetManager = AZ::Data::AssetManager::Instance();
+        for (const AZ::Data::AssetId& assetId : m_catalogAssetIds)
+        {
+            if (assetManager.FindAsset(assetId, AZ::Data::AssetLoadBehavior::NoLoad))
+            {
+                m_recordedAssets.insert(assetId);
+            }
+        }
+    }
+
+    void IncrementalTestCache::RecordAsset(const AZ::Data::AssetId& assetId)
+    {
+        if (m_isRecording)
+        {
+            m_recordedAssets.insert(assetId);
+        }
+    }
+
+    void IncrementalTestCache::EndScript(ScriptReporter& scriptReporter)
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        m_isRecording = false;
+        m_isModified = true;
+
+        Entry entry;
+        bool passed = true;
+        const size_t reportCount = scriptReporter.GetScriptReport().size();
+        for (size_t reportIndex = m_recordingFirstReportIndex; passed && reportIndex < reportCount; ++reportIndex)
+        {
+            const ScriptReporter::ScriptReport& scriptReport = scriptReporter.LoadScriptReport(reportIndex);
+            passed = scriptReport.m_assertCount == 0 && scriptReport.m_generalErrorCount == 0 && scriptReport.m_screenshotErrorCount == 0;
+
+            CachedScriptReport& report = entry.m_reports.emplace_back();
+            report.m_scriptAssetPath = scriptReport.m_scriptAssetPath.GetStringView();
+            report.m_generalWarningCount = scriptReport.m_generalWarningCount;
+            report.m_screenshotWarningCount = scriptReport.m_screenshotWarningCount;
+            report.m_screenshotTests = scriptReport.m_screenshotTests;
+
+            // The screenshots are inputs too, so a result isn't reused after its images were deleted or replaced
+            for (const ScriptReporter::ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                for (const AZ::Name& filePath : { screenshotTest.m_screenshotFilePath, screenshotTest.m_officialBaselineScreenshotFilePath, screenshotTest.m_localBaselineScreenshotFilePath })
+                {
+                    AZStd::string path(filePath.GetStringView());
+                    const uint64_t hash = GetFileHash(path);
+                    entry.m_fileHashes.emplace_back(AZStd::move(path), hash);
+                }
+            }
+        }
+
+        if (!passed || entry.m_reports.empty())
+        {
+            m_entries.erase(m_recordingScriptAssetPath);
+            m_recordedAssets.clear();
+            return;
+        }
+
+        entry.m_assetHashes.reserve(m_recordedAssets.size());
+        for (const AZ::Data::AssetId& assetId : m_recordedAssets)
+        {
+            entry.m_assetHashes.emplace_back(assetId, GetProductHash(assetId));
+        }
+        m_recordedAssets.clear();
+
+        m_entries[m_recordingScriptAssetPath] = AZStd::move(entry);
+    }
+
+    void IncrementalTestCache::CancelScript()
+    {
+        m_isRecording = false;
+        m_recordedAssets.clear();
+    }
+
+    uint64_t IncrementalTestCache::GetProductHash(const AZ::Data::AssetId& assetId)
+    {
+        auto hashIter = m_productHashes.find(assetId);
+        if (hashIter != m_productHashes.end())
+        {
+            return hashIter->second;
+        }
+
+        AZ::Data::AssetInfo assetInfo;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+
+        uint64_t hash = 0;
+        if (assetInfo.m_assetId.IsValid())
+        {
+            const AZStd::string productPath = AZStd::string::format("@products@/%s", assetInfo.m_relativePath.c_str());
+            hash = HashFileContents(productPath.c_str());
+        }
+
+        m_productHashes[assetId] = hash;
+        return hash;
+    }
+
+    uint64_t IncrementalTestCache::GetFileHash(const AZStd::string& filePath)
+    {
+        if (filePath.empty())
+        {
+            return 0;
+        }
+
+        auto hashIter = m_fileHashes.find(filePath);
+        if (hashIter != m_fileHashes.end())
+        {
+            return hashIter->second;
+        }
+
+        const uint64_t hash = HashFileContents(filePath.c_str());
+        m_fileHashes[filePath] = hash;
+        return hash;
+    }
+
+    void IncrementalTestCache::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
+    {
+        m_productHashes.erase(assetId);
+    }
+
+    void IncrementalTestCache::OnCatalogAssetAdded(const AZ::Data::AssetId& assetId)
+    {
+        m_productHashes.erase(assetId);
+        m_catalogAssetIds.clear();
+    }
+
+    void IncrementalTestCache::OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo&)
+    {
+        m_productHashes.erase(assetId);
+        m_catalogAssetIds.clear();
+    }
+} // namespace AtomSampleViewer
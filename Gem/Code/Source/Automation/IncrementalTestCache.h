@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Automation/ScriptReporter.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Asset/AssetCatalogBus.h>
+
+namespace AtomSampleViewer
+{
+    //! Remembers the inputs and results of each script that passed, so an incremental test run can skip scripts whose inputs
+    //! haven't changed since then and reuse their results.
+    //!
+    //! The inputs of a script are the content hashes of every product asset that was loaded while it ran (sampled when it
+    //! opens a sample, captures a screenshot, and ends, which includes models, materials, images and shaders), the script
+    //! assets themselves, and the screenshot and baseline image files it compared. Hashes of product assets are computed
+    //! once and kept until the Asset Processor reports a change to that asset.
+    //!
+    //! The cache is stored in the user/TestResults folder and is only valid for the build and render API it was recorded with,
+    //! so a C++ change to a sample or to the engine runs every script again.
+    class IncrementalTestCache final
+        : private AzFramework::AssetCatalogEventBus::Handler
+    {
+    public:
+        static constexpr const char* CacheFileBaseName = "incrementalTestCache";
+        static constexpr const char* CacheFileName = "incrementalTestCache.bin";
+
+        struct CachedScriptReport
+        {
+            AZStd::string m_scriptAssetPath;
+            uint32_t m_generalWarningCount = 0;
+            uint32_t m_screenshotWarningCount = 0;
+            AZStd::vector<ScriptReporter::ScreenshotTestInfo> m_screenshotTests;
+        };
+
+        void Activate();
+        void Deactivate();
+
+        //! Returns an identity of the running build, computed from the size and modification time of the executable and of the
+        //! modules in its folder. It's computed once per process.
+        static uint64_t GetBuildIdentity();
+
+        //! Sets the folder of the cache file. Defaults to the user/TestResults folder of the project.
+        void SetCacheFolder(AZStd::string_view cacheFolder);
+
+        //! Loads the cache file, unless it's already loaded. Entries are discarded if they were recorded with a different build
+        //! or render API. Sharded test runs pass a different file name per shard, so concurrent processes don't overwrite each
+        //! other's cache.
+        void Load(AZStd::string_view renderApiName, uint64_t buildIdentity, AZStd::string_view cacheFileName = CacheFileName);
+
+        //! Writes the cache file if any entries changed since it was loaded.
+        void Save();
+
+        //! Removes all entries and deletes the cache file.
+        void Clear();
+
+        size_t GetEntryCount() const { return m_entries.size(); }
+
+        //! Returns the reports of the script and any scripts it ran, if the script passed before and none of its inputs changed
+        //! since then. Otherwise returns nullptr.
+        const AZStd::vector<CachedScriptReport>* FindUpToDateReports(const AZStd::string& scriptAssetPath);
+
+        //! Starts collecting the inputs of a script. Reports added to the ScriptReporter from now on belong to this script.
+        void BeginScript(const AZStd::string& scriptAssetPath, size_t firstReportIndex);
+
+        //! Records the product assets that are currently loaded as inputs of the script.
+        void RecordLoadedAssets();
+
+        //! Records an asset as input of the script, whether or not it's still loaded.
+        void RecordAsset(const AZ::Data::AssetId& assetId);
+
+        //! Finishes the script. It's added to the cache if all of its reports passed, and removed from the cache otherwise.
+        void EndScript(ScriptReporter& scriptReporter);
+
+        //! Stops collecting the inputs of the current script without changing the cache.
+        void CancelScript();
+
+        bool IsRecording() const { return m_isRecording; }
+
+    private:
+        struct Entry
+        {
+            AZStd::vector<AZStd::pair<AZ::Data::AssetId, uint64_t>> m_assetHashes;
+            AZStd::vector<AZStd::pair<AZStd::string, uint64_t>> m_fileHashes;
+            AZStd::vector<CachedScriptReport> m_reports;
+        };
+
+        // AzFramework::AssetCatalogEventBus::Handler overrides...
+        void OnCatalogAssetChanged(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo) override;
+
+        // Returns the hash of the asset's product file, or 0 if the asset isn't in the catalog
+        uint64_t GetProductHash(const AZ::Data::AssetId& assetId);
+
+        // Returns the hash of a file, or 0 if the file doesn't exist
+        uint64_t GetFileHash(const AZStd::string& filePath);
+
+        AZStd::string GetCacheFilePath() const;
+
+        AZStd::unordered_map<AZStd::string /*script asset path*/, Entry> m_entries;
+        AZStd::string m_renderApiName;
+        uint64_t m_buildIdentity = 0;
+        AZStd::string m_cacheFolder;
+        AZStd::string m_cacheFileName = CacheFileName;
+        bool m_isLoaded = false;
+        bool m_isModified = false;
+
+        AZStd::unordered_map<AZ::Data::AssetId, uint64_t> m_productHashes; //< Kept until the asset changes
+        AZStd::unordered_map<AZStd::string, uint64_t> m_fileHashes;        //< Kept until the next Load(), since baselines can be updated between runs
+        AZStd::vector<AZ::Data::AssetId> m_catalogAssetIds;                //< Every asset in the catalog, to find the loaded ones
+
+        bool m_isRecording = false;
+        AZStd::string m_recordingScriptAssetPath;
+        size_t m_recordingFirstReportIndex = 0;
+        AZStd::unordered_set<AZ::Data::AssetId> m_recordedAssets;
+    };
+} // namespace AtomSampleViewer
@@ -53,14 +53,14 @@ namespace AtomSampleViewer
         // This function does the following:
         // 1. Collect passing screenshot tests and sorts them by decreasing diff score.
         // 2. Collect failed screenshot tests and sorts them by decreasing diff score. 
-        void ProcessScriptReports(const AZStd::vector<ScriptReporter::ScriptReport>& scriptReports)
+        void ProcessScriptReports(ScriptReporter& scriptReporter)
         {
             m_reportsOrderedByThresholdToInspect.clear();
             m_failedReports.clear();
 
-            for (size_t i = 0; i < scriptReports.size(); ++i)
+            for (size_t i = 0; i < scriptReporter.GetScriptReport().size(); ++i)
             {
-                const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTestInfos = scriptReports[i].m_screenshotTests;
+                const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTestInfos = scriptReporter.LoadScriptReport(i).m_screenshotTests;
                 for (size_t j = 0; j < screenshotTestInfos.size(); ++j)
                 {
                     // Collect and sort reports that passed by threshold. This will be used to detect false negatives
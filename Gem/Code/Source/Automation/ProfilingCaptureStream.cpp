@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ProfilingCaptureStream.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AtomSampleViewer
+{
+    using namespace ProfilingCaptureStream;
+
+    ProfilingCaptureStreamWriter::~ProfilingCaptureStreamWriter()
+    {
+        if (IsOpen())
+        {
+            Close();
+        }
+    }
+
+    bool ProfilingCaptureStreamWriter::Open(const AZStd::string& filePath, AZStd::string_view captureName)
+    {
+        AZ_Assert(!IsOpen(), "The profiling capture stream '%s' is already open", m_filePath.c_str());
+
+        // The stream is flushed to the file in chunks while frames are captured, so it keeps the file open rather than writing
+        // one buffer with Utils::WriteFile()
+        const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+        if (!m_file.Open(filePath.c_str(), openMode))
+        {
+            return false;
+        }
+
+        m_filePath = filePath;
+        m_buffer.clear();
+        m_buffer.reserve(FlushThreshold + FlushThreshold / 4);
+        m_passNames.clear();
+        m_passIndices.clear();
+        m_frameIndices.clear();
+        m_writtenPassNameCount = 0;
+        m_frameCount = 0;
+        m_writeFailed = false;
+
+        FileHeader header;
+        memcpy(header.m_magic, Magic, sizeof(Magic));
+        header.m_headerSize = sizeof(FileHeader);
+        header.m_frameRecordSize = sizeof(FrameRecord);
+        header.m_passTimestampRecordSize = sizeof(PassTimestampRecord);
+        const size_t nameLength = AZStd::min(captureName.size(), MaxCaptureNameLength - 1);
+        memcpy(header.m_captureName, captureName.data(), nameLength);
+        AppendRecord(header);
+
+        return true;
+    }
+
+    void ProfilingCaptureStreamWriter::AddFrame(uint64_t frameNumber, double cpuFrameTime, AZStd::span<const PassTimestamp> passTimestamps)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        // Map pass names to indices. The pass hierarchy rarely changes between frames, so compare against the previous frame
+        // first and only fall back to the map lookup when the passes differ.
+        const size_t previousPassCount = m_frameIndices.size();
+        m_frameIndices.resize(passTimestamps.size());
+        for (size_t i = 0; i < passTimestamps.size(); ++i)
+        {
+            const AZStd::string_view passName = passTimestamps[i].m_passName;
+            if (i < previousPassCount && m_passNames[m_frameIndices[i]] == passName)
+            {
+                continue;
+            }
+
+            AZStd::string passNameString(passName);
+            auto passIter = m_passIndices.find(passNameString);
+            if (passIter == m_passIndices.end())
+            {
+                const uint32_t passIndex = aznumeric_cast<uint32_t>(m_passNames.size());
+                m_passNames.push_back(passNameString);
+                passIter = m_passIndices.emplace(AZStd::move(passNameString), passIndex).first;
+            }
+            m_frameIndices[i] = passIter->second;
+        }
+
+        if (m_writtenPassNameCount < m_passNames.size())
+        {
+            size_t payloadSize = sizeof(PassNamesHeader);
+            for (size_t i = m_writtenPassNameCount; i < m_passNames.size(); ++i)
+            {
+                payloadSize += sizeof(uint32_t) + m_passNames[i].size();
+            }
+
+            AppendChunkHeader(ChunkType::PassNames, payloadSize);
+
+            PassNamesHeader namesHeader;
+            namesHeader.m_firstIndex = aznumeric_cast<uint32_t>(m_writtenPassNameCount);
+            namesHeader.m_count = aznumeric_cast<uint32_t>(m_passNames.size() - m_writtenPassNameCount);
+            AppendRecord(namesHeader);
+
+            for (size_t i = m_writtenPassNameCount; i < m_passNames.size(); ++i)
+            {
+                const AZStd::string& passName = m_passNames[i];
+                AppendRecord(aznumeric_cast<uint32_t>(passName.size()));
+                m_buffer.insert(m_buffer.end(), passName.begin(), passName.end());
+            }
+            AppendPadding();
+
+            m_writtenPassNameCount = m_passNames.size();
+        }
+
+        AppendChunkHeader(ChunkType::Frame, sizeof(FrameRecord) + passTimestamps.size() * sizeof(PassTimestampRecord));
+
+        FrameRecord frameRecord;
+        frameRecord.m_frameNumber = frameNumber;
+        frameRecord.m_cpuFrameTime = cpuFrameTime;
+        frameRecord.m_passCount = aznumeric_cast<uint32_t>(passTimestamps.size());
+        AppendRecord(frameRecord);
+
+        for (size_t i = 0; i < passTimestamps.size(); ++i)
+        {
+            PassTimestampRecord timestampRecord;
+            timestampRecord.m_passIndex = m_frameIndices[i];
+            timestampRecord.m_durationInNanoseconds = passTimestamps[i].m_durationInNanoseconds;
+            AppendRecord(timestampRecord);
+        }
+
+        ++m_frameCount;
+
+        if (m_buffer.size() >= FlushThreshold)
+        {
+            FlushBuffer();
+        }
+    }
+
+    bool ProfilingCaptureStreamWriter::Close()
+    {
+        if (!IsOpen())
+        {
+            return false;
+        }
+
+        AppendChunkHeader(ChunkType::End, sizeof(EndRecord));
+        EndRecord endRecord;
+        endRecord.m_frameCount = m_frameCount;
+        endRecord.m_passNameCount = m_passNames.size();
+        AppendRecord(endRecord);
+
+        FlushBuffer();
+        m_file.Flush();
+        m_file.Close();
+
+        m_buffer = {};
+        m_passIndices.clear();
+        m_frameIndices.clear();
+
+        return !m_writeFailed;
+    }
+
+    bool ProfilingCaptureStreamWriter::IsOpen() const
+    {
+        return m_file.IsOpen();
+    }
+
+    const AZStd::string& ProfilingCaptureStreamWriter::GetFilePath() const
+    {
+        return m_filePath;
+    }
+
+    uint64_t ProfilingCaptureStreamWriter::GetFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    template<typename T>
+    void ProfilingCaptureStreamWriter::AppendRecord(const T& record)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void ProfilingCaptureStreamWriter::AppendChunkHeader(ChunkType type, size_t payloadSize)
+    {
+        ChunkHeader chunkHeader;
+        chunkHeader.m_type = type;
+        chunkHeader.m_payloadSize = aznumeric_cast<uint32_t>(AZ::SizeAlignUp(payloadSize, ChunkAlignment));
+        AppendRecord(chunkHeader);
+    }
+
+    void ProfilingCaptureStreamWriter::AppendPadding()
+    {
+        // The buffer is only flushed on chunk boundaries, which are aligned, so aligning the buffer size aligns the file offset.
+        m_buffer.resize(AZ::SizeAlignUp(m_buffer.size(), ChunkAlignment), 0);
+    }
+
+    void ProfilingCaptureStreamWriter::FlushBuffer()
+    {
+        if (m_buffer.empty())
+        {
+            return;
+        }
+
+        if (m_file.Write(m_buffer.data(), m_buffer.size()) != m_buffer.size())
+        {
+            if (!m_writeFailed)
+            {
+                AZ_Error("Automation", false, "Failed to write to profiling capture stream '%s'", m_filePath.c_str());
+            }
+            m_writeFailed = true;
+        }
+
+        m_buffer.clear();
+    }
+
+    void ProfilingCaptureFrameRing::Reset(size_t frameCapacity, size_t passCapacity)
+    {
+        m_frames.clear();
+        m_frames.resize(frameCapacity);
+        m_passes.clear();
+        m_passes.resize(frameCapacity * passCapacity);
+        m_passCapacity = passCapacity;
+        m_nextFrame = 0;
+        m_frameCount = 0;
+        m_droppedPassCount = 0;
+
+        m_passNames.clear();
+        m_passIndices.clear();
+        m_previousPassIndices.clear();
+        m_previousPassIndices.reserve(passCapacity);
+    }
+
+    void ProfilingCaptureFrameRing::PushFrame(uint64_t frameNumber, double cpuFrameTime, AZStd::span<const ProfilingCaptureStreamWriter::PassTimestamp> passTimestamps)
+    {
+        if (m_frames.empty())
+        {
+            return;
+        }
+
+        const size_t passCount = AZStd::min(passTimestamps.size(), m_passCapacity);
+        m_droppedPassCount += passTimestamps.size() - passCount;
+
+        FrameSlot& frame = m_frames[m_nextFrame];
+        frame.m_frameNumber = frameNumber;
+        frame.m_cpuFrameTime = cpuFrameTime;
+        frame.m_passCount = aznumeric_cast<uint32_t>(passCount);
+
+        PassSlot* passes = m_passes.data() + m_nextFrame * m_passCapacity;
+        for (size_t i = 0; i < passCount; ++i)
+        {
+            passes[i].m_passIndex = FindOrAddPassName(passTimestamps[i].m_passName, i);
+            passes[i].m_durationInNanoseconds = passTimestamps[i].m_durationInNanoseconds;
+        }
+
+        m_nextFrame = (m_nextFrame + 1) % m_frames.size();
+        m_frameCount = AZStd::min(m_frameCount + 1, m_frames.size());
+    }
+
+    uint32_t ProfilingCaptureFrameRing::FindOrAddPassName(AZStd::string_view passName, size_t passPosition)
+    {
+        // Same as the writer, the passes usually match the previous frame, which avoids building a string for the map lookup.
+        if (passPosition < m_previousPassIndices.size() && m_passNames[m_previousPassIndices[passPosition]] == passName)
+        {
+            return m_previousPassIndices[passPosition];
+        }
+
+        AZStd::string passNameString(passName);
+        auto passIter = m_passIndices.find(passNameString);
+        if (passIter == m_passIndices.end())
+        {
+            const uint32_t passIndex = aznumeric_cast<uint32_t>(m_passNames.size());
+            m_passNames.push_back(passNameString);
+            passIter = m_passIndices.emplace(AZStd::move(passNameString), passIndex).first;
+        }
+
+        if (passPosition >= m_previousPassIndices.size())
+        {
+            m_previousPassIndices.resize(passPosition + 1);
+        }
+        m_previousPassIndices[passPosition] = passIter->second;
+
+        return passIter->second;
+    }
+
+    void ProfilingCaptureFrameRing::WriteTo(ProfilingCaptureStreamWriter& writer) const
+    {
+        if (m_frameCount == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<ProfilingCaptureStreamWriter::PassTimestamp> passTimestamps;
+        passTimestamps.reserve(m_passCapacity);
+
+        const size_t firstFrame = (m_nextFrame + m_frames.size() - m_frameCount) % m_frames.size();
+        for (size_t i = 0; i < m_frameCount; ++i)
+        {
+            const size_t frameIndex = (firstFrame + i) % m_frames.size();
+            const FrameSlot& frame = m_frames[frameIndex];
+            const PassSlot* passes = m_passes.data() + frameIndex * m_passCapacity;
+
+            passTimestamps.clear();
+            for (uint32_t passIndex = 0; passIndex < frame.m_passCount; ++passIndex)
+            {
+                ProfilingCaptureStreamWriter::PassTimestamp& passTimestamp = passTimestamps.emplace_back();
+                passTimestamp.m_passName = m_passNames[passes[passIndex].m_passIndex];
+                passTimestamp.m_durationInNanoseconds = passes[passIndex].m_durationInNanoseconds;
+            }
+
+            writer.AddFrame(frame.m_frameNumber, frame.m_cpuFrameTime, passTimestamps);
+        }
+    }
+
+    size_t ProfilingCaptureFrameRing::GetFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    size_t ProfilingCaptureFrameRing::GetFrameCapacity() const
+    {
+        return m_frames.size();
+    }
+
+    uint64_t ProfilingCaptureFrameRing::GetDroppedPassCount() const
+    {
+        return m_droppedPassCount;
+    }
+
+    bool ProfilingCaptureStreamReader::Load(const AZStd::string& filePath)
+    {
+        const uint64_t fileSize = AZ::IO::SystemFile::Length(filePath.c_str());
+        if (fileSize == 0)
+        {
+            return Fail(AZStd::string::format("Can't read '%s'", filePath.c_str()));
+        }
+
+        AZStd::vector<uint8_t> data(fileSize);
+        if (AZ::IO::SystemFile::Read(filePath.c_str(), data.data(), fileSize) != fileSize)
+        {
+            return Fail(AZStd::string::format("Can't read '%s'", filePath.c_str()));
+        }
+
+        return Parse(AZStd::move(data));
+    }
+
+    bool ProfilingCaptureStreamReader::Parse(AZStd::vector<uint8_t>&& data)
+    {
+        m_data = AZStd::move(data);
+        m_error.clear();
+        m_captureName.clear();
+        m_passNames.clear();
+        m_frames.clear();
+        m_isComplete = false;
+
+        if (m_data.size() < sizeof(FileHeader))
+        {
+            return Fail("File is too small to be a profiling capture stream");
+        }
+
+        FileHeader header;
+        memcpy(&header, m_data.data(), sizeof(FileHeader));
+
+        if (memcmp(header.m_magic, Magic, sizeof(Magic)) != 0)
+        {
+            return Fail("File is not a profiling capture stream");
+        }
+
+        if (header.m_version != Version)
+        {
+            return Fail(AZStd::string::format("Unsupported profiling capture stream version %u, expected %u", header.m_version, Version));
+        }
+
+        if (header.m_headerSize != sizeof(FileHeader) ||
+            header.m_frameRecordSize != sizeof(FrameRecord) ||
+            header.m_passTimestampRecordSize != sizeof(PassTimestampRecord))
+        {
+            return Fail("Profiling capture stream record layout doesn't match this reader");
+        }
+
+        header.m_captureName[MaxCaptureNameLength - 1] = '\0';
+        m_captureName = header.m_captureName;
+
+        size_t offset = sizeof(FileHeader);
+        while (!m_isComplete && offset + sizeof(ChunkHeader) <= m_data.size())
+        {
+            ChunkHeader chunkHeader;
+            memcpy(&chunkHeader, m_data.data() + offset, sizeof(ChunkHeader));
+
+            const size_t payloadOffset = offset + sizeof(ChunkHeader);
+            if (chunkHeader.m_payloadSize > m_data.size() - payloadOffset)
+            {
+                // Truncated stream, keep everything up to the last complete chunk
+                break;
+            }
+
+            const uint8_t* payload = m_data.data() + payloadOffset;
+            const size_t payloadSize = chunkHeader.m_payloadSize;
+
+            switch (chunkHeader.m_type)
+            {
+            case ChunkType::PassNames:
+            {
+                if (payloadSize < sizeof(PassNamesHeader))
+                {
+                    return Fail("Corrupt pass name chunk");
+                }
+
+                PassNamesHeader namesHeader;
+                memcpy(&namesHeader, payload, sizeof(PassNamesHeader));
+                if (namesHeader.m_firstIndex != m_passNames.size())
+                {
+                    return Fail("Pass name chunks are out of order");
+                }
+
+                size_t nameOffset = sizeof(PassNamesHeader);
+                for (uint32_t i = 0; i < namesHeader.m_count; ++i)
+                {
+                    uint32_t nameLength = 0;
+                    if (nameOffset + sizeof(uint32_t) > payloadSize)
+                    {
+                        return Fail("Corrupt pass name chunk");
+                    }
+                    memcpy(&nameLength, payload + nameOffset, sizeof(uint32_t));
+                    nameOffset += sizeof(uint32_t);
+
+                    if (nameLength > payloadSize - nameOffset)
+                    {
+                        return Fail("Corrupt pass name chunk");
+                    }
+                    m_passNames.emplace_back(reinterpret_cast<const char*>(payload + nameOffset), nameLength);
+                    nameOffset += nameLength;
+                }
+                break;
+            }
+            case ChunkType::Frame:
+            {
+                if (payloadSize < sizeof(FrameRecord))
+                {
+                    return Fail("Corrupt frame chunk");
+                }
+
+                FrameRecord frameRecord;
+                memcpy(&frameRecord, payload, sizeof(FrameRecord));
+                if (frameRecord.m_passCount > (payloadSize - sizeof(FrameRecord)) / sizeof(PassTimestampRecord))
+                {
+                    return Fail("Corrupt frame chunk");
+                }
+
+                Frame frame;
+                frame.m_frameNumber = frameRecord.m_frameNumber;
+                frame.m_cpuFrameTime = frameRecord.m_cpuFrameTime;
+                frame.m_passTimestamps = AZStd::span<const PassTimestampRecord>(
+                    reinterpret_cast<const PassTimestampRecord*>(payload + sizeof(FrameRecord)), frameRecord.m_passCount);
+
+                for (const PassTimestampRecord& timestamp : frame.m_passTimestamps)
+                {
+                    if (timestamp.m_passIndex >= m_passNames.size())
+                    {
+                        return Fail("Frame refers to an unknown pass");
+                    }
+                }
+
+                m_frames.push_back(frame);
+                break;
+            }
+            case ChunkType::End:
+                m_isComplete = true;
+                break;
+            default:
+                // Skip chunks added by newer writers
+                break;
+            }
+
+            offset = payloadOffset + payloadSize;
+        }
+
+        return true;
+    }
+
+    const AZStd::string& ProfilingCaptureStreamReader::GetError() const
+    {
+        return m_error;
+    }
+
+    bool ProfilingCaptureStreamReader::IsComplete() const
+    {
+        return m_isComplete;
+    }
+
+    AZStd::string_view ProfilingCaptureStreamReader::GetCaptureName() const
+    {
+        return m_captureName;
+    }
+
+    const AZStd::vector<AZStd::string>& ProfilingCaptureStreamReader::GetPassNames() const
+    {
+        return m_passNames;
+    }
+
+    const AZStd::vector<ProfilingCaptureStreamReader::Frame>& ProfilingCaptureStreamReader::GetFrames() const
+    {
+        return m_frames;
+    }
+
+    bool ProfilingCaptureStreamReader::Fail(AZStd::string error)
+    {
+        m_error = AZStd::move(error);
+        m_frames.clear();
+        m_passNames.clear();
+        return false;
+    }
+} // namespace AtomSampleViewer
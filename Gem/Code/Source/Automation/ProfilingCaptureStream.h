@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Binary layout of a profiling capture stream. A stream holds the pass timestamps and CPU frame time of every captured frame
+    //! in a single file, instead of writing two JSON files per frame.
+    //!
+    //! The file starts with a FileHeader, followed by a sequence of chunks. Each chunk begins with a ChunkHeader and its payload
+    //! is padded to 8 bytes, so every record in the file is naturally aligned and the whole file can be memory mapped and read in place.
+    //! Pass names are stored once in PassNames chunks, and frames refer to passes by index. A stream that was closed
+    //! properly ends with an End chunk; a stream without one (for example after a crash) can still be read up to the last complete chunk.
+    namespace ProfilingCaptureStream
+    {
+        static constexpr char Magic[8] = { 'A', 'S', 'V', 'P', 'C', 'A', 'P', '\0' };
+        static constexpr uint32_t Version = 1;
+        static constexpr size_t MaxCaptureNameLength = 64;
+        static constexpr size_t ChunkAlignment = 8;
+
+        enum class ChunkType : uint32_t
+        {
+            PassNames = 1,  //!< PassNamesHeader followed by m_count entries of [uint32_t length, chars]
+            Frame = 2,      //!< FrameRecord followed by m_passCount PassTimestampRecords
+            End = 3         //!< EndRecord
+        };
+
+        //! Schema header. The record sizes let readers reject files written with a different layout.
+        struct FileHeader
+        {
+            char m_magic[8] = {};
+            uint32_t m_version = Version;
+            uint32_t m_headerSize = 0;
+            uint32_t m_frameRecordSize = 0;
+            uint32_t m_passTimestampRecordSize = 0;
+            char m_captureName[MaxCaptureNameLength] = {};
+        };
+
+        struct ChunkHeader
+        {
+            ChunkType m_type = ChunkType::End;
+            uint32_t m_payloadSize = 0; //!< Size of the payload that follows, including padding
+        };
+
+        struct PassNamesHeader
+        {
+            uint32_t m_firstIndex = 0;
+            uint32_t m_count = 0;
+        };
+
+        struct FrameRecord
+        {
+            uint64_t m_frameNumber = 0;
+            double m_cpuFrameTime = 0.0;  //!< Same value and unit as the "frameTime" field of CaptureCpuFrameTime's JSON output
+            uint32_t m_passCount = 0;
+            uint32_t m_reserved = 0;
+        };
+
+        struct PassTimestampRecord
+        {
+            uint32_t m_passIndex = 0;
+            uint32_t m_reserved = 0;
+            uint64_t m_durationInNanoseconds = 0;
+        };
+
+        struct EndRecord
+        {
+            uint64_t m_frameCount = 0;
+            uint64_t m_passNameCount = 0;
+        };
+
+        static_assert(sizeof(FileHeader) % ChunkAlignment == 0, "Chunks must start on an aligned offset");
+        static_assert(sizeof(ChunkHeader) % ChunkAlignment == 0, "Chunk payloads must start on an aligned offset");
+        static_assert(sizeof(FrameRecord) % ChunkAlignment == 0, "Pass timestamp records must start on an aligned offset");
+    } // namespace ProfilingCaptureStream
+
+    //! Appends frames to a profiling capture stream file. Data is buffered in memory and written in large blocks,
+    //! so a capture costs a single file open, a few writes and one flush when the stream is closed.
+    class ProfilingCaptureStreamWriter
+    {
+    public:
+        struct PassTimestamp
+        {
+            AZStd::string_view m_passName;
+            uint64_t m_durationInNanoseconds = 0;
+        };
+
+        ~ProfilingCaptureStreamWriter();
+
+        //! Creates the file (and any missing folders) and writes the header. Returns false if the file can't be created.
+        bool Open(const AZStd::string& filePath, AZStd::string_view captureName);
+
+        //! Appends one frame. Passes that weren't seen in earlier frames are added to the pass name table first.
+        void AddFrame(uint64_t frameNumber, double cpuFrameTime, AZStd::span<const PassTimestamp> passTimestamps);
+
+        //! Writes the End chunk, flushes and closes the file. Returns false if any write failed.
+        bool Close();
+
+        bool IsOpen() const;
+        const AZStd::string& GetFilePath() const;
+        uint64_t GetFrameCount() const;
+
+    private:
+        template<typename T>
+        void AppendRecord(const T& record);
+        void AppendChunkHeader(ProfilingCaptureStream::ChunkType type, size_t payloadSize);
+        void AppendPadding();
+        void FlushBuffer();
+
+        static constexpr size_t FlushThreshold = 256 * 1024;
+
+        AZ::IO::SystemFile m_file;
+        AZStd::string m_filePath;
+        AZStd::vector<uint8_t> m_buffer;
+        AZStd::vector<AZStd::string> m_passNames;
+        AZStd::unordered_map<AZStd::string, uint32_t> m_passIndices;
+        AZStd::vector<uint32_t> m_frameIndices; //!< Pass indices of the previous frame, which usually match the next frame
+        size_t m_writtenPassNameCount = 0;
+        uint64_t m_frameCount = 0;
+        bool m_writeFailed = false;
+    };
+
+    //! Fixed capacity ring buffer of profiling frames. All storage is allocated up front, so recording a frame is a copy into
+    //! preallocated memory, without allocations or file access while the workload is being measured. Once recording is done,
+    //! the frames are written to a stream in one go.
+    class ProfilingCaptureFrameRing
+    {
+    public:
+        //! Allocates storage for frameCapacity frames with up to passCapacity passes each, and discards any recorded frames.
+        void Reset(size_t frameCapacity, size_t passCapacity);
+
+        //! Records a frame, overwriting the oldest one if the ring is full. Passes beyond the pass capacity are dropped.
+        void PushFrame(uint64_t frameNumber, double cpuFrameTime, AZStd::span<const ProfilingCaptureStreamWriter::PassTimestamp> passTimestamps);
+
+        //! Appends the recorded frames to the writer, from oldest to newest.
+        void WriteTo(ProfilingCaptureStreamWriter& writer) const;
+
+        size_t GetFrameCount() const;
+        size_t GetFrameCapacity() const;
+
+        //! Returns the number of pass timestamps that were dropped because a frame had more passes than the pass capacity.
+        uint64_t GetDroppedPassCount() const;
+
+    private:
+        struct FrameSlot
+        {
+            uint64_t m_frameNumber = 0;
+            double m_cpuFrameTime = 0.0;
+            uint32_t m_passCount = 0;
+        };
+
+        struct PassSlot
+        {
+            uint32_t m_passIndex = 0;
+            uint64_t m_durationInNanoseconds = 0;
+        };
+
+        uint32_t FindOrAddPassName(AZStd::string_view passName, size_t passPosition);
+
+        AZStd::vector<FrameSlot> m_frames;
+        AZStd::vector<PassSlot> m_passes; //!< m_passCapacity slots per frame
+        size_t m_passCapacity = 0;
+        size_t m_nextFrame = 0;
+        size_t m_frameCount = 0;
+        uint64_t m_droppedPassCount = 0;
+
+        AZStd::vector<AZStd::string> m_passNames;
+        AZStd::unordered_map<AZStd::string, uint32_t> m_passIndices;
+        AZStd::vector<uint32_t> m_previousPassIndices; //!< Pass indices of the previous frame, which usually match the next frame
+    };
+
+    //! Reads a profiling capture stream file written by ProfilingCaptureStreamWriter.
+    class ProfilingCaptureStreamReader
+    {
+    public:
+        struct Frame
+        {
+            uint64_t m_frameNumber = 0;
+            double m_cpuFrameTime = 0.0;
+            AZStd::span<const ProfilingCaptureStream::PassTimestampRecord> m_passTimestamps;
+        };
+
+        //! Reads and validates the whole file. Returns false and sets the error message if the file can't be used.
+        bool Load(const AZStd::string& filePath);
+
+        //! Same as Load(), for data that is already in memory. The reader takes ownership of the data.
+        bool Parse(AZStd::vector<uint8_t>&& data);
+
+        const AZStd::string& GetError() const;
+
+        //! Returns false if the stream didn't end with an End chunk, in which case only the complete frames are available.
+        bool IsComplete() const;
+
+        AZStd::string_view GetCaptureName() const;
+        const AZStd::vector<AZStd::string>& GetPassNames() const;
+        const AZStd::vector<Frame>& GetFrames() const;
+
+    private:
+        bool Fail(AZStd::string error);
+
+        AZStd::vector<uint8_t> m_data;
+        AZStd::string m_error;
+        AZStd::string m_captureName;
+        AZStd::vector<AZStd::string> m_passNames;
+        AZStd::vector<Frame> m_frames;
+        bool m_isComplete = false;
+    };
+} // namespace AtomSampleViewer
@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Automation/ScreenshotComparisonEngine.h>
+#include <Utils/ParallelForChunks.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace AtomSampleViewer
+{
+    namespace ImageDiff
+    {
+        // Largest possible per-pixel contribution, (255 * 255).
+        static constexpr uint32_t MaxSquaredDiff = 65025;
+
+        // Images with fewer rows than this are scored on a single thread.
+        static constexpr uint32_t RowsPerBand = 128;
+        static_assert(RowsPerBand % TileSize == 0, "Bands must start at the top of a row of tiles");
+        static_assert(TileSize % PerceptualWindowSize == 0, "Perceptual windows must not straddle tiles");
+
+        void Accumulator::Merge(const Accumulator& other)
+        {
+            m_sumSquares += other.m_sumSquares;
+            m_filteredSumSquares += other.m_filteredSumSquares;
+            m_pixelCount += other.m_pixelCount;
+            m_dissimilaritySum += other.m_dissimilaritySum;
+            m_windowCount += other.m_windowCount;
+            m_tileCount += other.m_tileCount;
+            m_differingTileCount += other.m_differingTileCount;
+        }
+
+        Scores Accumulator::Resolve() const
+        {
+            Scores scores;
+            if (m_pixelCount > 0)
+            {
+                const double normalization = double(MaxSquaredDiff) * double(m_pixelCount);
+                scores.m_diffScore = aznumeric_cast<float>(sqrt(double(m_sumSquares) / normalization));
+                scores.m_filteredDiffScore = aznumeric_cast<float>(sqrt(double(m_filteredSumSquares) / normalization));
+            }
+            if (m_windowCount > 0)
+            {
+                scores.m_perceptualScore = aznumeric_cast<float>(m_dissimilaritySum / double(m_windowCount));
+            }
+            scores.m_tileCount = m_tileCount;
+            scores.m_differingTileCount = m_differingTileCount;
+            return scores;
+        }
+
+        uint32_t CalcMinPerceptibleDiff(float minDiffFilter)
+        {
+            // Evaluate the filter exactly the way the float comparison in CalcImageDiffRms does, so the integer kernels agree with it.
+            uint32_t diff = 0;
+            while (diff <= 255 && !(diff / 255.0f > minDiffFilter))
+            {
+                ++diff;
+            }
+            return diff;
+        }
+
+        void AccumulateRowScalar(const uint8_t* rowA, const uint8_t* rowB, size_t pixelCount, uint32_t minPerceptibleDiff, Accumulator& accumulator)
+        {
+            uint64_t sumSquares = 0;
+            uint64_t filteredSumSquares = 0;
+
+            for (size_t i = 0; i < pixelCount * BytesPerPixel; i += BytesPerPixel)
+            {
+                uint32_t maxDiff = 0;
+                for (size_t channel = 0; channel < BytesPerPixel; ++channel)
+                {
+                    const int32_t diff = aznumeric_cast<int32_t>(rowA[i + channel]) - aznumeric_cast<int32_t>(rowB[i + channel]);
+                    maxDiff = AZ::GetMax(maxDiff, aznumeric_cast<uint32_t>(diff < 0 ? -diff : diff));
+                }
+
+                const uint32_t squared = maxDiff * maxDiff;
+                sumSquares += squared;
+                if (maxDiff >= minPerceptibleDiff)
+                {
+                    filteredSumSquares += squared;
+                }
+            }
+
+            accumulator.m_sumSquares += sumSquares;
+            accumulator.m_filteredSumSquares += filteredSumSquares;
+            accumulator.m_pixelCount += pixelCount;
+        }
+
+        void AccumulateRow(const uint8_t* rowA, const uint8_t* rowB, size_t pixelCount, uint32_t minPerceptibleDiff, Accumulator& accumulator)
+        {
+            size_t pixel = 0;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE || AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            // Each iteration processes 4 pixels, one per 32-bit lane. A lane gains at most MaxSquaredDiff per iteration,
+            // so the 32-bit lane sums are flushed to the 64-bit accumulator before they can overflow.
+            static constexpr size_t PixelsPerIteration = 4;
+            static constexpr size_t IterationsPerFlush = 0xFFFFFFFFu / MaxSquaredDiff;
+
+            alignas(16) uint32_t laneSums[PixelsPerIteration];
+            alignas(16) uint32_t laneFilteredSums[PixelsPerIteration];
+
+            while (pixel + PixelsPerIteration <= pixelCount)
+            {
+                const size_t iterations = AZ::GetMin((pixelCount - pixel) / PixelsPerIteration, IterationsPerFlush);
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+                const __m128i lowByteMask = _mm_set1_epi32(0xFF);
+                // Values never exceed 256, so a signed compare against (min - 1) is the same as diff >= min.
+                const __m128i filterThreshold = _mm_set1_epi32(aznumeric_cast<int32_t>(minPerceptibleDiff) - 1);
+                __m128i sums = _mm_setzero_si128();
+                __m128i filteredSums = _mm_setzero_si128();
+
+                for (size_t i = 0; i < iterations; ++i, pixel += PixelsPerIteration)
+                {
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowA + pixel * BytesPerPixel));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowB + pixel * BytesPerPixel));
+
+                    // Absolute difference of every channel
+                    const __m128i diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+
+                    // Reduce the 4 channels of each pixel to the max, ending up in the low byte of each 32-bit lane
+                    __m128i maxDiff = _mm_max_epu8(diff, _mm_srli_epi32(diff, 8));
+                    maxDiff = _mm_max_epu8(maxDiff, _mm_srli_epi32(maxDiff, 16));
+                    maxDiff = _mm_and_si128(maxDiff, lowByteMask);
+
+                    // The upper 16 bits of each lane are zero, so madd gives maxDiff * maxDiff per lane
+                    const __m128i squared = _mm_madd_epi16(maxDiff, maxDiff);
+                    const __m128i perceptible = _mm_cmpgt_epi32(maxDiff, filterThreshold);
+
+                    sums = _mm_add_epi32(sums, squared);
+                    filteredSums = _mm_add_epi32(filteredSums, _mm_and_si128(squared, perceptible));
+                }
+
+                _mm_store_si128(reinterpret_cast<__m128i*>(laneSums), sums);
+                _mm_store_si128(reinterpret_cast<__m128i*>(laneFilteredSums), filteredSums);
+#else
+                const uint32x4_t lowByteMask = vdupq_n_u32(0xFF);
+                const uint32x4_t filterThreshold = vdupq_n_u32(minPerceptibleDiff);
+                uint32x4_t sums = vdupq_n_u32(0);
+                uint32x4_t filteredSums = vdupq_n_u32(0);
+
+                for (size_t i = 0; i < iterations; ++i, pixel += PixelsPerIteration)
+                {
+                    const uint8x16_t a = vld1q_u8(rowA + pixel * BytesPerPixel);
+                    const uint8x16_t b = vld1q_u8(rowB + pixel * BytesPerPixel);
+
+                    const uint32x4_t diff = vreinterpretq_u32_u8(vabdq_u8(a, b));
+
+                    uint8x16_t maxDiffBytes = vmaxq_u8(vreinterpretq_u8_u32(diff), vreinterpretq_u8_u32(vshrq_n_u32(diff, 8)));
+                    maxDiffBytes = vmaxq_u8(maxDiffBytes, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(maxDiffBytes), 16)));
+                    const uint32x4_t maxDiff = vandq_u32(vreinterpretq_u32_u8(maxDiffBytes), lowByteMask);
+
+                    const uint32x4_t squared = vmulq_u32(maxDiff, maxDiff);
+                    const uint32x4_t perceptible = vcgeq_u32(maxDiff, filterThreshold);
+
+                    sums = vaddq_u32(sums, squared);
+                    filteredSums = vaddq_u32(filteredSums, vandq_u32(squared, perceptible));
+                }
+
+                vst1q_u32(laneSums, sums);
+                vst1q_u32(laneFilteredSums, filteredSums);
+#endif
+
+                for (size_t lane = 0; lane < PixelsPerIteration; ++lane)
+                {
+                    accumulator.m_sumSquares += laneSums[lane];
+                    accumulator.m_filteredSumSquares += laneFilteredSums[lane];
+                }
+                accumulator.m_pixelCount += iterations * PixelsPerIteration;
+            }
+#endif
+
+            if (pixel < pixelCount)
+            {
+                AccumulateRowScalar(rowA + pixel * BytesPerPixel, rowB + pixel * BytesPerPixel, pixelCount - pixel, minPerceptibleDiff, accumulator);
+            }
+        }
+
+        void CalcMaxChannelDiffs(const uint8_t* pixelsA, const uint8_t* pixelsB, size_t pixelCount, uint8_t* outMaxDiffs)
+        {
+            size_t pixel = 0;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE || AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+            // Each iteration reduces 4 registers of 4 pixels to one register of 16 max differences
+            static constexpr size_t PixelsPerIteration = 16;
+
+            for (; pixel + PixelsPerIteration <= pixelCount; pixel += PixelsPerIteration)
+            {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+                const __m128i lowByteMask = _mm_set1_epi32(0xFF);
+                __m128i maxDiffs[4];
+                for (size_t part = 0; part < 4; ++part)
+                {
+                    const size_t offset = (pixel + part * 4) * BytesPerPixel;
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelsA + offset));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixelsB + offset));
+                    const __m128i diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+                    __m128i maxDiff = _mm_max_epu8(diff, _mm_srli_epi32(diff, 8));
+                    maxDiff = _mm_max_epu8(maxDiff, _mm_srli_epi32(maxDiff, 16));
+                    maxDiffs[part] = _mm_and_si128(maxDiff, lowByteMask);
+                }
+
+                // Values fit in a byte, so the saturating packs don't change them
+                const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(maxDiffs[0], maxDiffs[1]), _mm_packs_epi32(maxDiffs[2], maxDiffs[3]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(outMaxDiffs + pixel), packed);
+#else
+                uint16x4_t maxDiffs[4];
+                for (size_t part = 0; part < 4; ++part)
+                {
+                    const size_t offset = (pixel + part * 4) * BytesPerPixel;
+                    const uint32x4_t diff = vreinterpretq_u32_u8(vabdq_u8(vld1q_u8(pixelsA + offset), vld1q_u8(pixelsB + offset)));
+                    uint8x16_t maxDiffBytes = vmaxq_u8(vreinterpretq_u8_u32(diff), vreinterpretq_u8_u32(vshrq_n_u32(diff, 8)));
+                    maxDiffBytes = vmaxq_u8(maxDiffBytes, vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(maxDiffBytes), 16)));
+                    maxDiffs[part] = vmovn_u32(vandq_u32(vreinterpretq_u32_u8(maxDiffBytes), vdupq_n_u32(0xFF)));
+                }
+
+                const uint8x16_t packed = vcombine_u8(
+                    vmovn_u16(vcombine_u16(maxDiffs[0], maxDiffs[1])), vmovn_u16(vcombine_u16(maxDiffs[2], maxDiffs[3])));
+                vst1q_u8(outMaxDiffs + pixel, packed);
+#endif
+            }
+#endif
+
+            for (; pixel < pixelCount; ++pixel)
+            {
+                uint32_t maxDiff = 0;
+                for (size_t channel = 0; channel < BytesPerPixel; ++channel)
+                {
+                    const int32_t diff = aznumeric_cast<int32_t>(pixelsA[pixel * BytesPerPixel + channel]) -
+                        aznumeric_cast<int32_t>(pixelsB[pixel * BytesPerPixel + channel]);
+                    maxDiff = AZ::GetMax(maxDiff, aznumeric_cast<uint32_t>(diff < 0 ? -diff : diff));
+                }
+                outMaxDiffs[pixel] = aznumeric_cast<uint8_t>(maxDiff);
+            }
+        }
+
+        double CalcWindowDissimilarity(const uint8_t* windowA, const uint8_t* windowB, size_t rowPitch, uint32_t width, uint32_t height)
+        {
+            // Standard SSIM stabilization constants for 8-bit values
+            static constexpr double C1 = (0.01 * 255.0) * (0.01 * 255.0);
+            static constexpr double C2 = (0.03 * 255.0) * (0.03 * 255.0);
+
+            auto luminance = [](const uint8_t* pixel)
+            {
+                return 0.2126 * pixel[0] + 0.7152 * pixel[1] + 0.0722 * pixel[2];
+            };
+
+            double sumA = 0.0;
+            double sumB = 0.0;
+            double sumSquaresA = 0.0;
+            double sumSquaresB = 0.0;
+            double sumProducts = 0.0;
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                const uint8_t* rowA = windowA + y * rowPitch;
+                const uint8_t* rowB = windowB + y * rowPitch;
+                for (uint32_t x = 0; x < width; ++x)
+                {
+                    const double a = luminance(rowA + x * BytesPerPixel);
+                    const double b = luminance(rowB + x * BytesPerPixel);
+                    sumA += a;
+                    sumB += b;
+                    sumSquaresA += a * a;
+                    sumSquaresB += b * b;
+                    sumProducts += a * b;
+                }
+            }
+
+            const double count = double(width) * height;
+            const double meanA = sumA / count;
+            const double meanB = sumB / count;
+            const double varianceA = AZ::GetMax(0.0, sumSquaresA / count - meanA * meanA);
+            const double varianceB = AZ::GetMax(0.0, sumSquaresB / count - meanB * meanB);
+            const double covariance = sumProducts / count - meanA * meanB;
+
+            const double ssim = ((2.0 * meanA * meanB + C1) * (2.0 * covariance + C2)) /
+                ((meanA * meanA + meanB * meanB + C1) * (varianceA + varianceB + C2));
+            return AZ::GetClamp((1.0 - ssim) * 0.5, 0.0, 1.0);
+        }
+
+        static bool AreRowsEqual(const uint8_t* imageA, const uint8_t* imageB, size_t rowPitch, size_t rowSize, uint32_t rowCount)
+        {
+            for (uint32_t row = 0; row < rowCount; ++row)
+            {
+                if (memcmp(imageA + row * rowPitch, imageB + row * rowPitch, rowSize) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static void AccumulateTile(
+            const uint8_t* tileA, const uint8_t* tileB, size_t rowPitch, uint32_t tileWidth, uint32_t tileHeight,
+            uint32_t minPerceptibleDiff, bool calcPerceptualScore, Accumulator& accumulator)
+        {
+            const size_t tileRowSize = tileWidth * BytesPerPixel;
+            const uint64_t windowCount = uint64_t((tileWidth + PerceptualWindowSize - 1) / PerceptualWindowSize) *
+                ((tileHeight + PerceptualWindowSize - 1) / PerceptualWindowSize);
+
+            ++accumulator.m_tileCount;
+            accumulator.m_pixelCount += uint64_t(tileWidth) * tileHeight;
+            accumulator.m_windowCount += calcPerceptualScore ? windowCount : 0;
+
+            // Matching rows contribute nothing to the sums, so scoring starts at the first row that differs
+            uint32_t firstDifferingRow = 0;
+            while (firstDifferingRow < tileHeight &&
+                memcmp(tileA + firstDifferingRow * rowPitch, tileB + firstDifferingRow * rowPitch, tileRowSize) == 0)
+            {
+                ++firstDifferingRow;
+            }
+
+            if (firstDifferingRow == tileHeight)
+            {
+                return;
+            }
+
+            ++accumulator.m_differingTileCount;
+
+            // The pixel count was already added for the whole tile
+            Accumulator rows;
+            for (uint32_t row = firstDifferingRow; row < tileHeight; ++row)
+            {
+                AccumulateRow(tileA + row * rowPitch, tileB + row * rowPitch, tileWidth, minPerceptibleDiff, rows);
+            }
+            accumulator.m_sumSquares += rows.m_sumSquares;
+            accumulator.m_filteredSumSquares += rows.m_filteredSumSquares;
+
+            if (calcPerceptualScore)
+            {
+                for (uint32_t y = 0; y < tileHeight; y += PerceptualWindowSize)
+                {
+                    const uint32_t windowHeight = AZ::GetMin(PerceptualWindowSize, tileHeight - y);
+                    for (uint32_t x = 0; x < tileWidth; x += PerceptualWindowSize)
+                    {
+                        const uint32_t windowWidth = AZ::GetMin(PerceptualWindowSize, tileWidth - x);
+                        const uint8_t* windowA = tileA + y * rowPitch + x * BytesPerPixel;
+                        const uint8_t* windowB = tileB + y * rowPitch + x * BytesPerPixel;
+                        if (!AreRowsEqual(windowA, windowB, rowPitch, windowWidth * BytesPerPixel, windowHeight))
+                        {
+                            accumulator.m_dissimilaritySum += CalcWindowDissimilarity(windowA, windowB, rowPitch, windowWidth, windowHeight);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Scores every tile in a range of rows. firstRow must be a multiple of TileSize.
+        static void AccumulateRows(
+            const uint8_t* imageA, const uint8_t* imageB, uint32_t width, uint32_t firstRow, uint32_t rowCount,
+            uint32_t minPerceptibleDiff, bool calcPerceptualScore, Accumulator& accumulator)
+        {
+            const size_t rowPitch = width * BytesPerPixel;
+            for (uint32_t tileY = firstRow; tileY < firstRow + rowCount; tileY += TileSize)
+            {
+                const uint32_t tileHeight = AZ::GetMin(TileSize, firstRow + rowCount - tileY);
+                for (uint32_t tileX = 0; tileX < width; tileX += TileSize)
+                {
+                    const uint32_t tileWidth = AZ::GetMin(TileSize, width - tileX);
+                    const size_t offset = tileY * rowPitch + tileX * BytesPerPixel;
+                    AccumulateTile(imageA + offset, imageB + offset, rowPitch, tileWidth, tileHeight, minPerceptibleDiff, calcPerceptualScore, accumulator);
+                }
+            }
+        }
+
+        Scores CalcScores(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, uint32_t width, uint32_t height, float minDiffFilter,
+            bool calcPerceptualScore)
+        {
+            AZ_Assert(imageA.size() == imageB.size() && imageA.size() >= size_t(width) * height * BytesPerPixel, "Image buffers do not match the given size");
+
+            Accumulator accumulator;
+            AccumulateRows(imageA.data(), imageB.data(), width, 0, height, CalcMinPerceptibleDiff(minDiffFilter), calcPerceptualScore, accumulator);
+            return accumulator.Resolve();
+        }
+
+        // Same as CalcScores(), but splits the image into bands of rows that are scored on the job system.
+        static Scores CalcScoresParallel(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, uint32_t width, uint32_t height, float minDiffFilter,
+            bool calcPerceptualScore)
+        {
+            const size_t bandCount = Utils::GetChunkCount(height, RowsPerBand);
+            if (bandCount <= 1)
+            {
+                return CalcScores(imageA, imageB, width, height, minDiffFilter, calcPerceptualScore);
+            }
+
+            const uint32_t minPerceptibleDiff = CalcMinPerceptibleDiff(minDiffFilter);
+            AZStd::vector<Accumulator> bandAccumulators(bandCount);
+            Utils::ParallelForChunks(height, RowsPerBand, [&](size_t band, size_t firstRow, size_t rowCount)
+                {
+                    AccumulateRows(imageA.data(), imageB.data(), width, aznumeric_cast<uint32_t>(firstRow), aznumeric_cast<uint32_t>(rowCount),
+                        minPerceptibleDiff, calcPerceptualScore, bandAccumulators[band]);
+                });
+
+            Accumulator accumulator;
+            for (const Accumulator& bandAccumulator : bandAccumulators)
+            {
+                accumulator.Merge(bandAccumulator);
+            }
+            return accumulator.Resolve();
+        }
+    } // namespace ImageDiff
+
+    namespace
+    {
+        using Outcome = ScreenshotComparisonEngine::Outcome;
+
+        bool ValidateImages(const AZ::Utils::PngFile& image, const AZ::Utils::PngFile& baseline, Outcome& outcome)
+        {
+            if (!image.IsValid() || !baseline.IsValid())
+            {
+                outcome.m_status = Outcome::Status::FileNotLoaded;
+            }
+            else if (image.GetBufferFormat() != AZ::Utils::PngFile::Format::RGBA || baseline.GetBufferFormat() != AZ::Utils::PngFile::Format::RGBA)
+            {
+                outcome.m_status = Outcome::Status::WrongFormat;
+            }
+            else if (image.GetWidth() != baseline.GetWidth() || image.GetHeight() != baseline.GetHeight())
+            {
+                outcome.m_status = Outcome::Status::WrongSize;
+            }
+            else
+            {
+                return true;
+            }
+
+            return false;
+        }
+    }
+
+    ScreenshotComparisonEngine::~ScreenshotComparisonEngine()
+    {
+        // In-flight jobs hold their own reference to the comparison data, but waiting keeps shutdown deterministic.
+        WaitForAll();
+    }
+
+    ScreenshotComparisonEngine::Outcome ScreenshotComparisonEngine::Compare(
+        const AZ::Utils::PngFile& image, const AZ::Utils::PngFile& baseline, float minDiffFilter, bool calcPerceptualScore)
+    {
+        Outcome outcome;
+        if (ValidateImages(image, baseline, outcome))
+        {
+            outcome.m_status = Outcome::Status::Success;
+            outcome.m_scores = ImageDiff::CalcScores(
+                image.GetBuffer(), baseline.GetBuffer(), image.GetWidth(), image.GetHeight(), minDiffFilter, calcPerceptualScore);
+        }
+        return outcome;
+    }
+
+    ScreenshotComparisonEngine::Result ScreenshotComparisonEngine::Compare(const Request& request)
+    {
+        using AZ::Utils::PngFile;
+
+        Result result;
+        const PngFile screenshot = PngFile::Load(request.m_screenshotFilePath.c_str());
+
+        if (!request.m_officialBaselineFilePath.empty())
+        {
+            result.m_official = Compare(screenshot, PngFile::Load(request.m_officialBaselineFilePath.c_str()), request.m_minDiffFilter, request.m_calcPerceptualScore);
+        }
+
+        if (!request.m_localBaselineFilePath.empty())
+        {
+            result.m_local = Compare(screenshot, PngFile::Load(request.m_localBaselineFilePath.c_str()), request.m_minDiffFilter, request.m_calcPerceptualScore);
+        }
+
+        return result;
+    }
+
+    void ScreenshotComparisonEngine::Execute(PendingComparison& comparison)
+    {
+        using AZ::Utils::PngFile;
+
+        const Request& request = comparison.m_request;
+
+        // Decode the screenshot and both baselines in parallel. The screenshot is only decoded once and shared by both comparisons.
+        PngFile screenshot;
+        PngFile officialBaseline;
+        PngFile localBaseline;
+
+        AZStd::fixed_vector<AZStd::pair<const AZStd::string*, PngFile*>, 3> decodes;
+        decodes.push_back({ &request.m_screenshotFilePath, &screenshot });
+        if (!request.m_officialBaselineFilePath.empty())
+        {
+            decodes.push_back({ &request.m_officialBaselineFilePath, &officialBaseline });
+        }
+        if (!request.m_localBaselineFilePath.empty())
+        {
+            decodes.push_back({ &request.m_localBaselineFilePath, &localBaseline });
+        }
+
+        AZ::JobCompletion decodeCompletion;
+        for (auto& [filePath, image] : decodes)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([filePath = filePath, image = image]()
+                {
+                    *image = PngFile::Load(filePath->c_str());
+                }, true);
+            job->SetDependent(&decodeCompletion);
+            job->Start();
+        }
+        decodeCompletion.StartAndWaitForCompletion();
+
+        auto compareParallel = [&screenshot, &request](const PngFile& baseline, Outcome& outcome)
+        {
+            if (ValidateImages(screenshot, baseline, outcome))
+            {
+                outcome.m_status = Outcome::Status::Success;
+                outcome.m_scores = ImageDiff::CalcScoresParallel(
+                    screenshot.GetBuffer(), baseline.GetBuffer(), screenshot.GetWidth(), screenshot.GetHeight(), request.m_minDiffFilter,
+                    request.m_calcPerceptualScore);
+            }
+        };
+
+        if (!request.m_officialBaselineFilePath.empty())
+        {
+            compareParallel(officialBaseline, comparison.m_result.m_official);
+        }
+
+        if (!request.m_localBaselineFilePath.empty())
+        {
+            compareParallel(localBaseline, comparison.m_result.m_local);
+        }
+    }
+
+    ScreenshotComparisonEngine::Ticket ScreenshotComparisonEngine::Submit(Request request)
+    {
+        const Ticket ticket = m_nextTicket++;
+        if (m_nextTicket == InvalidTicket)
+        {
+            ++m_nextTicket;
+        }
+
+        auto comparison = AZStd::make_shared<PendingComparison>();
+        comparison->m_request = AZStd::move(request);
+        m_pending[ticket] = comparison;
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_inFlightMutex);
+            ++m_inFlightCount;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction([this, comparison]()
+            {
+                Execute(*comparison);
+                comparison->m_isDone = true;
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_inFlightMutex);
+                --m_inFlightCount;
+                m_inFlightCondition.notify_all();
+            }, true);
+        job->Start();
+
+        return ticket;
+    }
+
+    bool ScreenshotComparisonEngine::TryTakeResult(Ticket ticket, Result& outResult)
+    {
+        auto iter = m_pending.find(ticket);
+        if (iter == m_pending.end())
+        {
+            AZ_Assert(false, "Unknown screenshot comparison ticket %u", ticket);
+            return false;
+        }
+
+        if (!iter->second->m_isDone)
+        {
+            return false;
+        }
+
+        outResult = AZStd::move(iter->second->m_result);
+        m_pending.erase(iter);
+        return true;
+    }
+
+    size_t ScreenshotComparisonEngine::GetPendingCount() const
+    {
+        return m_pending.size();
+    }
+
+    void ScreenshotComparisonEngine::WaitForAll()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_inFlightMutex);
+        m_inFlightCondition.wait(lock, [this]() { return m_inFlightCount == 0; });
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Utils/PngFile.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Low level kernels for scoring the difference between two RGBA8 images.
+    //! The scores match AZ::Utils::CalcImageDiffRms: each pixel contributes the square of its largest channel difference
+    //! (normalized to 0-1), and the final score is the root of the mean over all pixels.
+    //! Images are scored in tiles of TileSize x TileSize pixels. Tiles that match exactly are skipped after a memcmp of
+    //! their rows, so identical screenshots, the common case, only cost a pass over the memory.
+    namespace ImageDiff
+    {
+        static constexpr size_t BytesPerPixel = 4;
+        static constexpr uint32_t TileSize = 32;
+
+        //! Size of the square windows the perceptual score is computed over. TileSize is a multiple of this.
+        static constexpr uint32_t PerceptualWindowSize = 8;
+
+        struct Scores
+        {
+            float m_diffScore = 0.0f;         //!< RMS of the max channel difference over all pixels
+            float m_filteredDiffScore = 0.0f; //!< Same as m_diffScore, but pixels with imperceptible differences contribute zero
+            float m_perceptualScore = 0.0f;   //!< Mean structural dissimilarity (1 - SSIM) / 2 of the luminance, 0-1. Only computed on request.
+            uint32_t m_tileCount = 0;
+            uint32_t m_differingTileCount = 0;
+        };
+
+        //! Integer sums that can be accumulated per row (or per band of rows) and merged later.
+        struct Accumulator
+        {
+            uint64_t m_sumSquares = 0;
+            uint64_t m_filteredSumSquares = 0;
+            uint64_t m_pixelCount = 0;
+            double m_dissimilaritySum = 0.0;  //!< Sum of the dissimilarity of each perceptual window. Matching windows add zero.
+            uint64_t m_windowCount = 0;
+            uint32_t m_tileCount = 0;
+            uint32_t m_differingTileCount = 0;
+
+            void Merge(const Accumulator& other);
+            Scores Resolve() const;
+        };
+
+        //! Returns the smallest max-channel difference (0-255) that is considered perceptible for the given filter.
+        //! Pixels whose difference is lower than this are excluded from the filtered score. May return 256 if nothing passes the filter.
+        uint32_t CalcMinPerceptibleDiff(float minDiffFilter);
+
+        //! Accumulates the difference between two rows of tightly packed RGBA8 pixels.
+        //! Uses SSE2 or NEON where available and falls back to AccumulateRowScalar() otherwise.
+        void AccumulateRow(const uint8_t* rowA, const uint8_t* rowB, size_t pixelCount, uint32_t minPerceptibleDiff, Accumulator& accumulator);
+
+        //! Reference implementation of AccumulateRow(), used for tails and for validating the vectorized kernels.
+        void AccumulateRowScalar(const uint8_t* rowA, const uint8_t* rowB, size_t pixelCount, uint32_t minPerceptibleDiff, Accumulator& accumulator);
+
+        //! Writes the largest channel difference of each pixel to outMaxDiffs. Uses SSE2 or NEON where available.
+        void CalcMaxChannelDiffs(const uint8_t* pixelsA, const uint8_t* pixelsB, size_t pixelCount, uint8_t* outMaxDiffs);
+
+        //! Returns the structural dissimilarity (1 - SSIM) / 2 of the luminance of a window of pixels, 0 when they match.
+        //! rowPitch is in bytes.
+        double CalcWindowDissimilarity(const uint8_t* windowA, const uint8_t* windowB, size_t rowPitch, uint32_t width, uint32_t height);
+
+        //! Scores two RGBA8 images of the same size on the calling thread.
+        //! The perceptual score is only computed when calcPerceptualScore is true, since it's much more expensive.
+        Scores CalcScores(AZStd::span<const uint8_t> imageA, AZStd::span<const uint8_t> imageB, uint32_t width, uint32_t height, float minDiffFilter,
+            bool calcPerceptualScore = false);
+    } // namespace ImageDiff
+
+    //! Compares captured screenshots against their baseline images on the job system.
+    //! Each request decodes the screenshot once and reuses it for every baseline, the PNG files are decoded in parallel,
+    //! and large images are scored in parallel bands of rows. Results are polled from the main thread, so the caller can
+    //! keep ticking while comparisons are in flight.
+    class ScreenshotComparisonEngine
+    {
+    public:
+        using Ticket = uint32_t;
+        static constexpr Ticket InvalidTicket = 0;
+
+        struct Outcome
+        {
+            enum class Status
+            {
+                NotRequested,
+                Success,
+                FileNotLoaded,
+                WrongSize,
+                WrongFormat
+            };
+
+            Status m_status = Status::NotRequested;
+            ImageDiff::Scores m_scores;
+        };
+
+        struct Request
+        {
+            AZStd::string m_screenshotFilePath;
+            AZStd::string m_officialBaselineFilePath; //!< Leave empty to skip the official baseline comparison
+            AZStd::string m_localBaselineFilePath;    //!< Leave empty to skip the local baseline comparison
+            float m_minDiffFilter = 0.0f;
+            bool m_calcPerceptualScore = false;
+        };
+
+        struct Result
+        {
+            Outcome m_official;
+            Outcome m_local;
+        };
+
+        ~ScreenshotComparisonEngine();
+
+        //! Starts comparing the screenshot against its baselines. The returned ticket is used to collect the result.
+        Ticket Submit(Request request);
+
+        //! Returns true if the comparison for the ticket has finished, and moves its result into outResult.
+        //! The ticket is no longer valid after this returns true.
+        bool TryTakeResult(Ticket ticket, Result& outResult);
+
+        //! Returns the number of submitted comparisons whose result has not been taken yet.
+        size_t GetPendingCount() const;
+
+        //! Blocks until every submitted comparison has finished. Results remain available through TryTakeResult().
+        void WaitForAll();
+
+        //! Compares the screenshot against its baselines on the calling thread.
+        static Result Compare(const Request& request);
+
+        //! Compares two decoded images on the calling thread.
+        static Outcome Compare(const AZ::Utils::PngFile& image, const AZ::Utils::PngFile& baseline, float minDiffFilter, bool calcPerceptualScore = false);
+
+    private:
+        struct PendingComparison
+        {
+            Request m_request;
+            Result m_result;
+            AZStd::atomic_bool m_isDone{false};
+        };
+
+        static void Execute(PendingComparison& comparison);
+
+        AZStd::unordered_map<Ticket, AZStd::shared_ptr<PendingComparison>> m_pending;
+        Ticket m_nextTicket = InvalidTicket + 1;
+
+        mutable AZStd::mutex m_inFlightMutex;
+        AZStd::condition_variable m_inFlightCondition;
+        size_t m_inFlightCount = 0;
+    };
+} // namespace AtomSampleViewer
@@ -19,6 +19,10 @@
 #include <Atom/Feature/ImGui/SystemBus.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Settings/SettingsRegistryScriptUtils.h>
@@ -34,7 +38,12 @@
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
+#include <AssetLoadTestBus.h>
 #include <AtomSampleViewerRequestBus.h>
+#include <CullingAndLodExampleBus.h>
+#include <StreamingImageExampleBus.h>
+#include <EntityLatticeTestBus.h>
+#include <SkinnedMeshExampleBus.h>
 #include <Utils/Utils.h>
 
 namespace AtomSampleViewer
@@ -64,7 +73,7 @@ namespace AtomSampleViewer
         m_scriptBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return AzFramework::StringFunc::EndsWith(assetInfo.m_relativePath, ".bv.luac");
-        });
+        }, AssetCatalogIndex::Scope::ForExtension("luac"));
 
         m_scriptBrowser.Activate();
 
@@ -72,6 +81,7 @@ namespace AtomSampleViewer
         ScriptRunnerRequestBus::Handler::BusConnect();
 
         m_imageComparisonOptions.Activate();
+        m_incrementalTestCache.Activate();
     }
 
     void ScriptManager::Deactivate()
@@ -80,6 +90,7 @@ namespace AtomSampleViewer
         m_sriptBehaviorContext = nullptr;
         m_scriptBrowser.Deactivate();
         m_imageComparisonOptions.Deactivate();
+        m_incrementalTestCache.Deactivate();
         ScriptRunnerRequestBus::Handler::BusDisconnect();
         ScriptRepeaterRequestBus::Handler::BusDisconnect();
         AZ::Debug::CameraControllerNotificationBus::Handler::BusDisconnect();
@@ -303,12 +314,23 @@ namespace AtomSampleViewer
         ScriptableImGui::CheckAllActionsConsumed();
         ScriptableImGui::ClearActions();
 
+        // Record any screenshot comparisons that finished in the background.
+        m_scriptReporter.TickScreenshotChecks();
+
+        RecordProfilingCaptureFrame();
+
         // We delayed PopScript() until after the above CheckAllActionsConsumed(), so that any errors
         // reported by that function will be associated with the proper script.
         if (m_shouldPopScript)
         {
             m_scriptReporter.PopScript();
             m_shouldPopScript = false;
+
+            if (m_finishIncrementalScript)
+            {
+                m_incrementalTestCache.EndScript(m_scriptReporter);
+                m_finishIncrementalScript = false;
+            }
         }
 
         while (!m_scriptOperations.empty())
@@ -357,6 +379,17 @@ namespace AtomSampleViewer
                 }
             }
 
+            if (ShouldWaitForLatticeScalingSweep(deltaTime))
+            {
+                break;
+            }
+
+            if (ShouldWaitForScreenshotChecks())
+            {
+                // Keep ticking frames while the comparisons run on the job system
+                break;
+            }
+
             if (m_scriptIdleFrames > 0)
             {
                 m_scriptIdleFrames--;
@@ -390,12 +423,26 @@ namespace AtomSampleViewer
         {
             bool frameCapturePending = false;
             SampleComponentManagerRequestBus::BroadcastResult(frameCapturePending, &SampleComponentManagerRequests::IsFrameCapturePending);
-            if (!frameCapturePending && !m_isCapturePending)
+            // The sweep may have been the last operation of the script
+            if (!frameCapturePending && !m_isCapturePending && !m_scriptReporter.HasPendingScreenshotChecks() && !ShouldWaitForLatticeScalingSweep(deltaTime))
             {
+                if (m_profilingCaptureStream.IsOpen())
+                {
+                    AZ_Warning("Automation", false, "Profiling capture stream '%s' was not closed by the script.", m_profilingCaptureStream.GetFilePath().c_str());
+                    CloseProfilingCaptureStream();
+                }
+
+                if (m_profilingCaptureSeries.m_isActive)
+                {
+                    AZ_Warning("Automation", false, "Profiling capture series '%s' did not finish before the script ended.", m_profilingCaptureSeries.m_outputFilePath.c_str());
+                    FinishProfilingCaptureSeries();
+                }
+
                 AZ_Assert(m_scriptPaused == false, "Script manager is in an unexpected state.");
                 AZ_Assert(m_scriptIdleFrames == 0, "Script manager is in an unexpected state.");
                 AZ_Assert(m_scriptIdleSeconds <= 0.0f, "Script manager is in an unexpected state.");
                 AZ_Assert(m_waitForAssetTracker == false, "Script manager is in an unexpected state.");
+                AZ_Assert(m_waitForLatticeScalingSweep == false, "Script manager is in an unexpected state.");
                 AZ_Assert(!m_scriptReporter.HasActiveScript(), "Script manager is in an unexpected state.");
                 AZ_Assert(m_executingScripts.size() == 0, "Script manager is in an unexpected state");
 
@@ -416,9 +463,22 @@ namespace AtomSampleViewer
                 // In case scripts were aborted while ImGui was temporarily hidden, show it again.
                 SetShowImGui(true);
 
+                if (m_incrementalRun)
+                {
+                    m_incrementalTestCache.Save();
+                    m_incrementalRun = false;
+                }
+
                 m_scriptReporter.SortScriptReports();
                 m_scriptReporter.OpenReportDialog();
 
+                if (m_isShardedRun)
+                {
+                    // The other shards merge these results with theirs, whichever finishes last
+                    m_scriptReporter.ExportTestResults();
+                    m_isShardedRun = false;
+                }
+
                 m_shouldPopScript = false;
                 m_doFinalScriptCleanup = false;
 
@@ -438,7 +498,7 @@ namespace AtomSampleViewer
                             {
                                 ++failedTests;
 
-                                AZ_Printf("AtomSampleViewer", "Test failure %s: asserts %u, general errors %u, screenshot failures %u\n", testReport.m_scriptAssetPath.c_str(),
+                                AZ_Printf("AtomSampleViewer", "Test failure %s: asserts %u, general errors %u, screenshot failures %u\n", testReport.m_scriptAssetPath.GetCStr(),
                                     testReport.m_assertCount, testReport.m_generalErrorCount, testReport.m_screenshotErrorCount);
                             }
                         }
@@ -452,6 +512,40 @@ namespace AtomSampleViewer
         }
     }
 
+    bool ScriptManager::ShouldWaitForScreenshotChecks()
+    {
+        const size_t pendingCount = m_scriptReporter.GetPendingScreenshotCheckCount();
+        if (pendingCount == 0)
+        {
+            m_flushScreenshotChecks = false;
+            return false;
+        }
+
+        return !m_deferScreenshotChecks || m_flushScreenshotChecks || pendingCount >= MaxDeferredScreenshotChecks;
+    }
+
+    bool ScriptManager::ShouldWaitForLatticeScalingSweep(float deltaTime)
+    {
+        if (!m_waitForLatticeScalingSweep)
+        {
+            return false;
+        }
+
+        bool isSweepRunning = false;
+        EntityLatticeTestRequestBus::BroadcastResult(isSweepRunning, &EntityLatticeTestRequests::IsScalingSweepRunning);
+
+        m_latticeScalingSweepTimeout -= deltaTime;
+        if (isSweepRunning && m_latticeScalingSweepTimeout < 0)
+        {
+            AZ_Error("Automation", false, "Lattice scaling sweep timed out. Continuing...");
+            EntityLatticeTestRequestBus::Broadcast(&EntityLatticeTestRequests::StopScalingSweep);
+            isSweepRunning = false;
+        }
+
+        m_waitForLatticeScalingSweep = isSweepRunning;
+        return isSweepRunning;
+    }
+
     void ScriptManager::OpenScriptRunnerDialog()
     {
         m_showScriptRunnerDialog = true;
@@ -462,12 +556,24 @@ namespace AtomSampleViewer
         m_showPrecommitWizard = true;
     }
 
-    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed)
+    void ScriptManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, bool incrementalRun, int shardIndex, int shardCount,
+        const AZStd::string& shardRunId)
     {
         m_testSuiteRunConfig.m_automatedRunEnabled = true;
         m_testSuiteRunConfig.m_testSuitePath = suiteFilePath;
         m_testSuiteRunConfig.m_closeOnTestScriptFinish = exitOnTestEnd;
         m_testSuiteRunConfig.m_randomSeed = randomSeed;
+        m_incrementalRunSetting = incrementalRun;
+
+        if (shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+        {
+            AZ_Error("Automation", false, "Invalid test shard %d of %d, running the whole test suite instead.", shardIndex, shardCount);
+            shardIndex = 0;
+            shardCount = 1;
+        }
+        m_testSuiteRunConfig.m_shardIndex = shardIndex;
+        m_testSuiteRunConfig.m_shardCount = shardCount;
+        m_testSuiteRunConfig.m_shardRunId = shardRunId;
     }
 
     void ScriptManager::AbortScripts(const AZStd::string& reason)
@@ -480,6 +586,21 @@ namespace AtomSampleViewer
         m_scriptIdleFrames = 0;
         m_scriptIdleSeconds = 0.0f;
         m_waitForAssetTracker = false;
+        if (m_waitForLatticeScalingSweep)
+        {
+            EntityLatticeTestRequestBus::Broadcast(&EntityLatticeTestRequests::StopScalingSweep);
+            m_waitForLatticeScalingSweep = false;
+        }
+        m_flushScreenshotChecks = false;
+        m_scriptReporter.FlushScreenshotChecks();
+        m_incrementalTestCache.CancelScript();
+        m_incrementalScriptAssets.clear();
+        m_finishIncrementalScript = false;
+        CloseProfilingCaptureStream();
+        if (m_profilingCaptureSeries.m_isActive)
+        {
+            FinishProfilingCaptureSeries();
+        }
         while (m_scriptReporter.HasActiveScript())
         {
             m_scriptReporter.PopScript();
@@ -524,6 +645,12 @@ namespace AtomSampleViewer
             ImGui::Indent();
 
             ImGui::InputInt("Random Seed for Test Order Execution", &m_testSuiteRunConfig.m_randomSeed);
+            ImGui::Checkbox("Defer Screenshot Checks", &m_deferScreenshotChecksSetting);
+            ImGui::Checkbox("Incremental Run (skip unchanged scripts that passed)", &m_incrementalRunSetting);
+            if (ImGui::Button("Clear Incremental Test Cache"))
+            {
+                m_incrementalTestCache.Clear();
+            }
 
             m_imageComparisonOptions.DrawImGuiSettings();
             if (ImGui::Button("Reset"))
@@ -622,7 +749,8 @@ namespace AtomSampleViewer
     {
         ImGui::Separator();
         ImGui::TextWrapped("Here's what will take place...\n"
-                           "1) The standard '_fulltestsuite_' script will be run.\n"
+                           "1) The standard '_fulltestsuite_' script will be run. With 'Incremental Run', scripts that passed before "
+                           "are skipped unless any assets, shaders or images they use have changed.\n"
                            "2) You'll see a summary of the test results. If any tests failed the automatic checks, "
                            "you are strongly encouraged to address those issues first.\n"
                            "3) You will be guided through a series of visual screenshot validations. For each one, "
@@ -630,6 +758,8 @@ namespace AtomSampleViewer
                            "4) The final report will be generated. Copy and paste this into your PR description.");
         ImGui::Separator();
 
+        ImGui::Checkbox("Incremental Run", &m_incrementalRunSetting);
+
         if (ImGui::Button("Run Full Test Suite"))
         {
             PrepareAndExecuteScript(FullSuiteScriptFilepath);
@@ -666,7 +796,7 @@ namespace AtomSampleViewer
         ImGui::SameLine();
         if (ImGui::Button("Continue"))
         {
-            m_wizardSettings.ProcessScriptReports(m_scriptReporter.GetScriptReport());
+            m_wizardSettings.ProcessScriptReports(m_scriptReporter);
 
             if (!m_wizardSettings.m_reportsOrderedByThresholdToInspect.empty())
             {
@@ -681,15 +811,13 @@ namespace AtomSampleViewer
 
     void ScriptManager::ShowPrecomitWizardManualInspection()
     {
-        const AZStd::vector<ScriptReporter::ScriptReport>& scriptReports = m_scriptReporter.GetScriptReport();
-
         // Get the script report and screenshot test corresponding to the current index
         const ScriptReporter::ReportIndex currentIndex = m_wizardSettings.m_reportIterator->second;
-        const ScriptReporter::ScriptReport& scriptReport = scriptReports[currentIndex.first];
+        const ScriptReporter::ScriptReport& scriptReport = m_scriptReporter.LoadScriptReport(currentIndex.first);
         const ScriptReporter::ScreenshotTestInfo& screenshotTest = scriptReport.m_screenshotTests[currentIndex.second];
 
-        ImGui::Text("Script Name: %s", scriptReport.m_scriptAssetPath.c_str());
-        ImGui::Text("Screenshot Name: %s", screenshotTest.m_officialBaselineScreenshotFilePath.c_str());
+        ImGui::Text("Script Name: %s", scriptReport.m_scriptAssetPath.GetCStr());
+        ImGui::Text("Screenshot Name: %s", screenshotTest.m_officialBaselineScreenshotFilePath.GetCStr());
 
         ImGui::Separator();
         ImGui::Text("Diff Score: %f", screenshotTest.m_officialComparisonResult.m_diffScore);
@@ -724,7 +852,7 @@ namespace AtomSampleViewer
 
         if (ImGui::Button("View Diff"))
         {
-            if (!Utils::RunDiffTool(screenshotTest.m_officialBaselineScreenshotFilePath, screenshotTest.m_screenshotFilePath))
+            if (!Utils::RunDiffTool(AZStd::string(screenshotTest.m_officialBaselineScreenshotFilePath.GetStringView()), AZStd::string(screenshotTest.m_screenshotFilePath.GetStringView())))
             {
                 ImGui::OpenPopup("Cannot open diff tool");
             }
@@ -852,10 +980,10 @@ namespace AtomSampleViewer
         for (const auto& failedReport : m_wizardSettings.m_failedReports)
         {
             const ScriptReporter::ReportIndex& reportIndex = failedReport.second;
-            const ScriptReporter::ScriptReport& scriptReport = scriptReports[reportIndex.first];
+            const ScriptReporter::ScriptReport& scriptReport = m_scriptReporter.LoadScriptReport(reportIndex.first);
             const ScriptReporter::ScreenshotTestInfo& screenshotTest = scriptReport.m_screenshotTests[reportIndex.second];
             ImGui::Text(
-                "\t%s %s '%s' %f", scriptReport.m_scriptAssetPath.c_str(), screenshotTest.m_screenshotFilePath.c_str(),
+                "\t%s %s '%s' %f", scriptReport.m_scriptAssetPath.GetCStr(), screenshotTest.m_screenshotFilePath.GetCStr(),
                 screenshotTest.m_toleranceLevel.m_name.c_str(), screenshotTest.m_officialComparisonResult.m_diffScore);
         }
         // Present the information by printing highest differences first. See enum class ImageDifferenceLevel
@@ -866,10 +994,10 @@ namespace AtomSampleViewer
                 ImGui::Text("Screenshot interactive check '%s'", PrecommitWizardSettings::ManualInspectionDifferenceLevels[i]);
                 for (const auto& reportIndex : imageDifferenceSummary[i])
                 {
-                    const ScriptReporter::ScriptReport& scriptReport = scriptReports[reportIndex.first];
+                    const ScriptReporter::ScriptReport& scriptReport = m_scriptReporter.LoadScriptReport(reportIndex.first);
                     const ScriptReporter::ScreenshotTestInfo& screenshotTest = scriptReport.m_screenshotTests[reportIndex.second];
                     ImGui::Text(
-                        "\t%s %s '%s' %f", scriptReport.m_scriptAssetPath.c_str(), screenshotTest.m_screenshotFilePath.c_str(),
+                        "\t%s %s '%s' %f", scriptReport.m_scriptAssetPath.GetCStr(), screenshotTest.m_screenshotFilePath.GetCStr(),
                         screenshotTest.m_toleranceLevel.m_name.c_str(), screenshotTest.m_officialComparisonResult.m_diffScore);
                 }
             }
@@ -913,6 +1041,19 @@ namespace AtomSampleViewer
 
         // Setup the ScriptReporter to track and report the results
         m_scriptReporter.Reset();
+
+        // Only the automated test suite is split across processes, scripts run from the dialogs always run in full
+        m_isShardedRun = m_testSuiteRunConfig.m_automatedRunEnabled && m_testSuiteRunConfig.m_shardCount > 1 &&
+            scriptFilePath == m_testSuiteRunConfig.m_testSuitePath;
+        if (m_isShardedRun)
+        {
+            m_scriptReporter.SetTestShard(m_testSuiteRunConfig.m_shardIndex, m_testSuiteRunConfig.m_shardCount, m_testSuiteRunConfig.m_shardRunId);
+        }
+        else
+        {
+            m_scriptReporter.SetTestShard(0, 1);
+        }
+
         m_scriptReporter.SetAvailableToleranceLevels(m_imageComparisonOptions.GetAvailableToleranceLevels());
         if (m_imageComparisonOptions.IsLevelAdjusted())
         {
@@ -927,6 +1068,20 @@ namespace AtomSampleViewer
             m_scriptReporter.SetInvalidationMessage("");
         }
 
+        m_deferScreenshotChecks = m_deferScreenshotChecksSetting;
+        m_flushScreenshotChecks = false;
+
+        // Cached results are only comparable when the tolerance levels are the ones the scripts select
+        const bool toleranceOverridden = m_imageComparisonOptions.IsLevelAdjusted() || !m_imageComparisonOptions.IsScriptControlled();
+        AZ_Warning("Automation", !m_incrementalRunSetting || !toleranceOverridden, "Incremental run is disabled because the tolerance level has been changed, all scripts will run.");
+        m_incrementalRun = m_incrementalRunSetting && !toleranceOverridden;
+        m_finishIncrementalScript = false;
+        if (m_incrementalRun)
+        {
+            m_incrementalTestCache.Load(Script_GetRenderApiName(), IncrementalTestCache::GetBuildIdentity(),
+                ScriptReporter::GetShardFileName(IncrementalTestCache::CacheFileBaseName, ".bin", m_scriptReporter.GetTestShardIndex(), m_scriptReporter.GetTestShardCount()));
+        }
+
         AZ_Assert(m_executingScripts.empty(), "There should be no active scripts at this point");
 
         ExecuteScript(scriptFilePath);
@@ -951,15 +1106,47 @@ namespace AtomSampleViewer
             return;
         }
 
+        // Only the scripts run by the main script are cached, which for the test suite is each test
+        const bool isIncrementalScript = s_instance->m_incrementalRun && s_instance->m_executingScripts.size() == 1;
+        if (isIncrementalScript)
+        {
+            if (const auto* cachedReports = s_instance->m_incrementalTestCache.FindUpToDateReports(scriptFilePath))
+            {
+                s_instance->m_scriptOperations.push([scriptFilePath, cachedReports = *cachedReports]() mutable
+                    {
+                        AZ_Printf("Automation", "Skipping script '%s', it passed before and its inputs haven't changed.\n", scriptFilePath.c_str());
+                        for (IncrementalTestCache::CachedScriptReport& report : cachedReports)
+                        {
+                            GetInstance()->m_scriptReporter.AddCachedScriptReport(report.m_scriptAssetPath,
+                                report.m_generalWarningCount, report.m_screenshotWarningCount, AZStd::move(report.m_screenshotTests));
+                        }
+                    }
+                );
+                return;
+            }
+
+            s_instance->m_incrementalScriptAssets.clear();
+        }
+
+        if (s_instance->m_incrementalRun && s_instance->m_executingScripts.size() >= 1)
+        {
+            s_instance->m_incrementalScriptAssets.push_back(scriptAsset.GetId());
+        }
+
         if (s_instance->m_imageComparisonOptions.IsScriptControlled())
         {
             s_instance->m_imageComparisonOptions.SelectToleranceLevel(nullptr); // Clear the preset before each script to make sure the script is selecting it.
         }
 
         // Execute(script) will add commands to the m_scriptOperations. These should be considered part of their own test script, for reporting purposes.
-        s_instance->m_scriptOperations.push([scriptFilePath]()
+        s_instance->m_scriptOperations.push([scriptFilePath, isIncrementalScript]()
             {
-                GetInstance()->m_scriptReporter.PushScript(scriptFilePath);
+                ScriptManager* scriptManager = GetInstance();
+                if (isIncrementalScript)
+                {
+                    scriptManager->m_incrementalTestCache.BeginScript(scriptFilePath, scriptManager->m_scriptReporter.GetScriptReport().size());
+                }
+                scriptManager->m_scriptReporter.PushScript(scriptFilePath);
             }
         );
 
@@ -981,6 +1168,29 @@ namespace AtomSampleViewer
 
         s_instance->m_executingScripts.erase(scriptAsset.GetId());
 
+        // Any deferred screenshot checks have to finish before the script ends, so its report is complete when it's popped.
+        s_instance->m_scriptOperations.push([]()
+            {
+                GetInstance()->m_flushScreenshotChecks = true;
+            }
+        );
+
+        if (isIncrementalScript)
+        {
+            s_instance->m_scriptOperations.push([scriptAssets = AZStd::move(s_instance->m_incrementalScriptAssets)]()
+                {
+                    ScriptManager* scriptManager = GetInstance();
+                    for (const AZ::Data::AssetId& scriptAssetId : scriptAssets)
+                    {
+                        scriptManager->m_incrementalTestCache.RecordAsset(scriptAssetId);
+                    }
+                    scriptManager->m_incrementalTestCache.RecordLoadedAssets();
+                    scriptManager->m_finishIncrementalScript = true;
+                }
+            );
+            s_instance->m_incrementalScriptAssets = {};
+        }
+
         // Execute(script) will have added commands to the m_scriptOperations. When they finish, consider this test as completed, for reporting purposes.
         s_instance->m_scriptOperations.push([]()
             {
@@ -1084,6 +1294,8 @@ namespace AtomSampleViewer
         behaviorContext->Method("DegToRad", &Script_DegToRad);
         behaviorContext->Method("GetRenderApiName", &Script_GetRenderApiName);
         behaviorContext->Method("GetRandomTestSeed", &Script_GetRandomTestSeed);
+        behaviorContext->Method("GetTestShardIndex", &Script_GetTestShardIndex);
+        behaviorContext->Method("GetTestShardCount", &Script_GetTestShardCount);
 
         // Samples...
         behaviorContext->Method("OpenSample", &Script_OpenSample);
@@ -1100,6 +1312,8 @@ namespace AtomSampleViewer
         behaviorContext->Method("SelectImageComparisonToleranceLevel", &Script_SelectImageComparisonToleranceLevel);
         behaviorContext->Method("CaptureScreenshot", &Script_CaptureScreenshot);
         behaviorContext->Method("CaptureScreenshotWithImGui", &Script_CaptureScreenshotWithImGui);
+        behaviorContext->Method("SetDeferredScreenshotChecks", &Script_SetDeferredScreenshotChecks);
+        behaviorContext->Method("FlushScreenshotChecks", &Script_FlushScreenshotChecks);
         behaviorContext->Method("CaptureScreenshotWithPreview", &Script_CaptureScreenshotWithPreview);
         behaviorContext->Method("CapturePassAttachment", &Script_CapturePassAttachment);
 
@@ -1109,6 +1323,19 @@ namespace AtomSampleViewer
         behaviorContext->Method("CapturePassPipelineStatistics", &Script_CapturePassPipelineStatistics);
         behaviorContext->Method("CaptureCpuProfilingStatistics", &Script_CaptureCpuProfilingStatistics);
         behaviorContext->Method("CaptureBenchmarkMetadata", &Script_CaptureBenchmarkMetadata);
+        behaviorContext->Method("BeginProfilingCaptureStream", &Script_BeginProfilingCaptureStream);
+        behaviorContext->Method("EndProfilingCaptureStream", &Script_EndProfilingCaptureStream);
+        behaviorContext->Method("CapturePassTimestampSeries", &Script_CapturePassTimestampSeries);
+        behaviorContext->Method("CaptureCpuFrameTimeSeries", &Script_CaptureCpuFrameTimeSeries);
+        behaviorContext->Method("CaptureProfilingSeries", &Script_CaptureProfilingSeries);
+        behaviorContext->Method("RunLatticeScalingSweep", &Script_RunLatticeScalingSweep);
+        behaviorContext->Method("CaptureAssetSwitchStatistics", &Script_CaptureAssetSwitchStatistics);
+        behaviorContext->Method("CaptureSkinnedMeshStatistics", &Script_CaptureSkinnedMeshStatistics);
+        behaviorContext->Method("CaptureCullingStatistics", &Script_CaptureCullingStatistics);
+        behaviorContext->Method("CaptureSampleSwitchTimings", &Script_CaptureSampleSwitchTimings);
+        behaviorContext->Method("SetWarmSampleSwitch", &Script_SetWarmSampleSwitch);
+        behaviorContext->Method("RecordStreamingResidency", &Script_RecordStreamingResidency);
+        behaviorContext->Method("CaptureStreamingTelemetry", &Script_CaptureStreamingTelemetry);
 
         // Camera...
         behaviorContext->Method("ArcBallCameraController_SetCenter", &Script_ArcBallCameraController_SetCenter);
@@ -1177,6 +1404,9 @@ namespace AtomSampleViewer
     {
         auto operation = [sampleName]()
         {
+            // The assets of the previous sample may be released once it closes
+            GetInstance()->m_incrementalTestCache.RecordLoadedAssets();
+
             if (sampleName.empty())
             {
                 SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::Reset);
@@ -1430,6 +1660,7 @@ namespace AtomSampleViewer
 
         ScriptManager* s_instance = GetInstance();
         s_instance->m_scriptReporter.AddScreenshotTest(imageName);
+        s_instance->m_incrementalTestCache.RecordLoadedAssets();
 
         s_instance->m_isCapturePending = true;
         s_instance->PauseScript();
@@ -1553,6 +1784,33 @@ namespace AtomSampleViewer
 
     }
 
+    void ScriptManager::Script_SetDeferredScreenshotChecks(bool enabled)
+    {
+        auto operation = [enabled]()
+        {
+            ScriptManager* s_instance = GetInstance();
+            s_instance->m_deferScreenshotChecks = enabled;
+
+            // Switching back to immediate checks shouldn't leave earlier results pending.
+            if (!enabled)
+            {
+                s_instance->m_flushScreenshotChecks = true;
+            }
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_FlushScreenshotChecks()
+    {
+        auto operation = []()
+        {
+            GetInstance()->m_flushScreenshotChecks = true;
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
     void ScriptManager::Script_CaptureScreenshotWithImGui(const AZStd::string& imageName)
     {
         Script_SetShowImGui(true);
@@ -1968,6 +2226,392 @@ namespace AtomSampleViewer
         GetInstance()->m_scriptOperations.push(AZStd::move(operation));
     }
 
+    void ScriptManager::Script_BeginProfilingCaptureStream(const AZStd::string& outputFilePath, const AZStd::string& captureName)
+    {
+        auto operation = [outputFilePath, captureName]()
+        {
+            ScriptManager* s_instance = GetInstance();
+
+            if (s_instance->m_profilingCaptureStream.IsOpen())
+            {
+                ReportScriptError(AZStd::string::format("Profiling capture stream '%s' is already open.", s_instance->m_profilingCaptureStream.GetFilePath().c_str()));
+                return;
+            }
+
+            if (!s_instance->m_profilingCaptureStream.Open(outputFilePath, captureName))
+            {
+                ReportScriptError(AZStd::string::format("Failed to create profiling capture stream '%s'.", outputFilePath.c_str()));
+                return;
+            }
+
+            s_instance->UpdatePassTimestampQueries();
+
+            // Timestamp results are read back a few frames after they are recorded, so skip the frames that don't have results yet.
+            s_instance->m_profilingCaptureWarmupFrames = AZ::RHI::Limits::Device::FrameCountMax;
+            s_instance->m_profilingCaptureFrameNumber = 0;
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_EndProfilingCaptureStream()
+    {
+        auto operation = []()
+        {
+            ScriptManager* s_instance = GetInstance();
+
+            if (!s_instance->m_profilingCaptureStream.IsOpen())
+            {
+                ReportScriptError("EndProfilingCaptureStream was called without an open profiling capture stream.");
+                return;
+            }
+
+            s_instance->CloseProfilingCaptureStream();
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CapturePassTimestampSeries(const AZStd::string& outputFilePath, int frameCount)
+    {
+        StartProfilingCaptureSeries(outputFilePath, frameCount, true, false);
+    }
+
+    void ScriptManager::Script_CaptureCpuFrameTimeSeries(const AZStd::string& outputFilePath, int frameCount)
+    {
+        StartProfilingCaptureSeries(outputFilePath, frameCount, false, true);
+    }
+
+    void ScriptManager::Script_CaptureProfilingSeries(const AZStd::string& outputFilePath, int frameCount)
+    {
+        StartProfilingCaptureSeries(outputFilePath, frameCount, true, true);
+    }
+
+    void ScriptManager::Script_RunLatticeScalingSweep(const AZStd::string& instanceCounts, const AZStd::string& outputFilePath, int warmupFrames, int captureFrames)
+    {
+        LatticeScalingSweep::Settings settings;
+        if (!LatticeScalingSweep::ParseInstanceCounts(instanceCounts, settings.m_instanceCounts))
+        {
+            ReportScriptError(AZStd::string::format("RunLatticeScalingSweep could not parse the instance counts '%s'.", instanceCounts.c_str()));
+            return;
+        }
+
+        if (warmupFrames < 0 || captureFrames <= 0)
+        {
+            ReportScriptError("RunLatticeScalingSweep needs a positive capture frame count and a warmup frame count that isn't negative.");
+            return;
+        }
+
+        settings.m_outputFilePath = outputFilePath;
+        settings.m_warmupFrames = aznumeric_cast<uint32_t>(warmupFrames);
+        settings.m_captureFrames = aznumeric_cast<uint32_t>(captureFrames);
+
+        auto operation = [settings]()
+        {
+            bool started = false;
+            EntityLatticeTestRequestBus::BroadcastResult(started, &EntityLatticeTestRequests::StartScalingSweep, settings);
+            if (!started)
+            {
+                ReportScriptError("RunLatticeScalingSweep needs an open entity lattice sample that isn't already running a sweep.");
+                return;
+            }
+
+            // Each step may take up to its activation timeout, and large lattices can run at very low frame rates.
+            constexpr float MaxSecondsPerFrame = 1.0f;
+            const float secondsPerStep = settings.m_activationTimeoutSeconds + MaxSecondsPerFrame * (settings.m_warmupFrames + settings.m_captureFrames);
+
+            ScriptManager* s_instance = GetInstance();
+            s_instance->m_waitForLatticeScalingSweep = true;
+            s_instance->m_latticeScalingSweepTimeout = DefaultPauseTimeout + secondsPerStep * settings.m_instanceCounts.size();
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    template<typename RequestBus, typename WriteFunction>
+    void ScriptManager::QueueWriteStatisticsOperation(const char* operationName, const char* sampleName, const AZStd::string& outputFilePath,
+        WriteFunction writeFunction)
+    {
+        auto operation = [operationName, sampleName, outputFilePath, writeFunction]()
+        {
+            if (sampleName && !RequestBus::HasHandlers())
+            {
+                ReportScriptError(AZStd::string::format("%s needs the %s sample to be open.", operationName, sampleName));
+                return;
+            }
+
+            bool written = false;
+            RequestBus::BroadcastResult(written, writeFunction, outputFilePath);
+            if (!written)
+            {
+                ReportScriptError(AZStd::string::format("%s could not write '%s'.", operationName, outputFilePath.c_str()));
+            }
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CaptureAssetSwitchStatistics(const AZStd::string& outputFilePath)
+    {
+        QueueWriteStatisticsOperation<AssetLoadTestRequestBus>("CaptureAssetSwitchStatistics", "AssetLoadTest", outputFilePath, &AssetLoadTestRequests::WriteAssetSwitchStatistics);
+    }
+
+    void ScriptManager::Script_CaptureSkinnedMeshStatistics(const AZStd::string& outputFilePath)
+    {
+        QueueWriteStatisticsOperation<SkinnedMeshExampleRequestBus>("CaptureSkinnedMeshStatistics", "SkinnedMesh", outputFilePath, &SkinnedMeshExampleRequests::WriteSkinnedMeshStatistics);
+    }
+
+    void ScriptManager::Script_CaptureCullingStatistics(const AZStd::string& outputFilePath)
+    {
+        QueueWriteStatisticsOperation<CullingAndLodExampleRequestBus>("CaptureCullingStatistics", "CullingAndLod", outputFilePath, &CullingAndLodExampleRequests::WriteCullingStatistics);
+    }
+
+    void ScriptManager::Script_CaptureSampleSwitchTimings(const AZStd::string& outputFilePath)
+    {
+        // The SampleComponentManager is always there, so there is no sample to check for
+        QueueWriteStatisticsOperation<SampleComponentManagerRequestBus>("CaptureSampleSwitchTimings", nullptr, outputFilePath,
+            &SampleComponentManagerRequests::WriteSampleSwitchTimings);
+    }
+
+    void ScriptManager::Script_SetWarmSampleSwitch(bool enabled)
+    {
+        auto operation = [enabled]()
+        {
+            SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequests::SetWarmSampleSwitchEnabled, enabled);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_RecordStreamingResidency()
+    {
+        auto operation = []()
+        {
+            if (!StreamingImageExampleRequestBus::HasHandlers())
+            {
+                ReportScriptError("RecordStreamingResidency needs the StreamingImage sample to be open.");
+                return;
+            }
+
+            StreamingImageExampleRequestBus::Broadcast(&StreamingImageExampleRequests::RecordResidencyPoint);
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::Script_CaptureStreamingTelemetry(const AZStd::string& outputFilePath)
+    {
+        QueueWriteStatisticsOperation<StreamingImageExampleRequestBus>("CaptureStreamingTelemetry", "StreamingImage", outputFilePath, &StreamingImageExampleRequests::WriteStreamingTelemetry);
+    }
+
+    void ScriptManager::StartProfilingCaptureSeries(const AZStd::string& outputFilePath, int frameCount, bool capturePassTimestamps, bool captureCpuFrameTime)
+    {
+        if (frameCount <= 0)
+        {
+            ReportScriptError(AZStd::string::format("Profiling capture series '%s' needs a positive frame count.", outputFilePath.c_str()));
+            return;
+        }
+
+        auto operation = [outputFilePath, frameCount, capturePassTimestamps, captureCpuFrameTime]()
+        {
+            ScriptManager* s_instance = GetInstance();
+
+            if (s_instance->m_profilingCaptureSeries.m_isActive)
+            {
+                ReportScriptError(AZStd::string::format("Profiling capture series '%s' is already running.", s_instance->m_profilingCaptureSeries.m_outputFilePath.c_str()));
+                return;
+            }
+
+            ProfilingCaptureSeries& series = s_instance->m_profilingCaptureSeries;
+            series.m_outputFilePath = outputFilePath;
+            series.m_frameCount = aznumeric_cast<uint32_t>(frameCount);
+            series.m_recordedFrameCount = 0;
+            series.m_capturePassTimestamps = capturePassTimestamps;
+            series.m_captureCpuFrameTime = captureCpuFrameTime;
+            series.m_isActive = true;
+
+            // Size the ring for the current pass hierarchy with some headroom, so recording never has to allocate.
+            size_t passCapacity = 0;
+            if (capturePassTimestamps)
+            {
+                s_instance->CollectPassTimestamps();
+                passCapacity = AZStd::max<size_t>(s_instance->m_profilingCapturePassTimestamps.size() * 2, 64);
+                s_instance->m_profilingCapturePassTimestamps.reserve(passCapacity);
+            }
+            s_instance->m_profilingCaptureRing.Reset(series.m_frameCount, passCapacity);
+
+            // Timestamp results are read back a few frames after they are recorded, so skip the frames that don't have results yet.
+            series.m_warmupFrames = capturePassTimestamps ? AZ::RHI::Limits::Device::FrameCountMax : 0;
+            s_instance->UpdatePassTimestampQueries();
+
+            // Allow a generous amount of time per frame, samples under heavy load can run at very low frame rates.
+            constexpr float MaxSecondsPerFrame = 1.0f;
+            s_instance->PauseScriptWithTimeout(DefaultPauseTimeout + MaxSecondsPerFrame * (series.m_frameCount + series.m_warmupFrames));
+        };
+
+        GetInstance()->m_scriptOperations.push(AZStd::move(operation));
+    }
+
+    void ScriptManager::RecordProfilingCaptureFrame()
+    {
+        bool recordStream = false;
+        if (m_profilingCaptureStream.IsOpen())
+        {
+            if (m_profilingCaptureWarmupFrames > 0)
+            {
+                --m_profilingCaptureWarmupFrames;
+            }
+            else
+            {
+                recordStream = true;
+            }
+        }
+
+        bool recordSeries = false;
+        if (m_profilingCaptureSeries.m_isActive)
+        {
+            if (m_profilingCaptureSeries.m_warmupFrames > 0)
+            {
+                --m_profilingCaptureSeries.m_warmupFrames;
+            }
+            else
+            {
+                recordSeries = true;
+            }
+        }
+
+        if (!recordStream && !recordSeries)
+        {
+            return;
+        }
+
+        if (recordStream || m_profilingCaptureSeries.m_capturePassTimestamps)
+        {
+            CollectPassTimestamps();
+        }
+        else
+        {
+            m_profilingCapturePassTimestamps.clear();
+        }
+
+        const double cpuFrameTime = AZ::RHI::RHISystemInterface::Get()->GetCpuFrameTime();
+
+        if (recordStream)
+        {
+            m_profilingCaptureStream.AddFrame(m_profilingCaptureFrameNumber++, cpuFrameTime, m_profilingCapturePassTimestamps);
+        }
+
+        if (recordSeries)
+        {
+            ProfilingCaptureSeries& series = m_profilingCaptureSeries;
+            m_profilingCaptureRing.PushFrame(
+                series.m_recordedFrameCount,
+                series.m_captureCpuFrameTime ? cpuFrameTime : 0.0,
+                series.m_capturePassTimestamps ? AZStd::span<const ProfilingCaptureStreamWriter::PassTimestamp>(m_profilingCapturePassTimestamps)
+                                               : AZStd::span<const ProfilingCaptureStreamWriter::PassTimestamp>());
+
+            if (++series.m_recordedFrameCount == series.m_frameCount)
+            {
+                FinishProfilingCaptureSeries();
+            }
+        }
+    }
+
+    void ScriptManager::CollectPassTimestamps()
+    {
+        m_profilingCapturePassTimestamps.clear();
+
+        AZStd::function<void(const AZ::RPI::Pass*)> collectPassTimestamps = [this, &collectPassTimestamps](const AZ::RPI::Pass* pass)
+        {
+            if (!pass->IsEnabled())
+            {
+                return;
+            }
+
+            ProfilingCaptureStreamWriter::PassTimestamp& passTimestamp = m_profilingCapturePassTimestamps.emplace_back();
+            passTimestamp.m_passName = pass->GetPathName().GetStringView();
+            passTimestamp.m_durationInNanoseconds = pass->GetLatestTimestampResult().GetDurationInNanoseconds();
+
+            if (const AZ::RPI::ParentPass* parentPass = pass->AsParent())
+            {
+                for (const AZ::RPI::Ptr<AZ::RPI::Pass>& child : parentPass->GetChildren())
+                {
+                    collectPassTimestamps(child.get());
+                }
+            }
+        };
+        collectPassTimestamps(AZ::RPI::PassSystemInterface::Get()->GetRootPass().get());
+    }
+
+    void ScriptManager::FinishProfilingCaptureSeries()
+    {
+        ProfilingCaptureSeries& series = m_profilingCaptureSeries;
+        series.m_isActive = false;
+        UpdatePassTimestampQueries();
+
+        const char* captureName = series.m_capturePassTimestamps ? (series.m_captureCpuFrameTime ? "ProfilingSeries" : "PassTimestampSeries") : "CpuFrameTimeSeries";
+
+        ProfilingCaptureStreamWriter writer;
+        if (!writer.Open(series.m_outputFilePath, captureName))
+        {
+            ReportScriptError(AZStd::string::format("Failed to create profiling capture series file '%s'.", series.m_outputFilePath.c_str()));
+        }
+        else
+        {
+            m_profilingCaptureRing.WriteTo(writer);
+            if (writer.Close())
+            {
+                AZ_Printf("Automation", "Wrote %zu of %u frames to profiling capture series '%s'.\n",
+                    m_profilingCaptureRing.GetFrameCount(), series.m_frameCount, series.m_outputFilePath.c_str());
+            }
+            else
+            {
+                AZ_Error("Automation", false, "Profiling capture series '%s' is incomplete.", series.m_outputFilePath.c_str());
+            }
+        }
+
+        AZ_Warning("Automation", m_profilingCaptureRing.GetDroppedPassCount() == 0,
+            "Profiling capture series '%s' dropped %llu pass timestamps because the pass hierarchy grew during the capture.",
+            series.m_outputFilePath.c_str(), static_cast<unsigned long long>(m_profilingCaptureRing.GetDroppedPassCount()));
+
+        m_profilingCaptureRing.Reset(0, 0);
+
+        if (m_scriptPaused)
+        {
+            ResumeScript();
+        }
+    }
+
+    void ScriptManager::UpdatePassTimestampQueries()
+    {
+        const bool enable = m_profilingCaptureStream.IsOpen() || (m_profilingCaptureSeries.m_isActive && m_profilingCaptureSeries.m_capturePassTimestamps);
+        if (enable != m_passTimestampQueriesEnabled)
+        {
+            AZ::RPI::PassSystemInterface::Get()->GetRootPass()->SetTimestampQueryEnabled(enable);
+            m_passTimestampQueriesEnabled = enable;
+        }
+    }
+
+    void ScriptManager::CloseProfilingCaptureStream()
+    {
+        if (!m_profilingCaptureStream.IsOpen())
+        {
+            return;
+        }
+
+        [[maybe_unused]] const uint64_t frameCount = m_profilingCaptureStream.GetFrameCount();
+        if (m_profilingCaptureStream.Close())
+        {
+            AZ_Printf("Automation", "Wrote %llu frames to profiling capture stream '%s'.\n", static_cast<unsigned long long>(frameCount), m_profilingCaptureStream.GetFilePath().c_str());
+        }
+        else
+        {
+            AZ_Error("Automation", false, "Profiling capture stream '%s' is incomplete.", m_profilingCaptureStream.GetFilePath().c_str());
+        }
+
+        UpdatePassTimestampQueries();
+    }
+
     bool ScriptManager::ValidateProfilingCaptureScripContexts(AZ::ScriptDataContext& dc, AZStd::string& outputFilePath)
     {
         if (dc.GetNumArguments() != 1)
@@ -2012,6 +2656,16 @@ namespace AtomSampleViewer
         return GetInstance()->m_testSuiteRunConfig.m_randomSeed;
     }
 
+    int ScriptManager::Script_GetTestShardIndex()
+    {
+        return aznumeric_cast<int>(GetInstance()->m_scriptReporter.GetTestShardIndex());
+    }
+
+    int ScriptManager::Script_GetTestShardCount()
+    {
+        return aznumeric_cast<int>(GetInstance()->m_scriptReporter.GetTestShardCount());
+    }
+
     void ScriptManager::CheckArcBallControllerHandler()
     {
         if (0 == AZ::Debug::ArcBallControllerRequestBus::GetNumOfEventHandlers(GetInstance()->m_cameraEntity->GetId()))
@@ -12,9 +12,11 @@
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
 #include <Atom/Feature/Utils/ProfilingCaptureBus.h>
 #include <Automation/PrecommitWizardSettings.h>
+#include <Automation/ProfilingCaptureStream.h>
 #include <Automation/ScriptRepeaterBus.h>
 #include <Automation/ScriptRunnerBus.h>
 #include <Automation/AssetStatusTracker.h>
+#include <Automation/IncrementalTestCache.h>
 #include <Automation/ScriptReporter.h>
 #include <Automation/ImageComparisonConfig.h>
 #include <Utils/ImGuiAssetBrowser.h>
@@ -67,7 +69,8 @@ namespace AtomSampleViewer
         void OpenScriptRunnerDialog();
         void OpenPrecommitWizard();
 
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed);
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, bool incrementalRun, int shardIndex, int shardCount,
+            const AZStd::string& shardRunId);
 
         static ScriptManager* GetInstance();
 
@@ -116,6 +119,8 @@ namespace AtomSampleViewer
         static float Script_DegToRad(float degrees);
         static AZStd::string Script_GetRenderApiName();
         static int Script_GetRandomTestSeed();
+        static int Script_GetTestShardIndex();
+        static int Script_GetTestShardCount();
 
         // Samples...
         static void Script_OpenSample(const AZStd::string& sampleName);
@@ -148,6 +153,15 @@ namespace AtomSampleViewer
         static void Script_CaptureScreenshot(const AZStd::string& imageName);
         static void Script_CaptureScreenshotWithImGui(const AZStd::string& imageName);
 
+        // By default each screenshot check is finished before the next script operation runs. With deferred checks enabled,
+        // up to MaxDeferredScreenshotChecks comparisons run in the background while the script continues, and the results are
+        // added to the report in a later frame. The script only waits at FlushScreenshotChecks() or when the script ends.
+        // Only the comparison is deferred: CaptureScreenshot still pauses the script until the frame capture and image encode
+        // have finished, because the frame capture system handles one capture request at a time.
+        // The setting applies to the script that calls it and any scripts it runs.
+        static void Script_SetDeferredScreenshotChecks(bool enabled);
+        static void Script_FlushScreenshotChecks();
+
         // Capture a pass attachment and save it to a file (*.ppm or *.dds for image, *.buffer for buffer)
         // The order of input parameters in ScriptDataContext would be
         // 0: table of strings for pass hierarchy
@@ -166,6 +180,52 @@ namespace AtomSampleViewer
         static void Script_CaptureCpuProfilingStatistics(AZ::ScriptDataContext& dc);
         static void Script_CaptureBenchmarkMetadata(AZ::ScriptDataContext& dc);
 
+        // Opens a profiling capture stream. Until EndProfilingCaptureStream() is called, the pass timestamps and CPU frame time
+        // of every frame are appended to a single binary file (see ProfilingCaptureStream), rather than calling
+        // CapturePassTimestamp() and CaptureCpuFrameTime() for each frame. Use the ProfilingCaptureConverter tool to get CSV or JSON.
+        static void Script_BeginProfilingCaptureStream(const AZStd::string& outputFilePath, const AZStd::string& captureName);
+        static void Script_EndProfilingCaptureStream();
+
+        // Record the next frameCount consecutive frames into a preallocated ring buffer, then write them to a profiling capture
+        // stream file once all frames are recorded. The script waits until the file is written, but unlike calling
+        // CapturePassTimestamp() or CaptureCpuFrameTime() in a loop, it doesn't interrupt the frames being measured.
+        static void Script_CapturePassTimestampSeries(const AZStd::string& outputFilePath, int frameCount);
+        static void Script_CaptureCpuFrameTimeSeries(const AZStd::string& outputFilePath, int frameCount);
+        static void Script_CaptureProfilingSeries(const AZStd::string& outputFilePath, int frameCount); //< Both pass timestamps and CPU frame time
+
+        // Steps the lattice of the current EntityLatticeTestComponent sample through a list of instance counts, and writes the CPU frame
+        // time, activation time and process memory of each step to a JSON file. The script waits until the sweep is done.
+        // @param instanceCounts the instance counts separated by commas, such as "1000,8000,27000"
+        // @param warmupFrames frames to idle once the lattice of a step is ready, before capturing
+        // @param captureFrames frames to capture at each step
+        static void Script_RunLatticeScalingSweep(const AZStd::string& instanceCounts, const AZStd::string& outputFilePath, int warmupFrames, int captureFrames);
+
+        // Queues an operation that has the sample on RequestBus write its statistics to a file, and reports a script error if
+        // the sample isn't open or the file couldn't be written. Pass a null sampleName for buses that always have a handler.
+        template<typename RequestBus, typename WriteFunction>
+        static void QueueWriteStatisticsOperation(const char* operationName, const char* sampleName, const AZStd::string& outputFilePath,
+            WriteFunction writeFunction);
+
+        // Writes the per-frame cost of the asset switches the AssetLoadTest sample did with each switch strategy to a JSON file.
+        static void Script_CaptureAssetSwitchStatistics(const AZStd::string& outputFilePath);
+
+        // Writes the instance counts, skinning output stream use, out-of-memory retries and frame times of the SkinnedMesh
+        // sample to a JSON file.
+        static void Script_CaptureSkinnedMeshStatistics(const AZStd::string& outputFilePath);
+
+        // Writes the per-view culling counts and estimated LOD histogram of the CullingAndLod sample to a JSON file.
+        static void Script_CaptureCullingStatistics(const AZStd::string& outputFilePath);
+        // Writes the phase timings of every sample switch since startup to a JSON file.
+        static void Script_CaptureSampleSwitchTimings(const AZStd::string& outputFilePath);
+        // Keeps the RPI scene between compatible RPI samples instead of recreating it on every switch.
+        static void Script_SetWarmSampleSwitch(bool enabled);
+        // Records the residency and pool memory of the StreamingImage sample at the current mip bias as a point of its
+        // residency curve.
+        static void Script_RecordStreamingResidency();
+        // Writes the per-image streaming times, pool memory, throughput and residency curve of the StreamingImage sample
+        // to a JSON file.
+        static void Script_CaptureStreamingTelemetry(const AZStd::string& outputFilePath);
+
         // Camera...
         static void Script_ArcBallCameraController_SetCenter(AZ::Vector3 center);
         static void Script_ArcBallCameraController_SetPan(AZ::Vector3 pan);
@@ -244,6 +304,22 @@ namespace AtomSampleViewer
 
         static bool PrepareForScreenCapture(const AZStd::string& imageName);
 
+        // Returns true if the next script operation has to wait for pending screenshot checks to finish.
+        bool ShouldWaitForScreenshotChecks();
+
+        // Returns true while a sweep started by RunLatticeScalingSweep is still running, and stops it if it times out
+        bool ShouldWaitForLatticeScalingSweep(float deltaTime);
+
+        // Appends the current frame to the open profiling capture stream and the active profiling capture series.
+        void RecordProfilingCaptureFrame();
+        void CollectPassTimestamps();
+        void CloseProfilingCaptureStream();
+        void FinishProfilingCaptureSeries();
+        // Enables pass timestamp queries while the stream or series needs them.
+        void UpdatePassTimestampQueries();
+
+        static void StartProfilingCaptureSeries(const AZStd::string& outputFilePath, int frameCount, bool capturePassTimestamps, bool captureCpuFrameTime);
+
         // show/hide imgui
         void SetShowImGui(bool show);
 
@@ -254,19 +330,60 @@ namespace AtomSampleViewer
             bool m_closeOnTestScriptFinish = false;
             AZStd::string m_testSuitePath;
             int m_randomSeed = 0; // Used to shuffle test order in a random manner
+            int m_shardIndex = 0; // Which of the m_shardCount parts of the test suite this process runs
+            int m_shardCount = 1; // Number of processes the test suite is split across
+            AZStd::string m_shardRunId; // Shared by all processes of the run
         };
 
         TestSuiteExecutionConfig m_testSuiteRunConfig;
 
         static constexpr float DefaultPauseTimeout = 5.0f;
+        static constexpr size_t MaxDeferredScreenshotChecks = 8;
 
         int m_scriptIdleFrames = 0;
         float m_scriptIdleSeconds = 0.0f;
         bool m_scriptPaused = false;
         float m_scriptPauseTimeout = 0.0f;
 
+        bool m_deferScreenshotChecks = false;         //< Current mode, may be changed by scripts
+        bool m_deferScreenshotChecksSetting = false;  //< Mode selected in the Script Runner dialog, applied when a script run starts
+        bool m_flushScreenshotChecks = false;         //< Forces the script to wait until all pending screenshot checks finish
+
+        // In an incremental run, each script run by the main script is skipped if it passed in an earlier run and none of its
+        // inputs changed since then. Its results are copied from the IncrementalTestCache instead.
+        bool m_incrementalRun = false;                //< Current mode
+        bool m_incrementalRunSetting = false;         //< Mode selected in the Script Runner dialog, applied when a script run starts
+        bool m_finishIncrementalScript = false;       //< The recorded script ended, and its report is complete after the next PopScript()
+        AZStd::vector<AZ::Data::AssetId> m_incrementalScriptAssets; //< The script being recorded and the scripts it runs
+        IncrementalTestCache m_incrementalTestCache;
+
+        bool m_isShardedRun = false;                  //< The current script run is one shard of the automated test suite run
+
+        ProfilingCaptureStreamWriter m_profilingCaptureStream;
+        AZStd::vector<ProfilingCaptureStreamWriter::PassTimestamp> m_profilingCapturePassTimestamps; //< Reused for each recorded frame
+        uint32_t m_profilingCaptureWarmupFrames = 0;
+        uint64_t m_profilingCaptureFrameNumber = 0;
+        bool m_passTimestampQueriesEnabled = false;
+
+        struct ProfilingCaptureSeries
+        {
+            AZStd::string m_outputFilePath;
+            uint32_t m_frameCount = 0;
+            uint32_t m_recordedFrameCount = 0;
+            uint32_t m_warmupFrames = 0;
+            bool m_capturePassTimestamps = false;
+            bool m_captureCpuFrameTime = false;
+            bool m_isActive = false;
+        };
+
+        ProfilingCaptureSeries m_profilingCaptureSeries;
+        ProfilingCaptureFrameRing m_profilingCaptureRing;
+
         bool m_waitForAssetTracker = false;
         float m_assetTrackingTimeout = 0.0f;
+
+        bool m_waitForLatticeScalingSweep = false;
+        float m_latticeScalingSweepTimeout = 0.0f;
         AssetStatusTracker m_assetStatusTracker;
 
         AZStd::unique_ptr<AZ::ScriptContext> m_scriptContext; //< Provides the lua scripting system
@@ -8,12 +8,18 @@
 
 #include <sstream>
 #include <Automation/ScriptReporter.h>
+#include <Utils/JsonFile.h>
 #include <Utils/Utils.h>
 #include <Atom/RHI/Factory.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/prettywriter.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Utils/Utils.h>
 
 namespace AtomSampleViewer
@@ -29,6 +35,9 @@ namespace AtomSampleViewer
         "Sort by Script", "Sort by Official Baseline Diff Score", "Sort by Local Baseline Diff Score",
     };
 
+    // Max channel difference (0-1) below which a pixel difference is considered visually imperceptible
+    static constexpr float ImperceptibleDiffFilter = 0.01f;
+
     AZStd::string ScriptReporter::ImageComparisonResult::GetSummaryString() const
     {
         AZStd::string resultString;
@@ -78,15 +87,33 @@ namespace AtomSampleViewer
 
     void ScriptReporter::Reset()
     {
+        // Any comparisons still in flight belong to the reports being cleared, so their results are dropped.
+        m_comparisonEngine.WaitForAll();
+        for (const PendingScreenshotCheck& pendingCheck : m_pendingScreenshotChecks)
+        {
+            ScreenshotComparisonEngine::Result discardedResult;
+            m_comparisonEngine.TryTakeResult(pendingCheck.m_ticket, discardedResult);
+        }
+        m_pendingScreenshotChecks.clear();
+
+        SetTraceReportIndex(InvalidReportIndex);
         m_scriptReports.clear();
         m_reportsSortedByOfficialBaslineScore.clear();
         m_reportsSortedByLocaBaslineScore.clear();
         m_currentScriptIndexStack.clear();
+        m_residentReportIndices.clear();
+        CloseJournal();
         m_invalidationMessage.clear();
         m_uniqueTimestamp = GenerateTimestamp();
 
     }
 
+    ScriptReporter::~ScriptReporter()
+    {
+        SetTraceReportIndex(InvalidReportIndex);
+        CloseJournal();
+    }
+
     void ScriptReporter::SetInvalidationMessage(const AZStd::string& message)
     {
         m_invalidationMessage = message;
@@ -97,15 +124,15 @@ namespace AtomSampleViewer
 
     void ScriptReporter::PushScript(const AZStd::string& scriptAssetPath)
     {
-        if (GetCurrentScriptReport())
-        {
-            // Only the current script should listen for Trace Errors
-            GetCurrentScriptReport()->BusDisconnect();
-        }
+        TrimResidentScriptReports();
+
+        const size_t reportIndex = m_scriptReports.size();
+        m_currentScriptIndexStack.push_back(reportIndex);
+        m_residentReportIndices.push_back(reportIndex);
+        m_scriptReports.emplace_back().m_scriptAssetPath = AZ::Name(scriptAssetPath);
 
-        m_currentScriptIndexStack.push_back(m_scriptReports.size());
-        m_scriptReports.emplace_back().m_scriptAssetPath = scriptAssetPath;
-        m_scriptReports.back().BusConnect();
+        // Only the current script should count trace messages
+        SetTraceReportIndex(reportIndex);
     }
 
     void ScriptReporter::PopScript()
@@ -114,15 +141,83 @@ namespace AtomSampleViewer
 
         if (GetCurrentScriptReport())
         {
-            GetCurrentScriptReport()->BusDisconnect();
             m_currentScriptIndexStack.pop_back();
         }
 
-        if (GetCurrentScriptReport())
+        // Make sure the newly restored current script is counting trace messages
+        SetTraceReportIndex(m_currentScriptIndexStack.empty() ? InvalidReportIndex : m_currentScriptIndexStack.back());
+    }
+
+    void ScriptReporter::AddCachedScriptReport(const AZStd::string& scriptAssetPath, uint32_t generalWarningCount, uint32_t screenshotWarningCount,
+        AZStd::vector<ScreenshotTestInfo> screenshotTests)
+    {
+        TrimResidentScriptReports();
+
+        m_residentReportIndices.push_back(m_scriptReports.size());
+
+        ScriptReport& scriptReport = m_scriptReports.emplace_back();
+        scriptReport.m_scriptAssetPath = AZ::Name(scriptAssetPath);
+        scriptReport.m_generalWarningCount = generalWarningCount;
+        scriptReport.m_screenshotWarningCount = screenshotWarningCount;
+        scriptReport.m_screenshotTests = AZStd::move(screenshotTests);
+        scriptReport.m_isCachedResult = true;
+    }
+
+    void ScriptReporter::SetTraceReportIndex(size_t reportIndex)
+    {
+        m_traceReportIndex = reportIndex;
+
+        if (reportIndex == InvalidReportIndex)
+        {
+            AZ::Debug::TraceMessageBus::Handler::BusDisconnect();
+        }
+        else if (!AZ::Debug::TraceMessageBus::Handler::BusIsConnected())
+        {
+            AZ::Debug::TraceMessageBus::Handler::BusConnect();
+        }
+    }
+
+    bool ScriptReporter::OnPreAssert(const char* /*fileName*/, int /*line*/, const char* /*func*/, [[maybe_unused]] const char* message)
+    {
+        if (m_traceReportIndex != InvalidReportIndex)
+        {
+            ++m_scriptReports[m_traceReportIndex].m_assertCount;
+        }
+        return false;
+    }
+
+    bool ScriptReporter::OnPreError(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* message)
+    {
+        if (m_traceReportIndex != InvalidReportIndex)
+        {
+            ScriptReport& scriptReport = m_scriptReports[m_traceReportIndex];
+            if (AZStd::string::npos == AzFramework::StringFunc::Find(message, "Screenshot check failed"))
+            {
+                ++scriptReport.m_generalErrorCount;
+            }
+            else
+            {
+                ++scriptReport.m_screenshotErrorCount;
+            }
+        }
+        return false;
+    }
+
+    bool ScriptReporter::OnPreWarning(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* message)
+    {
+        if (m_traceReportIndex != InvalidReportIndex)
         {
-            // Make sure the newly restored current script is listening for Trace Errors
-            GetCurrentScriptReport()->BusConnect();
+            ScriptReport& scriptReport = m_scriptReports[m_traceReportIndex];
+            if (AZStd::string::npos == AzFramework::StringFunc::Find(message, "Screenshot does not match the local baseline"))
+            {
+                ++scriptReport.m_generalWarningCount;
+            }
+            else
+            {
+                ++scriptReport.m_screenshotWarningCount;
+            }
         }
+        return false;
     }
 
     bool ScriptReporter::HasActiveScript() const
@@ -143,7 +238,7 @@ namespace AtomSampleViewer
 
         if (pathOutcome.IsSuccess())
         {
-            m_screenshotFilePath = pathOutcome.GetValue();
+            m_screenshotFilePath = AZ::Name(pathOutcome.GetValue());
         }
         else
         {
@@ -157,7 +252,7 @@ namespace AtomSampleViewer
 
         if (pathOutcome.IsSuccess())
         {
-            m_officialBaselineScreenshotFilePath = pathOutcome.GetValue();
+            m_officialBaselineScreenshotFilePath = AZ::Name(pathOutcome.GetValue());
         }
         else
         {
@@ -171,7 +266,7 @@ namespace AtomSampleViewer
 
         if (pathOutcome.IsSuccess())
         {
-            m_localBaselineScreenshotFilePath = pathOutcome.GetValue();
+            m_localBaselineScreenshotFilePath = AZ::Name(pathOutcome.GetValue());
         }
         else
         {
@@ -195,6 +290,11 @@ namespace AtomSampleViewer
         {
             ShowReportDialog();
         }
+        else
+        {
+            // Reports loaded for the dialog or the precommit wizard are spilled again once they are no longer displayed
+            TrimResidentScriptReports();
+        }
     }
 
     bool ScriptReporter::HasErrorsAssertsInReport() const
@@ -278,11 +378,11 @@ namespace AtomSampleViewer
         return m_resultsSummary;
     }
 
-    void ScriptReporter::ShowDiffButton(const char* buttonLabel, const AZStd::string& imagePathA, const AZStd::string& imagePathB)
+    void ScriptReporter::ShowDiffButton(const char* buttonLabel, const AZ::Name& imagePathA, const AZ::Name& imagePathB)
     {
         if (ImGui::Button(buttonLabel))
         {
-            if (!Utils::RunDiffTool(imagePathA, imagePathB))
+            if (!Utils::RunDiffTool(AZStd::string(imagePathA.GetStringView()), AZStd::string(imagePathB.GetStringView())))
             {
                 m_messageBox.OpenPopupMessage("Can't Diff", "Image diff is not supported on this platform, or the required diff tool is not installed.");
             }
@@ -301,11 +401,11 @@ namespace AtomSampleViewer
         const auto projectPath = AZ::Utils::GetProjectPath();
         AZStd::string imageDiffPath;
         AZStd::string scriptFilenameWithouExtension;
-        AzFramework::StringFunc::Path::GetFileName(scriptReport.m_scriptAssetPath.c_str(), scriptFilenameWithouExtension);
+        AzFramework::StringFunc::Path::GetFileName(scriptReport.m_scriptAssetPath.GetCStr(), scriptFilenameWithouExtension);
         AzFramework::StringFunc::Path::StripExtension(scriptFilenameWithouExtension);
 
         AZStd::string screenshotFilenameWithouExtension;
-        AzFramework::StringFunc::Path::GetFileName(screenshotTest.m_screenshotFilePath.c_str(), screenshotFilenameWithouExtension);
+        AzFramework::StringFunc::Path::GetFileName(screenshotTest.m_screenshotFilePath.GetCStr(), screenshotFilenameWithouExtension);
         AzFramework::StringFunc::Path::StripExtension(screenshotFilenameWithouExtension);
 
         AZStd::string imageDiffFilename = "imageDiff_" + scriptFilenameWithouExtension + "_" + screenshotFilenameWithouExtension + "_" + m_uniqueTimestamp + ".png";
@@ -327,6 +427,12 @@ namespace AtomSampleViewer
         [[maybe_unused]] bool ignoringMinorDiffs = false;
         for (const ImageComparisonToleranceLevel& level : m_availableToleranceLevels)
         {
+            // Perceptual scores aren't on the same scale as the diff scores these suggestions are for
+            if (level.m_usePerceptualScore)
+            {
+                continue;
+            }
+
             AZ_Assert(level.m_threshold > thresholdChecked || thresholdChecked == 0.0f, "Threshold values are not sequential");
             AZ_Assert(level.m_filterImperceptibleDiffs >= ignoringMinorDiffs, "filterImperceptibleDiffs values are not sequential");
             thresholdChecked = level.m_threshold;
@@ -360,8 +466,8 @@ namespace AtomSampleViewer
                 m_resultsSummary.m_totalScreenshotWarnings += scriptReport.m_screenshotWarningCount;
                 m_resultsSummary.m_totalScreenshotsFailed += scriptReport.m_screenshotErrorCount;
 
-                // This will catch any false-negatives that could occur if the screenshot failure error messages change without also updating ScriptReport::OnPreError()
-                m_resultsSummary.m_totalScreenshotsCount += aznumeric_cast<uint32_t>(scriptReport.m_screenshotTests.size());
+                // This will catch any false-negatives that could occur if the screenshot failure error messages change without also updating ScriptReporter::OnPreError()
+                m_resultsSummary.m_totalScreenshotsCount += aznumeric_cast<uint32_t>(scriptReport.GetScreenshotTestCount());
                 for (ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
                 {
                     if (screenshotTest.m_officialComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass &&
@@ -415,8 +521,9 @@ namespace AtomSampleViewer
 
             if (m_currentSortOption == SortOption::Unsorted)
             {
-                for (ScriptReport& scriptReport : m_scriptReports)
+                for (size_t reportIndex = 0; reportIndex < m_scriptReports.size(); ++reportIndex)
                 {
+                    ScriptReport& scriptReport = m_scriptReports[reportIndex];
                     const bool scriptPassed = scriptReport.m_assertCount == 0 && scriptReport.m_generalErrorCount == 0 && scriptReport.m_screenshotErrorCount == 0;
                     const bool scriptHasWarnings = scriptReport.m_generalWarningCount > 0 || scriptReport.m_screenshotWarningCount > 0;
 
@@ -432,9 +539,10 @@ namespace AtomSampleViewer
 
                     ImGuiTreeNodeFlags scriptNodeFlag = scriptPassed ? FlagDefaultClosed : FlagDefaultOpen;
 
-                    AZStd::string header = AZStd::string::format("%s %s",
+                    AZStd::string header = AZStd::string::format("%s %s%s",
                         scriptPassed ? "PASSED" : "FAILED",
-                        scriptReport.m_scriptAssetPath.c_str()
+                        scriptReport.m_scriptAssetPath.GetCStr(),
+                        scriptReport.m_isCachedResult ? " (cached)" : ""
                     );
 
                     HighlightTextFailedOrWarning(!scriptPassed, scriptHasWarnings);
@@ -469,7 +577,7 @@ namespace AtomSampleViewer
                         // Number of screenshots
                         if (m_showAll || scriptReport.m_screenshotErrorCount > 0 || (m_showWarnings && scriptReport.m_screenshotWarningCount > 0))
                         {
-                            ImGui::Text("Screenshot Test Count: %zu", scriptReport.m_screenshotTests.size());
+                            ImGui::Text("Screenshot Test Count: %zu", scriptReport.GetScreenshotTestCount());
                         }
 
                         // Number of screenshot failures
@@ -488,13 +596,16 @@ namespace AtomSampleViewer
 
                         ResetTextHighlight();
 
-                        for (ScreenshotTestInfo& screenshotResult : scriptReport.m_screenshotTests)
+                        // Only expanded reports need their screenshot tests
+                        LoadScriptReport(reportIndex);
+                        for (size_t screenshotIndex = 0; screenshotIndex < scriptReport.m_screenshotTests.size(); ++screenshotIndex)
                         {
+                            const ScreenshotTestInfo& screenshotResult = scriptReport.m_screenshotTests[screenshotIndex];
                             const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
                             const bool localBaselineWarning = screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
 
                             AZStd::string fileName;
-                            AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.c_str(), fileName);
+                            AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.GetCStr(), fileName);
 
                             std::stringstream headerSummary;
                             if (!screenshotPassed)
@@ -511,7 +622,7 @@ namespace AtomSampleViewer
                                 fileName.c_str(),
                                 headerSummary.str().c_str());
 
-                            ShowScreenshotTestInfoTreeNode(screenshotHeader, scriptReport, screenshotResult);
+                            ShowScreenshotTestInfoTreeNode(screenshotHeader, ReportIndex{ reportIndex, screenshotIndex });
                         }
 
                         ImGui::TreePop();
@@ -538,8 +649,8 @@ namespace AtomSampleViewer
                 {
                     for (const auto& [threshold, reportIndex] : *sortedReportMap)
                     {
-                        ScriptReport& scriptReport = m_scriptReports[reportIndex.first];
-                        ScreenshotTestInfo& screenshotResult = scriptReport.m_screenshotTests[reportIndex.second];
+                        const ScriptReport& scriptReport = LoadScriptReport(reportIndex.first);
+                        const ScreenshotTestInfo& screenshotResult = scriptReport.m_screenshotTests[reportIndex.second];
 
                         float diffScore = 0.0f;
                         if (m_currentSortOption == SortOption::OfficialBaselineDiffScore)
@@ -554,16 +665,16 @@ namespace AtomSampleViewer
                         const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
 
                         AZStd::string fileName;
-                        AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.c_str(), fileName);
+                        AzFramework::StringFunc::Path::GetFullFileName(screenshotResult.m_screenshotFilePath.GetCStr(), fileName);
 
                         AZStd::string header = AZStd::string::format("%f %s %s %s '%s'",
                             diffScore,
                             screenshotPassed ? "PASSED" : "FAILED",
-                            scriptReport.m_scriptAssetPath.c_str(),
+                            scriptReport.m_scriptAssetPath.GetCStr(),
                             fileName.c_str(),
                             screenshotResult.m_toleranceLevel.m_name.c_str());
 
-                        ShowScreenshotTestInfoTreeNode(header, scriptReport, screenshotResult);
+                        ShowScreenshotTestInfoTreeNode(header, reportIndex);
                     }
                 }
             }
@@ -584,8 +695,11 @@ namespace AtomSampleViewer
         ImGui::End();
     }
 
-    void ScriptReporter::ShowScreenshotTestInfoTreeNode(const AZStd::string& header,  ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult)
+    void ScriptReporter::ShowScreenshotTestInfoTreeNode(const AZStd::string& header, ReportIndex reportIndex)
     {
+        ScriptReport& scriptReport = LoadScriptReport(reportIndex.first);
+        ScreenshotTestInfo& screenshotResult = scriptReport.m_screenshotTests[reportIndex.second];
+
         const bool screenshotPassed = screenshotResult.m_officialComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::Pass;
         const bool localBaselineWarning = screenshotResult.m_localComparisonResult.m_resultCode != ImageComparisonResult::ResultCode::Pass;
 
@@ -605,13 +719,13 @@ namespace AtomSampleViewer
         {
             ResetTextHighlight();
 
-            ImGui::Text("Screenshot:        %s", screenshotResult.m_screenshotFilePath.c_str());
+            ImGui::Text("Screenshot:        %s", screenshotResult.m_screenshotFilePath.GetCStr());
 
             ImGui::Spacing();
 
             HighlightTextIf(!screenshotPassed, m_highlightSettings.m_highlightFailed);
 
-            ImGui::Text("Official Baseline: %s", screenshotResult.m_officialBaselineScreenshotFilePath.c_str());
+            ImGui::Text("Official Baseline: %s", screenshotResult.m_officialBaselineScreenshotFilePath.GetCStr());
 
             // Official Baseline Result
             ImGui::Indent();
@@ -665,6 +779,7 @@ namespace AtomSampleViewer
                 {
                     if (screenshotResult.m_localComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::FileNotFound)
                     {
+                        scriptReport.m_journalOffset = ScriptReport::InvalidJournalOffset;
                         UpdateSourceBaselineImage(screenshotResult, true);
                     }
                     else
@@ -674,10 +789,12 @@ namespace AtomSampleViewer
                             "This will replace the official baseline image \n"
                             "with the image captured during this test run. \n"
                             "Are you sure?",
-                            // It's important to bind screenshotResult by reference because UpdateOfficialBaselineImage will update it
-                            [this, &screenshotResult]()
+                            // Bind the index rather than screenshotResult, the report may be spilled before the user confirms
+                            [this, reportIndex]()
                             {
-                                UpdateSourceBaselineImage(screenshotResult, true);
+                                ScriptReport& scriptReport = LoadScriptReport(reportIndex.first);
+                                scriptReport.m_journalOffset = ScriptReport::InvalidJournalOffset;
+                                UpdateSourceBaselineImage(scriptReport.m_screenshotTests[reportIndex.second], true);
                             });
                     }
                 }
@@ -688,7 +805,7 @@ namespace AtomSampleViewer
 
             HighlightTextIf(localBaselineWarning, m_highlightSettings.m_highlightWarning);
 
-            ImGui::Text("Local Baseline:    %s", screenshotResult.m_localBaselineScreenshotFilePath.c_str());
+            ImGui::Text("Local Baseline:    %s", screenshotResult.m_localBaselineScreenshotFilePath.GetCStr());
 
             // Local Baseline Result
             ImGui::Indent();
@@ -705,6 +822,7 @@ namespace AtomSampleViewer
                 {
                     if (screenshotResult.m_localComparisonResult.m_resultCode == ImageComparisonResult::ResultCode::FileNotFound)
                     {
+                        scriptReport.m_journalOffset = ScriptReport::InvalidJournalOffset;
                         UpdateLocalBaselineImage(screenshotResult, true);
                     }
                     else
@@ -714,10 +832,12 @@ namespace AtomSampleViewer
                             "This will replace the local baseline image \n"
                             "with the image captured during this test run. \n"
                             "Are you sure?",
-                            // It's important to bind screenshotResult by reference because UpdateLocalBaselineImage will update it
-                            [this, &screenshotResult]()
+                            // Bind the index rather than screenshotResult, the report may be spilled before the user confirms
+                            [this, reportIndex]()
                             {
-                                UpdateLocalBaselineImage(screenshotResult, true);
+                                ScriptReport& scriptReport = LoadScriptReport(reportIndex.first);
+                                scriptReport.m_journalOffset = ScriptReport::InvalidJournalOffset;
+                                UpdateLocalBaselineImage(scriptReport.m_screenshotTests[reportIndex.second], true);
                             });
                     }
                 }
@@ -754,6 +874,239 @@ namespace AtomSampleViewer
         }
     }
 
+    namespace ScriptReportJournal
+    {
+        // Strings are read back into interned names so repeated paths still share memory.
+
+        void WriteString(AZStd::vector<uint8_t>& buffer, AZStd::string_view value)
+        {
+            Write(buffer, aznumeric_cast<uint32_t>(value.size()));
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        bool ReadString(AZStd::span<const uint8_t>& data, AZStd::string_view& value)
+        {
+            uint32_t size = 0;
+            if (!Read(data, size) || data.size() < size)
+            {
+                return false;
+            }
+            value = AZStd::string_view(reinterpret_cast<const char*>(data.data()), size);
+            data = data.subspan(size);
+            return true;
+        }
+
+        void WriteComparisonResult(AZStd::vector<uint8_t>& buffer, const ScriptReporter::ImageComparisonResult& result)
+        {
+            Write(buffer, static_cast<uint32_t>(result.m_resultCode));
+            Write(buffer, result.m_diffScore);
+        }
+
+        bool ReadComparisonResult(AZStd::span<const uint8_t>& data, ScriptReporter::ImageComparisonResult& result)
+        {
+            uint32_t resultCode = 0;
+            if (!Read(data, resultCode) || !Read(data, result.m_diffScore))
+            {
+                return false;
+            }
+            result.m_resultCode = static_cast<ScriptReporter::ImageComparisonResult::ResultCode>(resultCode);
+            return true;
+        }
+
+        // Flags of the tolerance level byte
+        static constexpr uint8_t FilterImperceptibleDiffsFlag = 1 << 0;
+        static constexpr uint8_t UsePerceptualScoreFlag = 1 << 1;
+
+        void WriteScreenshotTests(AZStd::vector<uint8_t>& buffer, const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTests)
+        {
+            const size_t start = buffer.size();
+            Write(buffer, uint64_t{ 0 }); // Byte count, patched below
+            for (const ScriptReporter::ScreenshotTestInfo& screenshotTest : screenshotTests)
+            {
+                WriteString(buffer, screenshotTest.m_screenshotFilePath.GetStringView());
+                WriteString(buffer, screenshotTest.m_officialBaselineScreenshotFilePath.GetStringView());
+                WriteString(buffer, screenshotTest.m_localBaselineScreenshotFilePath.GetStringView());
+                WriteString(buffer, screenshotTest.m_toleranceLevel.m_name);
+                Write(buffer, screenshotTest.m_toleranceLevel.m_threshold);
+                Write(buffer, static_cast<uint8_t>((screenshotTest.m_toleranceLevel.m_filterImperceptibleDiffs ? FilterImperceptibleDiffsFlag : 0) |
+                    (screenshotTest.m_toleranceLevel.m_usePerceptualScore ? UsePerceptualScoreFlag : 0)));
+                WriteComparisonResult(buffer, screenshotTest.m_officialComparisonResult);
+                WriteComparisonResult(buffer, screenshotTest.m_localComparisonResult);
+            }
+
+            const uint64_t byteCount = buffer.size() - start - sizeof(uint64_t);
+            memcpy(buffer.data() + start, &byteCount, sizeof(byteCount));
+        }
+
+        bool ReadScreenshotTests(AZStd::span<const uint8_t> data, size_t screenshotTestCount, AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTests)
+        {
+            screenshotTests.resize(screenshotTestCount);
+            for (ScriptReporter::ScreenshotTestInfo& screenshotTest : screenshotTests)
+            {
+                AZStd::string_view screenshotFilePath;
+                AZStd::string_view officialBaselineFilePath;
+                AZStd::string_view localBaselineFilePath;
+                AZStd::string_view toleranceLevelName;
+                uint8_t toleranceLevelFlags = 0;
+                if (!ReadString(data, screenshotFilePath) || !ReadString(data, officialBaselineFilePath) ||
+                    !ReadString(data, localBaselineFilePath) || !ReadString(data, toleranceLevelName) ||
+                    !Read(data, screenshotTest.m_toleranceLevel.m_threshold) || !Read(data, toleranceLevelFlags) ||
+                    !ReadComparisonResult(data, screenshotTest.m_officialComparisonResult) ||
+                    !ReadComparisonResult(data, screenshotTest.m_localComparisonResult))
+                {
+                    return false;
+                }
+
+                screenshotTest.m_screenshotFilePath = AZ::Name(screenshotFilePath);
+                screenshotTest.m_officialBaselineScreenshotFilePath = AZ::Name(officialBaselineFilePath);
+                screenshotTest.m_localBaselineScreenshotFilePath = AZ::Name(localBaselineFilePath);
+                screenshotTest.m_toleranceLevel.m_name.assign(toleranceLevelName.data(), toleranceLevelName.size());
+                screenshotTest.m_toleranceLevel.m_filterImperceptibleDiffs = (toleranceLevelFlags & FilterImperceptibleDiffsFlag) != 0;
+                screenshotTest.m_toleranceLevel.m_usePerceptualScore = (toleranceLevelFlags & UsePerceptualScoreFlag) != 0;
+            }
+
+            return data.empty();
+        }
+    } // namespace ScriptReportJournal
+
+    ScriptReporter::ScriptReport& ScriptReporter::LoadScriptReport(size_t reportIndex)
+    {
+        ScriptReport& scriptReport = m_scriptReports[reportIndex];
+        if (!scriptReport.IsSpilled())
+        {
+            return scriptReport;
+        }
+
+        bool loaded = false;
+        uint64_t byteCount = 0;
+        m_journalFile.Seek(scriptReport.m_journalOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        if (m_journalFile.Read(sizeof(byteCount), &byteCount) == sizeof(byteCount))
+        {
+            AZStd::vector<uint8_t> data(byteCount);
+            loaded = m_journalFile.Read(byteCount, data.data()) == byteCount &&
+                ScriptReportJournal::ReadScreenshotTests(data, scriptReport.m_spilledScreenshotTestCount, scriptReport.m_screenshotTests);
+        }
+
+        if (!loaded)
+        {
+            AZ_Error("ScriptReporter", false, "Failed to load the screenshot results of '%s' from the report journal", scriptReport.m_scriptAssetPath.GetCStr());
+            scriptReport.m_screenshotTests.clear();
+            scriptReport.m_journalOffset = ScriptReport::InvalidJournalOffset;
+        }
+
+        scriptReport.m_isSpilled = false;
+        scriptReport.m_spilledScreenshotTestCount = 0;
+        m_residentReportIndices.push_back(reportIndex);
+        return scriptReport;
+    }
+
+    void ScriptReporter::SetMaxResidentScriptReports(size_t maxResidentScriptReports)
+    {
+        m_maxResidentScriptReports = maxResidentScriptReports;
+    }
+
+    bool ScriptReporter::CanSpillScriptReport(size_t reportIndex) const
+    {
+        if (AZStd::find(m_currentScriptIndexStack.begin(), m_currentScriptIndexStack.end(), reportIndex) != m_currentScriptIndexStack.end())
+        {
+            return false;
+        }
+
+        for (const PendingScreenshotCheck& pendingCheck : m_pendingScreenshotChecks)
+        {
+            if (pendingCheck.m_reportIndex.first == reportIndex)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ScriptReporter::TrimResidentScriptReports()
+    {
+        if (m_journalFailed)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < m_residentReportIndices.size() && m_residentReportIndices.size() > m_maxResidentScriptReports;)
+        {
+            const size_t reportIndex = m_residentReportIndices[i];
+            if (!CanSpillScriptReport(reportIndex))
+            {
+                ++i;
+                continue;
+            }
+
+            if (!SpillScriptReport(m_scriptReports[reportIndex]))
+            {
+                // Keep everything in memory rather than losing results
+                AZ_Warning("ScriptReporter", false, "Failed to write the script report journal, all script reports will be kept in memory");
+                m_journalFailed = true;
+                return;
+            }
+
+            m_residentReportIndices.erase(m_residentReportIndices.begin() + i);
+        }
+    }
+
+    bool ScriptReporter::SpillScriptReport(ScriptReport& scriptReport)
+    {
+        AZ_Assert(!scriptReport.IsSpilled(), "Script report is already spilled");
+
+        // Reports that were loaded back and not changed are still in the journal
+        if (scriptReport.m_journalOffset == ScriptReport::InvalidJournalOffset)
+        {
+            if (!m_journalFile.IsOpen() && !OpenJournal())
+            {
+                return false;
+            }
+
+            AZStd::vector<uint8_t> buffer;
+            ScriptReportJournal::WriteScreenshotTests(buffer, scriptReport.m_screenshotTests);
+
+            m_journalFile.Seek(m_journalSize, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            if (m_journalFile.Write(buffer.data(), buffer.size()) != buffer.size())
+            {
+                return false;
+            }
+
+            scriptReport.m_journalOffset = m_journalSize;
+            m_journalSize += buffer.size();
+        }
+
+        scriptReport.m_spilledScreenshotTestCount = scriptReport.m_screenshotTests.size();
+        scriptReport.m_screenshotTests = {};
+        scriptReport.m_isSpilled = true;
+        return true;
+    }
+
+    bool ScriptReporter::OpenJournal()
+    {
+        AZStd::string journalPath;
+        AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), UserFolder, journalPath);
+        AzFramework::StringFunc::Path::Join(journalPath.c_str(), TestResultsFolder, journalPath);
+        AzFramework::StringFunc::Path::Join(journalPath.c_str(), GetShardFileName(JournalFileBaseName, ".bin", m_testShardIndex, m_testShardCount).c_str(), journalPath);
+
+        const int openMode = AZ::IO::SystemFile::SF_OPEN_READ_WRITE | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH;
+        m_journalSize = 0;
+        return m_journalFile.Open(journalPath.c_str(), openMode);
+    }
+
+    void ScriptReporter::CloseJournal()
+    {
+        if (m_journalFile.IsOpen())
+        {
+            const AZStd::string journalPath = m_journalFile.Name();
+            m_journalFile.Close();
+            AZ::IO::SystemFile::Delete(journalPath.c_str());
+        }
+
+        m_journalSize = 0;
+        m_journalFailed = false;
+    }
+
     AZStd::string ScriptReporter::SeeConsole(uint32_t issueCount, const char* searchString)
     {
         if (issueCount == 0)
@@ -826,7 +1179,7 @@ namespace AtomSampleViewer
     {
         for (size_t i = 0; i < m_scriptReports.size(); ++i)
         {
-            const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTestInfos = m_scriptReports[i].m_screenshotTests;
+            const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTestInfos = LoadScriptReport(i).m_screenshotTests;
             for (size_t j = 0; j < screenshotTestInfos.size(); ++j)
             {
                 m_reportsSortedByOfficialBaslineScore.insert(AZStd::pair<float, ReportIndex>(
@@ -837,6 +1190,8 @@ namespace AtomSampleViewer
                     screenshotTestInfos[j].m_localComparisonResult.m_diffScore,
                     ReportIndex{ i, j }));
             }
+
+            TrimResidentScriptReports();
         }
     }
 
@@ -865,12 +1220,12 @@ namespace AtomSampleViewer
         }
     }
 
-    void ScriptReporter::ReportScreenshotComparisonIssue(const AZStd::string& message, const AZStd::string& expectedImageFilePath, const AZStd::string& actualImageFilePath, TraceLevel traceLevel)
+    void ScriptReporter::ReportScreenshotComparisonIssue(const AZStd::string& message, const AZ::Name& expectedImageFilePath, const AZ::Name& actualImageFilePath, TraceLevel traceLevel)
     {
         AZStd::string fullMessage = AZStd::string::format("%s\n    Expected: '%s'\n    Actual:   '%s'",
             message.c_str(),
-            expectedImageFilePath.c_str(),
-            actualImageFilePath.c_str());
+            expectedImageFilePath.GetCStr(),
+            actualImageFilePath.GetCStr());
 
         ReportScriptIssue(fullMessage, traceLevel);
     }
@@ -880,8 +1235,10 @@ namespace AtomSampleViewer
         int failureCount = 0;
         int successCount = 0;
 
-        for (ScriptReport& report : m_scriptReports)
+        for (size_t reportIndex = 0; reportIndex < m_scriptReports.size(); ++reportIndex)
         {
+            ScriptReport& report = LoadScriptReport(reportIndex);
+            report.m_journalOffset = ScriptReport::InvalidJournalOffset;
             for (ScreenshotTestInfo& screenshotTest : report.m_screenshotTests)
             {
                 if (UpdateLocalBaselineImage(screenshotTest, false))
@@ -893,6 +1250,8 @@ namespace AtomSampleViewer
                     failureCount++;
                 }
             }
+
+            TrimResidentScriptReports();
         }
 
         ShowUpdateLocalBaselineResult(successCount, failureCount);
@@ -900,7 +1259,7 @@ namespace AtomSampleViewer
     
     bool ScriptReporter::UpdateLocalBaselineImage(ScreenshotTestInfo& screenshotTest, bool showResultDialog)
     {
-        const AZStd::string destinationFile = screenshotTest.m_localBaselineScreenshotFilePath;
+        const AZStd::string destinationFile(screenshotTest.m_localBaselineScreenshotFilePath.GetStringView());
 
         AZStd::string destinationFolder = destinationFile;
         AzFramework::StringFunc::Path::StripFullName(destinationFolder);
@@ -913,10 +1272,10 @@ namespace AtomSampleViewer
             AZ_Error("ScriptReporter", false, "Failed to create folder '%s'.", destinationFolder.c_str());
         }
 
-        if (!AZ::IO::LocalFileIO::GetInstance()->Copy(screenshotTest.m_screenshotFilePath.c_str(), destinationFile.c_str()))
+        if (!AZ::IO::LocalFileIO::GetInstance()->Copy(screenshotTest.m_screenshotFilePath.GetCStr(), destinationFile.c_str()))
         {
             failed = true;
-            AZ_Error("ScriptReporter", false, "Failed to copy '%s' to '%s'.", screenshotTest.m_screenshotFilePath.c_str(), destinationFile.c_str());
+            AZ_Error("ScriptReporter", false, "Failed to copy '%s' to '%s'.", screenshotTest.m_screenshotFilePath.GetCStr(), destinationFile.c_str());
         }
 
         if (!failed)
@@ -955,7 +1314,7 @@ namespace AtomSampleViewer
         }
 
         // Get official cache baseline file
-        const AZStd::string cacheFilePath = screenshotTest.m_officialBaselineScreenshotFilePath;
+        const AZStd::string cacheFilePath(screenshotTest.m_officialBaselineScreenshotFilePath.GetStringView());
 
         // Divide cache file path into components to we can access the file name and the parent folder
         AZStd::fixed_vector<AZ::IO::FixedMaxPathString, 16> reversePathComponents;
@@ -981,10 +1340,10 @@ namespace AtomSampleViewer
         }
 
         // Replace source screenshot with new result
-        if (success && !io->Copy(screenshotTest.m_screenshotFilePath.c_str(), sourceFilePath.c_str()))
+        if (success && !io->Copy(screenshotTest.m_screenshotFilePath.GetCStr(), sourceFilePath.c_str()))
         {
             success = false;
-            AZ_Error("ScriptReporter", false, "Failed to copy '%s' to '%s'.", screenshotTest.m_screenshotFilePath.c_str(), sourceFilePath.c_str());
+            AZ_Error("ScriptReporter", false, "Failed to copy '%s' to '%s'.", screenshotTest.m_screenshotFilePath.GetCStr(), sourceFilePath.c_str());
         }
 
         if (success)
@@ -1068,110 +1427,208 @@ namespace AtomSampleViewer
 
         auto io = AZ::IO::LocalFileIO::GetInstance();
         screenshotTestInfo.m_toleranceLevel = *toleranceLevel;
-        static constexpr float ImperceptibleDiffFilter = 0.01;
 
-        if (screenshotTestInfo.m_officialBaselineScreenshotFilePath.empty()
-            || !io->Exists(screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str()))
+        ScreenshotComparisonEngine::Request request;
+        request.m_screenshotFilePath = screenshotTestInfo.m_screenshotFilePath.GetStringView();
+        request.m_minDiffFilter = ImperceptibleDiffFilter;
+        request.m_calcPerceptualScore = toleranceLevel->m_usePerceptualScore;
+
+        if (screenshotTestInfo.m_officialBaselineScreenshotFilePath.IsEmpty()
+            || !io->Exists(screenshotTestInfo.m_officialBaselineScreenshotFilePath.GetCStr()))
         {
-            ReportScriptError(AZStd::string::format("Screenshot check failed. Could not determine expected screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
+            ReportScriptError(AZStd::string::format("Screenshot check failed. Could not determine expected screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.GetCStr()));
             screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
         }
         else
         {
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
-                screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_officialBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+            request.m_officialBaselineFilePath = screenshotTestInfo.m_officialBaselineScreenshotFilePath.GetStringView();
+        }
 
-            screenshotTestInfo.m_officialComparisonResult.m_diffScore = 0.0;
+        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.IsEmpty()
+            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.GetCStr()))
+        {
+            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.GetCStr()));
+            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
+        }
+        else
+        {
+            request.m_localBaselineFilePath = screenshotTestInfo.m_localBaselineScreenshotFilePath.GetStringView();
+        }
 
-            if (compOutcome.IsSuccess())
-            {
-                screenshotTestInfo.m_officialComparisonResult.m_diffScore = toleranceLevel->m_filterImperceptibleDiffs
-                    ? compOutcome.GetValue().m_diffScore
-                    : compOutcome.GetValue().m_filteredDiffScore;
+        if (request.m_officialBaselineFilePath.empty() && request.m_localBaselineFilePath.empty())
+        {
+            return;
+        }
 
-                if (screenshotTestInfo.m_officialComparisonResult.m_diffScore <= toleranceLevel->m_threshold)
-                {
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
-                }
-                else
-                {
-                    // Be aware there is an automation test script that looks for the "Screenshot check failed. Diff score" string text to report failures.
-                    // If you change this message, be sure to update the associated tests as well located here: "C:/path/to/Lumberyard/AtomSampleViewer/Standalone/PythonTests"
-                    ReportScreenshotComparisonIssue(
-                        AZStd::string::format("Screenshot check failed. Diff score %f exceeds threshold of %f ('%s').",
-                            screenshotTestInfo.m_officialComparisonResult.m_diffScore, toleranceLevel->m_threshold, toleranceLevel->m_name.c_str()),
-                        screenshotTestInfo.m_officialBaselineScreenshotFilePath,
-                        screenshotTestInfo.m_screenshotFilePath,
-                        TraceLevel::Error);
-                    screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
-                }
+        PendingScreenshotCheck pendingCheck;
+        pendingCheck.m_reportIndex = ReportIndex{ m_currentScriptIndexStack.back(), GetCurrentScriptReport()->m_screenshotTests.size() - 1 };
+        pendingCheck.m_ticket = m_comparisonEngine.Submit(AZStd::move(request));
+        m_pendingScreenshotChecks.push_back(pendingCheck);
+    }
+
+    void ScriptReporter::TickScreenshotChecks()
+    {
+        // Results are recorded in submission order so failures are reported in the same order the screenshots were captured.
+        size_t completedCount = 0;
+        for (const PendingScreenshotCheck& pendingCheck : m_pendingScreenshotChecks)
+        {
+            ScreenshotComparisonEngine::Result result;
+            if (!m_comparisonEngine.TryTakeResult(pendingCheck.m_ticket, result))
+            {
+                break;
             }
+
+            // Reports with pending checks are never spilled
+            ScriptReport& scriptReport = m_scriptReports[pendingCheck.m_reportIndex.first];
+            AZ_Assert(!scriptReport.IsSpilled(), "Script reports with pending screenshot checks should stay in memory");
+
+            // With deferred checks the script that captured the screenshot may no longer be the active one. Temporarily route
+            // trace messages to the owning report so the failures are counted against the right script.
+            const size_t traceReportIndex = m_traceReportIndex;
+            SetTraceReportIndex(pendingCheck.m_reportIndex.first);
+
+            ApplyScreenshotComparisonResult(scriptReport.m_screenshotTests[pendingCheck.m_reportIndex.second], result);
+
+            SetTraceReportIndex(traceReportIndex);
+
+            ++completedCount;
         }
 
-        if (screenshotTestInfo.m_localBaselineScreenshotFilePath.empty()
-            || !io->Exists(screenshotTestInfo.m_localBaselineScreenshotFilePath.c_str()))
+        m_pendingScreenshotChecks.erase(m_pendingScreenshotChecks.begin(), m_pendingScreenshotChecks.begin() + completedCount);
+    }
+
+    void ScriptReporter::FlushScreenshotChecks()
+    {
+        m_comparisonEngine.WaitForAll();
+        TickScreenshotChecks();
+        AZ_Assert(m_pendingScreenshotChecks.empty(), "All screenshot checks should be complete after WaitForAll()");
+    }
+
+    bool ScriptReporter::HasPendingScreenshotChecks() const
+    {
+        return !m_pendingScreenshotChecks.empty();
+    }
+
+    size_t ScriptReporter::GetPendingScreenshotCheckCount() const
+    {
+        return m_pendingScreenshotChecks.size();
+    }
+
+    void ScriptReporter::ApplyScreenshotComparisonResult(ScreenshotTestInfo& screenshotTestInfo, const ScreenshotComparisonEngine::Result& result)
+    {
+        using Status = ScreenshotComparisonEngine::Outcome::Status;
+
+        auto toResultCode = [](Status status)
         {
-            ReportScriptWarning(AZStd::string::format("Screenshot check failed. Could not determine local baseline screenshot path for '%s'", screenshotTestInfo.m_screenshotFilePath.c_str()));
-            screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::FileNotFound;
+            switch (status)
+            {
+            case Status::FileNotLoaded:
+                return ImageComparisonResult::ResultCode::FileNotLoaded;
+            case Status::WrongSize:
+                return ImageComparisonResult::ResultCode::WrongSize;
+            case Status::WrongFormat:
+                return ImageComparisonResult::ResultCode::WrongFormat;
+            default:
+                return ImageComparisonResult::ResultCode::None;
+            }
+        };
+
+        const ImageComparisonToleranceLevel& toleranceLevel = screenshotTestInfo.m_toleranceLevel;
+
+        if (result.m_official.m_status == Status::Success)
+        {
+            if (toleranceLevel.m_usePerceptualScore)
+            {
+                screenshotTestInfo.m_officialComparisonResult.m_diffScore = result.m_official.m_scores.m_perceptualScore;
+            }
+            else
+            {
+                screenshotTestInfo.m_officialComparisonResult.m_diffScore = toleranceLevel.m_filterImperceptibleDiffs
+                    ? result.m_official.m_scores.m_diffScore
+                    : result.m_official.m_scores.m_filteredDiffScore;
+            }
+
+            if (screenshotTestInfo.m_officialComparisonResult.m_diffScore <= toleranceLevel.m_threshold)
+            {
+                screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+            }
+            else
+            {
+                // Be aware there is an automation test script that looks for the "Screenshot check failed. Diff score" string text to report failures.
+                // If you change this message, be sure to update the associated tests as well located here: "C:/path/to/Lumberyard/AtomSampleViewer/Standalone/PythonTests"
+                ReportScreenshotComparisonIssue(
+                    AZStd::string::format("Screenshot check failed. Diff score %f exceeds threshold of %f ('%s').",
+                        screenshotTestInfo.m_officialComparisonResult.m_diffScore, toleranceLevel.m_threshold, toleranceLevel.m_name.c_str()),
+                    screenshotTestInfo.m_officialBaselineScreenshotFilePath,
+                    screenshotTestInfo.m_screenshotFilePath,
+                    TraceLevel::Error);
+                screenshotTestInfo.m_officialComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
+            }
         }
-        else
+        else if (result.m_official.m_status != Status::NotRequested)
         {
-            // Local screenshots should be expected match 100% every time, otherwise warnings are reported. This will help developers track and investigate changes,
-            // for example if they make local changes that impact some unrelated AtomSampleViewer sample in an unexpected way, they will see a warning about this.
-            AZ::Render::FrameCaptureComparisonOutcome compOutcome;
-            AZ::Render::FrameCaptureTestRequestBus::BroadcastResult(
-                compOutcome,
-                &AZ::Render::FrameCaptureTestRequestBus::Events::CompareScreenshots,
+            screenshotTestInfo.m_officialComparisonResult.m_diffScore = 0.0f;
+            screenshotTestInfo.m_officialComparisonResult.m_resultCode = toResultCode(result.m_official.m_status);
+            ReportScreenshotComparisonIssue(
+                AZStd::string::format("Screenshot check failed. %s.", screenshotTestInfo.m_officialComparisonResult.GetSummaryString().c_str()),
+                screenshotTestInfo.m_officialBaselineScreenshotFilePath,
                 screenshotTestInfo.m_screenshotFilePath,
-                screenshotTestInfo.m_localBaselineScreenshotFilePath,
-                ImperceptibleDiffFilter
-            );
+                TraceLevel::Error);
+        }
 
-            screenshotTestInfo.m_localComparisonResult.m_diffScore = 0.0f;
+        if (result.m_local.m_status == Status::Success)
+        {
+            // Local screenshots should be expected match 100% every time, otherwise warnings are reported. This will help developers track and investigate changes,
+            // for example if they make local changes that impact some unrelated AtomSampleViewer sample in an unexpected way, they will see a warning about this.
+            screenshotTestInfo.m_localComparisonResult.m_diffScore = result.m_local.m_scores.m_diffScore;
 
-            if (compOutcome.IsSuccess())
+            if (screenshotTestInfo.m_localComparisonResult.m_diffScore == 0.0f)
             {
-                screenshotTestInfo.m_localComparisonResult.m_diffScore = compOutcome.GetValue().m_diffScore;
-
-                if (screenshotTestInfo.m_localComparisonResult.m_diffScore == 0.0f)
-                {
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
-                }
-                else
-                {
-                    ReportScreenshotComparisonIssue(
-                        AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", screenshotTestInfo.m_localComparisonResult.m_diffScore),
-                        screenshotTestInfo.m_localBaselineScreenshotFilePath,
-                        screenshotTestInfo.m_screenshotFilePath,
-                        TraceLevel::Warning);
-                    screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
-                }
+                screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::Pass;
+            }
+            else
+            {
+                ReportScreenshotComparisonIssue(
+                    AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; something has changed. Diff score is %f.", screenshotTestInfo.m_localComparisonResult.m_diffScore),
+                    screenshotTestInfo.m_localBaselineScreenshotFilePath,
+                    screenshotTestInfo.m_screenshotFilePath,
+                    TraceLevel::Warning);
+                screenshotTestInfo.m_localComparisonResult.m_resultCode = ImageComparisonResult::ResultCode::ThresholdExceeded;
             }
         }
+        else if (result.m_local.m_status != Status::NotRequested)
+        {
+            screenshotTestInfo.m_localComparisonResult.m_diffScore = 0.0f;
+            screenshotTestInfo.m_localComparisonResult.m_resultCode = toResultCode(result.m_local.m_status);
+            ReportScreenshotComparisonIssue(
+                AZStd::string::format("Screenshot check failed. Screenshot does not match the local baseline; %s.", screenshotTestInfo.m_localComparisonResult.GetSummaryString().c_str()),
+                screenshotTestInfo.m_localBaselineScreenshotFilePath,
+                screenshotTestInfo.m_screenshotFilePath,
+                TraceLevel::Warning);
+        }
     }
 
     void ScriptReporter::ExportTestResults()
     {
         m_exportedTestResultsPath = GenerateAndCreateExportedTestResultsPath();
-        for (const ScriptReport& scriptReport : m_scriptReports)
+
+        AZ::IO::HandleType logHandle;
+        auto io = AZ::IO::LocalFileIO::GetInstance();
+        if (io->Open(m_exportedTestResultsPath.c_str(), AZ::IO::OpenMode::ModeWrite, logHandle))
         {
-            const AZStd::string assertLogLine = AZStd::string::format("Asserts: %u \n", scriptReport.m_assertCount);
-            const AZStd::string errorsLogLine = AZStd::string::format("Errors: %u \n", scriptReport.m_generalErrorCount);
-            const AZStd::string warningsLogLine = AZStd::string::format("Warnings: %u \n", scriptReport.m_generalWarningCount);
-            const AZStd::string screenshotErrorsLogLine = AZStd::string::format("Screenshot errors: %u \n", scriptReport.m_screenshotErrorCount);
-            const AZStd::string screenshotWarningsLogLine = AZStd::string::format("Screenshot warnings: %u \n", scriptReport.m_screenshotWarningCount);
-            const AZStd::string failedScreenshotsLogLine = "\nScreenshot test info below.\n";
-            
-            AZ::IO::HandleType logHandle;
-            auto io = AZ::IO::LocalFileIO::GetInstance();
-            if (io->Open(m_exportedTestResultsPath.c_str(), AZ::IO::OpenMode::ModeWrite, logHandle))
+            for (size_t reportIndex = 0; reportIndex < m_scriptReports.size(); ++reportIndex)
             {
+                const ScriptReport& scriptReport = LoadScriptReport(reportIndex);
+
+                const AZStd::string scriptLogLine = AZStd::string::format("\nScript: %s%s \n", scriptReport.m_scriptAssetPath.GetCStr(), scriptReport.m_isCachedResult ? " (cached)" : "");
+                const AZStd::string assertLogLine = AZStd::string::format("Asserts: %u \n", scriptReport.m_assertCount);
+                const AZStd::string errorsLogLine = AZStd::string::format("Errors: %u \n", scriptReport.m_generalErrorCount);
+                const AZStd::string warningsLogLine = AZStd::string::format("Warnings: %u \n", scriptReport.m_generalWarningCount);
+                const AZStd::string screenshotErrorsLogLine = AZStd::string::format("Screenshot errors: %u \n", scriptReport.m_screenshotErrorCount);
+                const AZStd::string screenshotWarningsLogLine = AZStd::string::format("Screenshot warnings: %u \n", scriptReport.m_screenshotWarningCount);
+                const AZStd::string failedScreenshotsLogLine = "\nScreenshot test info below.\n";
+
+                io->Write(logHandle, scriptLogLine.c_str(), scriptLogLine.size());
                 io->Write(logHandle, assertLogLine.c_str(), assertLogLine.size());
                 io->Write(logHandle, errorsLogLine.c_str(), errorsLogLine.size());
                 io->Write(logHandle, warningsLogLine.c_str(), warningsLogLine.size());
@@ -1181,26 +1638,313 @@ namespace AtomSampleViewer
 
                 for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
                 {
-                    const AZStd::string screenshotPath = AZStd::string::format("Test screenshot path: %s \n", screenshotTest.m_screenshotFilePath.c_str());
-                    const AZStd::string officialBaselineScreenshotPath = AZStd::string::format("Official baseline screenshot path: %s \n", screenshotTest.m_officialBaselineScreenshotFilePath.c_str());
+                    const AZStd::string screenshotPath = AZStd::string::format("Test screenshot path: %s \n", screenshotTest.m_screenshotFilePath.GetCStr());
+                    const AZStd::string officialBaselineScreenshotPath = AZStd::string::format("Official baseline screenshot path: %s \n", screenshotTest.m_officialBaselineScreenshotFilePath.GetCStr());
                     const AZStd::string toleranceLevelLogLine = AZStd::string::format("Tolerance level: %s \n", screenshotTest.m_toleranceLevel.ToString().c_str());
                     const AZStd::string officialComparisonLogLine = AZStd::string::format("Image comparison result: %s \n", screenshotTest.m_officialComparisonResult.GetSummaryString().c_str());
 
+                    io->Write(logHandle, screenshotPath.c_str(), screenshotPath.size());
+                    io->Write(logHandle, officialBaselineScreenshotPath.c_str(), officialBaselineScreenshotPath.size());
                     io->Write(logHandle, toleranceLevelLogLine.c_str(), toleranceLevelLogLine.size());
                     io->Write(logHandle, officialComparisonLogLine.c_str(), officialComparisonLogLine.size());
                 }
-                io->Close(logHandle);
+
+                TrimResidentScriptReports();
             }
-            m_messageBox.OpenPopupMessage("Exported test results", AZStd::string::format("Results exported to %s", m_exportedTestResultsPath.c_str()));
-            AZ_Printf("Test results exported to %s \n", m_exportedTestResultsPath.c_str());
+            io->Close(logHandle);
+        }
+
+        if (m_testShardCount > 1)
+        {
+            // Every shard exports its results, and whichever finishes last merges them
+            ExportShardTestResults();
+            MergeShardTestResults();
         }
+
+        m_messageBox.OpenPopupMessage("Exported test results", AZStd::string::format("Results exported to %s", m_exportedTestResultsPath.c_str()));
+        AZ_Printf("ScriptReporter", "Test results exported to %s \n", m_exportedTestResultsPath.c_str());
+    }
+
+    void ScriptReporter::SetTestShard(uint32_t shardIndex, uint32_t shardCount, AZStd::string_view runId)
+    {
+        AZ_Assert(shardCount > 0 && shardIndex < shardCount, "Invalid test shard %u of %u", shardIndex, shardCount);
+        AZ_Assert(m_scriptReports.empty(), "The test shard can't change while reports are recorded");
+
+        // The journal is opened again with the shard's file name when it's needed
+        CloseJournal();
+        m_testShardIndex = shardIndex;
+        m_testShardCount = shardCount;
+        m_testShardRunId = runId;
+
+        if (m_testShardCount > 1 && m_testShardRunId.empty())
+        {
+            AZ_Warning("ScriptReporter", false, "Test shard %u of %u has no run id, its results won't be merged with the other shards. "
+                "Pass the same --testshardrunid to every shard.", m_testShardIndex + 1, m_testShardCount);
+            m_testShardRunId = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
+        }
+
+        // Results of an earlier run must not be merged with the results of this run
+        if (m_testShardCount > 1)
+        {
+            const AZStd::string shardResultsPath = GetShardTestResultsPath(m_testShardIndex);
+            if (AZ::IO::SystemFile::Exists(shardResultsPath.c_str()))
+            {
+                AZ::IO::SystemFile::Delete(shardResultsPath.c_str());
+            }
+        }
+    }
+
+    AZStd::string ScriptReporter::GetShardFileName(AZStd::string_view baseName, AZStd::string_view extension, uint32_t shardIndex, uint32_t shardCount)
+    {
+        if (shardCount <= 1)
+        {
+            return AZStd::string::format("%.*s%.*s", AZ_STRING_ARG(baseName), AZ_STRING_ARG(extension));
+        }
+
+        return AZStd::string::format("%.*s_shard%uof%u%.*s", AZ_STRING_ARG(baseName), shardIndex + 1, shardCount, AZ_STRING_ARG(extension));
+    }
+
+    AZStd::string ScriptReporter::GetShardTestResultsPath(uint32_t shardIndex) const
+    {
+        AZStd::string shardResultsPath;
+        AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), TestResultsFolder, shardResultsPath);
+        AzFramework::StringFunc::Path::Join(shardResultsPath.c_str(), ShardTestResultsFolder, shardResultsPath);
+        AzFramework::StringFunc::Path::Join(shardResultsPath.c_str(), GetShardFileName(ShardTestResultsBaseName, ".json", shardIndex, m_testShardCount).c_str(), shardResultsPath);
+        return shardResultsPath;
+    }
+
+    namespace ShardTestResults
+    {
+        // Each shard writes a JSON object with its run id, shard index and count, render API, a "summary" object and a "scripts" array.
+        // The merged file has the same layout, with the scripts of all shards.
+
+        using JsonWriter = Utils::JsonWriter;
+
+        void WriteSummary(JsonWriter& writer, const ScriptReporter::ScriptResultsSummary& summary, uint32_t scriptCount, uint32_t failedScriptCount)
+        {
+            writer.Key("summary");
+            writer.StartObject();
+            writer.Key("scripts");
+            writer.Uint(scriptCount);
+            writer.Key("failedScripts");
+            writer.Uint(failedScriptCount);
+            writer.Key("asserts");
+            writer.Uint(summary.m_totalAsserts);
+            writer.Key("errors");
+            writer.Uint(summary.m_totalErrors);
+            writer.Key("warnings");
+            writer.Uint(summary.m_totalWarnings);
+            writer.Key("screenshots");
+            writer.Uint(summary.m_totalScreenshotsCount);
+            writer.Key("screenshotFailures");
+            writer.Uint(summary.m_totalScreenshotsFailed);
+            writer.Key("screenshotWarnings");
+            writer.Uint(summary.m_totalScreenshotWarnings);
+            writer.EndObject();
+        }
+
+        uint32_t ReadUint(const rapidjson::Value& object, const char* name)
+        {
+            return object.HasMember(name) && object[name].IsUint() ? object[name].GetUint() : 0;
+        }
+
+        // Writes a temporary file and renames it, so other shards never read a partially written file
+        bool WriteFile(const AZStd::string& filePath, const rapidjson::StringBuffer& buffer)
+        {
+            const AZStd::string tempFilePath = filePath + ".tmp";
+            return Utils::WriteFile(tempFilePath, buffer.GetString(), buffer.GetSize()) &&
+                AZ::IO::SystemFile::Rename(tempFilePath.c_str(), filePath.c_str(), true);
+        }
+    } // namespace ShardTestResults
+
+    void ScriptReporter::ExportShardTestResults()
+    {
+        using namespace ShardTestResults;
+
+        rapidjson::StringBuffer buffer;
+        JsonWriter writer(buffer);
+
+        ScriptResultsSummary summary;
+        uint32_t failedScriptCount = 0;
+
+        writer.StartObject();
+        writer.Key("runId");
+        writer.String(m_testShardRunId.c_str());
+        writer.Key("shardIndex");
+        writer.Uint(m_testShardIndex);
+        writer.Key("shardCount");
+        writer.Uint(m_testShardCount);
+        writer.Key("renderApi");
+        writer.String(AZ::RHI::Factory::Get().GetName().GetCStr());
+
+        writer.Key("scripts");
+        writer.StartArray();
+        for (size_t reportIndex = 0; reportIndex < m_scriptReports.size(); ++reportIndex)
+        {
+            const ScriptReport& scriptReport = LoadScriptReport(reportIndex);
+
+            summary.m_totalAsserts += scriptReport.m_assertCount;
+            summary.m_totalErrors += scriptReport.m_generalErrorCount;
+            summary.m_totalWarnings += scriptReport.m_generalWarningCount;
+            summary.m_totalScreenshotsCount += aznumeric_cast<uint32_t>(scriptReport.m_screenshotTests.size());
+            summary.m_totalScreenshotsFailed += scriptReport.m_screenshotErrorCount;
+            summary.m_totalScreenshotWarnings += scriptReport.m_screenshotWarningCount;
+
+            const bool scriptPassed = scriptReport.m_assertCount == 0 && scriptReport.m_generalErrorCount == 0 && scriptReport.m_screenshotErrorCount == 0;
+            failedScriptCount += scriptPassed ? 0 : 1;
+
+            writer.StartObject();
+            writer.Key("path");
+            writer.String(scriptReport.m_scriptAssetPath.GetCStr());
+            writer.Key("passed");
+            writer.Bool(scriptPassed);
+            writer.Key("cached");
+            writer.Bool(scriptReport.m_isCachedResult);
+            writer.Key("asserts");
+            writer.Uint(scriptReport.m_assertCount);
+            writer.Key("errors");
+            writer.Uint(scriptReport.m_generalErrorCount);
+            writer.Key("warnings");
+            writer.Uint(scriptReport.m_generalWarningCount);
+            writer.Key("screenshotErrors");
+            writer.Uint(scriptReport.m_screenshotErrorCount);
+            writer.Key("screenshotWarnings");
+            writer.Uint(scriptReport.m_screenshotWarningCount);
+
+            writer.Key("screenshots");
+            writer.StartArray();
+            for (const ScreenshotTestInfo& screenshotTest : scriptReport.m_screenshotTests)
+            {
+                writer.StartObject();
+                writer.Key("path");
+                writer.String(screenshotTest.m_screenshotFilePath.GetCStr());
+                writer.Key("officialBaseline");
+                writer.String(screenshotTest.m_officialBaselineScreenshotFilePath.GetCStr());
+                writer.Key("toleranceLevel");
+                writer.String(screenshotTest.m_toleranceLevel.ToString().c_str());
+                writer.Key("result");
+                writer.String(screenshotTest.m_officialComparisonResult.GetSummaryString().c_str());
+                writer.Key("diffScore");
+                writer.Double(screenshotTest.m_officialComparisonResult.m_diffScore);
+                writer.EndObject();
+            }
+            writer.EndArray();
+
+            writer.EndObject();
+
+            TrimResidentScriptReports();
+        }
+        writer.EndArray();
+
+        WriteSummary(writer, summary, aznumeric_cast<uint32_t>(m_scriptReports.size()), failedScriptCount);
+        writer.EndObject();
+
+        const AZStd::string shardResultsPath = GetShardTestResultsPath(m_testShardIndex);
+        if (!WriteFile(shardResultsPath, buffer))
+        {
+            AZ_Error("ScriptReporter", false, "Failed to write shard test results '%s'", shardResultsPath.c_str());
+        }
+    }
+
+    bool ScriptReporter::MergeShardTestResults()
+    {
+        using namespace ShardTestResults;
+
+        // Shards that are still running haven't written their file yet
+        AZStd::vector<rapidjson::Document> shardDocuments(m_testShardCount);
+        for (uint32_t shardIndex = 0; shardIndex < m_testShardCount; ++shardIndex)
+        {
+            const AZStd::string shardResultsPath = GetShardTestResultsPath(shardIndex);
+            if (!AZ::IO::SystemFile::Exists(shardResultsPath.c_str()))
+            {
+                return false;
+            }
+
+            AZStd::string contents;
+            contents.resize(AZ::IO::SystemFile::Length(shardResultsPath.c_str()));
+            if (AZ::IO::SystemFile::Read(shardResultsPath.c_str(), contents.data(), contents.size()) != contents.size())
+            {
+                return false;
+            }
+
+            rapidjson::Document& document = shardDocuments[shardIndex];
+            document.Parse(contents.c_str(), contents.size());
+            if (document.HasParseError() || !document.IsObject() || ReadUint(document, "shardCount") != m_testShardCount ||
+                ReadUint(document, "shardIndex") != shardIndex || !document.HasMember("scripts") || !document["scripts"].IsArray() ||
+                !document.HasMember("summary") || !document["summary"].IsObject())
+            {
+                AZ_Warning("ScriptReporter", false, "Ignoring shard test results '%s' because they're not valid", shardResultsPath.c_str());
+                return false;
+            }
+
+            // Files left by an earlier run with the same shard count, or by a shard that hasn't finished this run yet
+            if (!document.HasMember("runId") || !document["runId"].IsString() || m_testShardRunId != document["runId"].GetString())
+            {
+                AZ_Warning("ScriptReporter", false, "Ignoring shard test results '%s' because they're not from this run", shardResultsPath.c_str());
+                return false;
+            }
+        }
+
+        rapidjson::StringBuffer buffer;
+        JsonWriter writer(buffer);
+
+        ScriptResultsSummary summary;
+        uint32_t scriptCount = 0;
+        uint32_t failedScriptCount = 0;
+
+        writer.StartObject();
+        writer.Key("runId");
+        writer.String(m_testShardRunId.c_str());
+        writer.Key("shardCount");
+        writer.Uint(m_testShardCount);
+        writer.Key("renderApi");
+        writer.String(AZ::RHI::Factory::Get().GetName().GetCStr());
+
+        writer.Key("scripts");
+        writer.StartArray();
+        for (const rapidjson::Document& document : shardDocuments)
+        {
+            for (const rapidjson::Value& script : document["scripts"].GetArray())
+            {
+                script.Accept(writer);
+            }
+
+            const rapidjson::Value& shardSummary = document["summary"];
+            scriptCount += ReadUint(shardSummary, "scripts");
+            failedScriptCount += ReadUint(shardSummary, "failedScripts");
+            summary.m_totalAsserts += ReadUint(shardSummary, "asserts");
+            summary.m_totalErrors += ReadUint(shardSummary, "errors");
+            summary.m_totalWarnings += ReadUint(shardSummary, "warnings");
+            summary.m_totalScreenshotsCount += ReadUint(shardSummary, "screenshots");
+            summary.m_totalScreenshotsFailed += ReadUint(shardSummary, "screenshotFailures");
+            summary.m_totalScreenshotWarnings += ReadUint(shardSummary, "screenshotWarnings");
+        }
+        writer.EndArray();
+
+        WriteSummary(writer, summary, scriptCount, failedScriptCount);
+        writer.EndObject();
+
+        AZStd::string mergedResultsPath;
+        AzFramework::StringFunc::Path::Join(AZ::Utils::GetProjectPath().c_str(), TestResultsFolder, mergedResultsPath);
+        AzFramework::StringFunc::Path::Join(mergedResultsPath.c_str(), ShardTestResultsFolder, mergedResultsPath);
+        AzFramework::StringFunc::Path::Join(mergedResultsPath.c_str(), MergedTestResultsFileName, mergedResultsPath);
+        if (!WriteFile(mergedResultsPath, buffer))
+        {
+            AZ_Error("ScriptReporter", false, "Failed to write merged test results '%s'", mergedResultsPath.c_str());
+            return false;
+        }
+
+        AZ_Printf("ScriptReporter", "Merged the results of %u shards to %s: %u scripts, %u failed, %u asserts, %u errors, %u of %u screenshots failed\n",
+            m_testShardCount, mergedResultsPath.c_str(), scriptCount, failedScriptCount, summary.m_totalAsserts, summary.m_totalErrors,
+            summary.m_totalScreenshotsFailed, summary.m_totalScreenshotsCount);
+        return true;
     }
 
     void ScriptReporter::ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTestInfo)
     {
         using namespace AZ::Utils;
-        PngFile officialBaseline = PngFile::Load(screenshotTestInfo.m_officialBaselineScreenshotFilePath.c_str());
-        PngFile actualScreenshot = PngFile::Load(screenshotTestInfo.m_screenshotFilePath.c_str());
+        PngFile officialBaseline = PngFile::Load(screenshotTestInfo.m_officialBaselineScreenshotFilePath.GetCStr());
+        PngFile actualScreenshot = PngFile::Load(screenshotTestInfo.m_screenshotFilePath.GetCStr());
 
         const size_t bufferSize = officialBaseline.GetBuffer().size();
 
@@ -1227,7 +1971,8 @@ namespace AtomSampleViewer
     {
         // Setup our variables for the exported test results path and .txt file.
         const auto projectPath = AZ::Utils::GetProjectPath();
-        const AZStd::string exportFileName = AZStd::string::format("exportedTestResults_%s.txt", m_uniqueTimestamp.c_str());
+        const AZStd::string exportFileName = GetShardFileName(
+            AZStd::string::format("exportedTestResults_%s", m_uniqueTimestamp.c_str()), ".txt", m_testShardIndex, m_testShardCount);
         AZStd::string exportTestResultsFolder;
         AzFramework::StringFunc::Path::Join(projectPath.c_str(), TestResultsFolder, exportTestResultsFolder);
 
@@ -1242,23 +1987,47 @@ namespace AtomSampleViewer
 
     void ScriptReporter::GenerateImageDiff(AZStd::span<const uint8_t> img1, AZStd::span<const uint8_t> img2, AZStd::vector<uint8_t>& buffer)
     {
-        static constexpr size_t BytesPerPixel = 4;
+        static constexpr size_t BytesPerPixel = ImageDiff::BytesPerPixel;
         static constexpr float MinDiffFilter = 0.01;
         static constexpr uint8_t DefaultPixelValue = 122;
 
+        // Pixels are compared in runs of this many, and runs that match exactly are left at the default color
+        static constexpr size_t PixelsPerRun = ImageDiff::TileSize * ImageDiff::TileSize;
+
+        AZ_Assert(img1.size() == img2.size() && buffer.size() >= img1.size(), "Image buffers do not match");
+        const size_t pixelCount = AZStd::min(img1.size(), img2.size()) / BytesPerPixel;
+        const uint32_t minPerceptibleDiff = ImageDiff::CalcMinPerceptibleDiff(MinDiffFilter);
+
         memset(buffer.data(), DefaultPixelValue, buffer.size() * sizeof(uint8_t));
+        for (size_t i = 3; i < buffer.size(); i += BytesPerPixel)
+        {
+            buffer[i] = 255;
+        }
 
-        for (size_t i = 0; i < img1.size(); i += BytesPerPixel)
+        AZStd::vector<uint8_t> maxDiffs;
+        for (size_t firstPixel = 0; firstPixel < pixelCount; firstPixel += PixelsPerRun)
         {
-            const int16_t maxDiff = AZ::Utils::CalcMaxChannelDifference(img1, img2, i);
+            const size_t runPixelCount = AZStd::min(PixelsPerRun, pixelCount - firstPixel);
+            const uint8_t* pixels1 = img1.data() + firstPixel * BytesPerPixel;
+            const uint8_t* pixels2 = img2.data() + firstPixel * BytesPerPixel;
+            if (memcmp(pixels1, pixels2, runPixelCount * BytesPerPixel) == 0)
+            {
+                continue;
+            }
+
+            maxDiffs.resize(runPixelCount);
+            ImageDiff::CalcMaxChannelDiffs(pixels1, pixels2, runPixelCount, maxDiffs.data());
 
-            if (maxDiff / 255.0f > MinDiffFilter)
+            for (size_t i = 0; i < runPixelCount; ++i)
             {
-                buffer[i] = aznumeric_cast<uint8_t>(maxDiff);
-                buffer[i + 1] = 0;
-                buffer[i + 2] = 0;
+                if (maxDiffs[i] >= minPerceptibleDiff)
+                {
+                    uint8_t* pixel = buffer.data() + (firstPixel + i) * BytesPerPixel;
+                    pixel[0] = maxDiffs[i];
+                    pixel[1] = 0;
+                    pixel[2] = 0;
+                }
             }
-            buffer[i + 3] = 255;
         }
     }
 
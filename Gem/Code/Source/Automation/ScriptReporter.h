@@ -9,11 +9,15 @@
 #pragma once
 
 #include <AzCore/Debug/TraceMessageBus.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Atom/Feature/Utils/FrameCaptureBus.h>
 #include <Atom/Feature/Utils/FrameCaptureTestBus.h>
 #include <Atom/Utils/ImageComparison.h>
 #include <Automation/ImageComparisonConfig.h>
+#include <Automation/ScreenshotComparisonEngine.h>
 #include <Utils/ImGuiMessageBox.h>
 #include <Atom/Utils/PngFile.h>
 #include <imgui/imgui.h>
@@ -24,7 +28,10 @@ namespace AtomSampleViewer
 
     //! Collects data about each script run by the ScriptManager.
     //! This includes counting errors, checking screenshots, and providing a final report dialog.
+    //! To keep memory bounded during long test suites, the screenshot results of completed scripts are moved to a journal
+    //! file once more than GetMaxResidentScriptReports() reports are in memory, and loaded back by LoadScriptReport() when needed.
     class ScriptReporter
+        : private AZ::Debug::TraceMessageBus::Handler
     {
     public:
         // currently set to track the ScriptReport index and the ScreenshotTestInfo index.
@@ -32,6 +39,13 @@ namespace AtomSampleViewer
 
         static constexpr const char* TestResultsFolder = "TestResults";
         static constexpr const char* UserFolder = "user";
+        static constexpr const char* JournalFileBaseName = "scriptReportJournal";
+        static constexpr const char* ShardTestResultsFolder = "Shards";
+        static constexpr const char* ShardTestResultsBaseName = "testResults";
+        static constexpr const char* MergedTestResultsFileName = "mergedTestResults.json";
+        static constexpr size_t DefaultMaxResidentScriptReports = 64;
+
+        ~ScriptReporter();
 
         //! Set the list of available tolerance levels, so the report can suggest an alternate level that matches the actual results.
         void SetAvailableToleranceLevels(const AZStd::vector<ImageComparisonToleranceLevel>& toleranceLevels);
@@ -52,6 +66,11 @@ namespace AtomSampleViewer
         //! Any subsequent errors will be included as part of the prior script's report.
         void PopScript();
 
+        //! Adds the report of a script that didn't run because the results of a previous run are still valid (see IncrementalTestCache).
+        //! The report is complete when it's added, and is marked as cached in the report dialog.
+        void AddCachedScriptReport(const AZStd::string& scriptAssetPath, uint32_t generalWarningCount, uint32_t screenshotWarningCount,
+            AZStd::vector<ScreenshotTestInfo> screenshotTests);
+
         //! Returns whether there are active processing scripts (i.e. more PushScript() calls than PopScript() calls)
         bool HasActiveScript() const;
 
@@ -59,8 +78,22 @@ namespace AtomSampleViewer
         bool AddScreenshotTest(const AZStd::string& imageName);
 
         //! Check the latest screenshot using default thresholds.
+        //! The comparison runs on the job system; the result is recorded by a later call to TickScreenshotChecks() or FlushScreenshotChecks().
         void CheckLatestScreenshot(const ImageComparisonToleranceLevel* comparisonPreset);
 
+        //! Records the results of any screenshot comparisons that finished since the last call. Called every frame.
+        //! Results are always attributed to the script that captured the screenshot, even if another script is active by now.
+        void TickScreenshotChecks();
+
+        //! Blocks until all pending screenshot comparisons are finished and records their results.
+        void FlushScreenshotChecks();
+
+        //! Returns true while screenshot comparisons started by CheckLatestScreenshot() are still running.
+        bool HasPendingScreenshotChecks() const;
+
+        //! Returns the number of screenshot comparisons whose results haven't been recorded yet.
+        size_t GetPendingScreenshotCheckCount() const;
+
         //! Opens the script report dialog.
         //! This displays all the collected script reporting data, provides links to tools for analyzing data like
         //! viewing screenshot diffs. It can be left open during processing and will update in real-time.
@@ -114,66 +147,32 @@ namespace AtomSampleViewer
         };
 
         //! Records all the information about a screenshot comparison test.
+        //! The paths are interned since long test suites capture the same screenshots over and over.
         struct ScreenshotTestInfo
         {
-            AZStd::string m_screenshotFilePath;                 //!< The full path where the screenshot will be generated.
-            AZStd::string m_officialBaselineScreenshotFilePath; //!< The full path to the official baseline image that is checked into source control
-            AZStd::string m_localBaselineScreenshotFilePath;    //!< The full path to a local baseline image that was established by the user
+            AZ::Name m_screenshotFilePath;                      //!< The full path where the screenshot will be generated.
+            AZ::Name m_officialBaselineScreenshotFilePath;      //!< The full path to the official baseline image that is checked into source control
+            AZ::Name m_localBaselineScreenshotFilePath;         //!< The full path to a local baseline image that was established by the user
             ImageComparisonToleranceLevel m_toleranceLevel;     //!< Tolerance for checking against the official baseline image
             ImageComparisonResult m_officialComparisonResult;   //!< Result of comparing against the official baseline image, for reporting test failure
             ImageComparisonResult m_localComparisonResult;      //!< Result of comparing against a local baseline, for reporting warnings
 
+            ScreenshotTestInfo() = default;
             ScreenshotTestInfo(const AZStd::string& m_screenshotName);
         };
 
         //! Records all the information about a single test script.
-        struct ScriptReport : public AZ::Debug::TraceMessageBus::Handler
+        //! Trace messages are counted by the ScriptReporter, which forwards them to the report of the active script.
+        struct ScriptReport
         {
-            ScriptReport()
-            {
-                AZ::Debug::TraceMessageBus::Handler::BusConnect();
-            }
+            static constexpr uint64_t InvalidJournalOffset = AZStd::numeric_limits<uint64_t>::max();
 
-            ~ScriptReport()
-            {
-                AZ::Debug::TraceMessageBus::Handler::BusDisconnect();
-            }
+            //! Returns true when m_screenshotTests was moved to the journal. Use ScriptReporter::LoadScriptReport() to load it.
+            bool IsSpilled() const { return m_isSpilled; }
 
-            bool OnPreAssert(const char* /*fileName*/, int /*line*/, const char* /*func*/, [[maybe_unused]] const char* message) override
-            {
-                ++m_assertCount;
-                return false;
-            }
-
-            bool OnPreError(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* message) override
-            {
-                if (AZStd::string::npos == AzFramework::StringFunc::Find(message, "Screenshot check failed"))
-                {
-                    ++m_generalErrorCount;
-                }
-                else
-                {
-                    ++m_screenshotErrorCount;
-                }
-
-                return false;
-            }
-
-            bool OnPreWarning(const char* /*window*/, const char* /*fileName*/, int /*line*/, const char* /*func*/, const char* message) override
-            {
-                if (AZStd::string::npos == AzFramework::StringFunc::Find(message, "Screenshot does not match the local baseline"))
-                {
-                    ++m_generalWarningCount;
-                }
-                else
-                {
-                    ++m_screenshotWarningCount;
-                }
-
-                return false;
-            }
+            size_t GetScreenshotTestCount() const { return m_isSpilled ? m_spilledScreenshotTestCount : m_screenshotTests.size(); }
 
-            AZStd::string m_scriptAssetPath;
+            AZ::Name m_scriptAssetPath;
 
             uint32_t m_assertCount = 0;
 
@@ -184,11 +183,44 @@ namespace AtomSampleViewer
             uint32_t m_screenshotWarningCount = 0;
 
             AZStd::vector<ScreenshotTestInfo> m_screenshotTests;
+
+            //! The script was skipped and these results were copied from a previous run
+            bool m_isCachedResult = false;
+
+            //! Location of the last copy of m_screenshotTests written to the journal, or InvalidJournalOffset if the
+            //! screenshot tests changed since then.
+            uint64_t m_journalOffset = InvalidJournalOffset;
+            size_t m_spilledScreenshotTestCount = 0;
+            bool m_isSpilled = false;
         };
 
+        //! Returns all the reports. The screenshot tests of spilled reports are empty, use LoadScriptReport() to access them.
         const AZStd::vector<ScriptReport>& GetScriptReport() const { return m_scriptReports; }
 
-        // For exporting test results
+        //! Returns the report at the given index, loading its screenshot tests from the journal if they were spilled.
+        //! Loaded reports stay in memory while the report dialog is open, and are spilled again on a later frame otherwise.
+        ScriptReport& LoadScriptReport(size_t reportIndex);
+
+        //! Sets how many reports keep their screenshot tests in memory. Reports of active scripts and reports waiting for
+        //! screenshot checks are never spilled.
+        void SetMaxResidentScriptReports(size_t maxResidentScriptReports);
+        size_t GetMaxResidentScriptReports() const { return m_maxResidentScriptReports; }
+
+        //! Sets which part of the test suite this process runs, when the suite is split across several processes.
+        //! The journal and exported results of each shard get their own file names. Must be called while no reports are recorded.
+        //! All shards of a run must pass the same runId, and only results with that id are merged. Without one, a new id is
+        //! generated and the results of this shard are never merged with other shards.
+        void SetTestShard(uint32_t shardIndex, uint32_t shardCount, AZStd::string_view runId = {});
+        uint32_t GetTestShardIndex() const { return m_testShardIndex; }
+        uint32_t GetTestShardCount() const { return m_testShardCount; }
+        const AZStd::string& GetTestShardRunId() const { return m_testShardRunId; }
+
+        //! Returns "<baseName><extension>", with a "_shard<N>of<Count>" suffix (1-based) on the base name when shardCount > 1.
+        static AZStd::string GetShardFileName(AZStd::string_view baseName, AZStd::string_view extension, uint32_t shardIndex, uint32_t shardCount);
+
+        // For exporting test results.
+        // In a sharded run this also writes the shard's results as JSON, and once every shard has done so, merges them into
+        // a single mergedTestResults.json in the TestResults/Shards folder.
         void ExportTestResults();
         void ExportImageDiff(const char* filePath, const ScreenshotTestInfo& screenshotTest);
         AZStd::string ExportImageDiff(const ScriptReport& scriptReport, const ScreenshotTestInfo& screenshotTest);
@@ -196,6 +228,8 @@ namespace AtomSampleViewer
         void SortScriptReports();
 
     private:
+        static constexpr size_t InvalidReportIndex = AZStd::numeric_limits<size_t>::max();
+
         static const ImGuiTreeNodeFlags FlagDefaultOpen = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_DefaultOpen;
         static const ImGuiTreeNodeFlags FlagDefaultClosed = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
 
@@ -227,7 +261,27 @@ namespace AtomSampleViewer
         static void ReportScriptError(const AZStd::string& message);
         static void ReportScriptWarning(const AZStd::string& message);
         static void ReportScriptIssue(const AZStd::string& message, TraceLevel traceLevel);
-        static void ReportScreenshotComparisonIssue(const AZStd::string& message, const AZStd::string& expectedImageFilePath, const AZStd::string& actualImageFilePath, TraceLevel traceLevel);
+        static void ReportScreenshotComparisonIssue(const AZStd::string& message, const AZ::Name& expectedImageFilePath, const AZ::Name& actualImageFilePath, TraceLevel traceLevel);
+
+        // AZ::Debug::TraceMessageBus::Handler overrides, counted against the report at m_traceReportIndex
+        bool OnPreAssert(const char* fileName, int line, const char* func, const char* message) override;
+        bool OnPreError(const char* window, const char* fileName, int line, const char* func, const char* message) override;
+        bool OnPreWarning(const char* window, const char* fileName, int line, const char* func, const char* message) override;
+
+        // Routes trace messages to the given report, or stops listening for InvalidReportIndex
+        void SetTraceReportIndex(size_t reportIndex);
+
+        // Moves the screenshot tests of the oldest completed reports to the journal until at most m_maxResidentScriptReports are left in memory
+        void TrimResidentScriptReports();
+        bool CanSpillScriptReport(size_t reportIndex) const;
+        bool SpillScriptReport(ScriptReport& scriptReport);
+        bool OpenJournal();
+        void CloseJournal();
+
+        AZStd::string GetShardTestResultsPath(uint32_t shardIndex) const;
+        void ExportShardTestResults();
+        // Returns false if some shards haven't exported their results yet
+        bool MergeShardTestResults();
 
         // Copies all captured screenshots to the local baseline folder. These can be used as an alternative to the central baseline for comparison.
         void UpdateAllLocalBaselineImages();
@@ -238,6 +292,9 @@ namespace AtomSampleViewer
         // Copies a single captured screenshot to the official baseline source folder.
         bool UpdateSourceBaselineImage(ScreenshotTestInfo& screenshotTest, bool showResultDialog);
 
+        // Records the result of a finished comparison and reports any failures against the active script
+        void ApplyScreenshotComparisonResult(ScreenshotTestInfo& screenshotTestInfo, const ScreenshotComparisonEngine::Result& result);
+
         // Clears comparison result to passing with no errors or warnings
         void ClearImageComparisonResult(ImageComparisonResult& comparisonResult);
 
@@ -247,8 +304,8 @@ namespace AtomSampleViewer
         const ImageComparisonToleranceLevel* FindBestToleranceLevel(float diffScore, bool filterImperceptibleDiffs) const;
 
         void ShowReportDialog();
-        void ShowScreenshotTestInfoTreeNode(const AZStd::string& header, ScriptReport& scriptReport, ScreenshotTestInfo& screenshotResult);
-        void ShowDiffButton(const char* buttonLabel, const AZStd::string& imagePathA, const AZStd::string& imagePathB);
+        void ShowScreenshotTestInfoTreeNode(const AZStd::string& header, ReportIndex reportIndex);
+        void ShowDiffButton(const char* buttonLabel, const AZ::Name& imagePathA, const AZ::Name& imagePathB);
 
         // Generates a path to the exported test results file.
         AZStd::string GenerateTimestamp() const;
@@ -284,10 +341,30 @@ namespace AtomSampleViewer
         ImGuiMessageBox m_messageBox;
 
         AZStd::vector<ImageComparisonToleranceLevel> m_availableToleranceLevels;
+
+        // Screenshot comparisons that were submitted to m_comparisonEngine and whose results haven't been recorded yet
+        struct PendingScreenshotCheck
+        {
+            ReportIndex m_reportIndex;
+            ScreenshotComparisonEngine::Ticket m_ticket = ScreenshotComparisonEngine::InvalidTicket;
+        };
+
+        ScreenshotComparisonEngine m_comparisonEngine;
+        AZStd::vector<PendingScreenshotCheck> m_pendingScreenshotChecks;
         AZStd::string m_invalidationMessage;
 
         AZStd::vector<ScriptReport> m_scriptReports; //< Tracks errors for the current active script
         AZStd::vector<size_t> m_currentScriptIndexStack; //< Tracks which of the scripts in m_scriptReports is currently active
+        size_t m_traceReportIndex = InvalidReportIndex; //< The report that trace messages are counted against
+
+        AZStd::vector<size_t> m_residentReportIndices; //< Reports whose screenshot tests are in memory, oldest first
+        size_t m_maxResidentScriptReports = DefaultMaxResidentScriptReports;
+        AZ::IO::SystemFile m_journalFile;
+        uint64_t m_journalSize = 0;
+        bool m_journalFailed = false;
+        uint32_t m_testShardIndex = 0;
+        uint32_t m_testShardCount = 1;
+        AZStd::string m_testShardRunId;
         bool m_showReportDialog = false;
         bool m_colorHasBeenSet = false;
         DisplayOption m_displayOption = DisplayOption::AllResults;
@@ -304,4 +381,37 @@ namespace AtomSampleViewer
         bool m_showWarnings;
     };
 
+    //! Binary serialization of screenshot test results, used by the report journal and the IncrementalTestCache.
+    //! Values are written in native byte order. Strings are written as a uint32 length followed by the characters.
+    namespace ScriptReportJournal
+    {
+        template<typename T>
+        void Write(AZStd::vector<uint8_t>& buffer, const T& value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(AZStd::span<const uint8_t>& data, T& value)
+        {
+            if (data.size() < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, data.data(), sizeof(T));
+            data = data.subspan(sizeof(T));
+            return true;
+        }
+
+        void WriteString(AZStd::vector<uint8_t>& buffer, AZStd::string_view value);
+        bool ReadString(AZStd::span<const uint8_t>& data, AZStd::string_view& value);
+
+        //! Appends a uint64 byte count followed by the screenshot tests.
+        void WriteScreenshotTests(AZStd::vector<uint8_t>& buffer, const AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTests);
+
+        //! Reads the screenshot tests that followed the byte count. Fails unless the data is used exactly.
+        bool ReadScreenshotTests(AZStd::span<const uint8_t> data, size_t screenshotTestCount, AZStd::vector<ScriptReporter::ScreenshotTestInfo>& screenshotTests);
+    } // namespace ScriptReportJournal
+
 } // namespace AtomSampleViewer
@@ -69,7 +69,7 @@ namespace AtomSampleViewer
                 return false;
             }
             return assetInfo.m_assetId.m_subId == 0;
-        });
+        }, AssetCatalogIndex::Scope::ForExtension("azmaterial"));
         m_materialBrowser.Activate();
 
         Data::AssetId modelAssetId;
@@ -79,7 +79,7 @@ namespace AtomSampleViewer
             }
 
             return true;
-        });
+        }, AssetCatalogIndex::Scope::ForExtension("streamingimage"));
         m_imageBrowser.Activate();
 
         // Load a default image
@@ -10,6 +10,7 @@
 #include <SampleComponentConfig.h>
 
 #include <Automation/ScriptableImGui.h>
+#include <Utils/JsonFile.h>
 #include <Atom/Component/DebugCamera/CameraControllerBus.h>
 #include <Atom/Component/DebugCamera/NoClipControllerComponent.h>
 #include <Atom/Component/DebugCamera/NoClipControllerBus.h>
@@ -76,17 +77,21 @@ namespace AtomSampleViewer
         SaveCameraConfiguration();
         ResetNoClipController();        
 
+        m_cullingStats.Activate(RPI::Scene::GetSceneForEntityContextId(GetEntityContextId()));
+
         SetupScene();
 
         m_imguiSidebar.Activate();
 
         TickBus::Handler::BusConnect();
+        CullingAndLodExampleRequestBus::Handler::BusConnect();
     }
 
     void CullingAndLodExampleComponent::Deactivate()
     {
         using namespace AZ;
 
+        CullingAndLodExampleRequestBus::Handler::BusDisconnect();
         TickBus::Handler::BusDisconnect();
 
         m_imguiSidebar.Deactivate();
@@ -99,6 +104,8 @@ namespace AtomSampleViewer
 
         m_directionalLightFeatureProcessor->ReleaseLight(m_directionalLightHandle);
         UpdateDiskLightCount(0);
+
+        m_cullingStats.Deactivate();
     }
 
     void CullingAndLodExampleComponent::OnTick(float deltaTime, AZ::ScriptTimePoint timePoint)
@@ -108,6 +115,8 @@ namespace AtomSampleViewer
 
         using namespace AZ;
 
+        m_cullingStats.Update();
+
         DrawSidebar();
 
         // Pass camera data to the DirectionalLightFeatureProcessor
@@ -123,6 +132,54 @@ namespace AtomSampleViewer
         }
     }
 
+    bool CullingAndLodExampleComponent::WriteCullingStatistics(const AZStd::string& filePath)
+    {
+        const CullingLodStatistics::FrameStats& frameStats = m_cullingStats.GetFrameStats();
+
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("gridSizeX");
+                writer.Uint(m_gridSizeX);
+                writer.Key("gridSizeY");
+                writer.Uint(m_gridSizeY);
+                writer.Key("diskLights");
+                writer.Int(m_diskLightCount);
+                writer.Key("cullables");
+                writer.Uint(frameStats.m_cullableCount);
+                writer.Key("views");
+                writer.StartArray();
+                for (const CullingLodStatistics::ViewStats& viewStats : frameStats.m_views)
+                {
+                    writer.StartObject();
+                    writer.Key("name");
+                    writer.String(viewStats.m_name.c_str());
+                    writer.Key("visibleObjects");
+                    writer.Uint(viewStats.m_visibleObjectCount);
+                    writer.Key("culledObjects");
+                    writer.Uint(viewStats.m_culledObjectCount);
+                    writer.Key("visibleDrawPackets");
+                    writer.Uint(viewStats.m_visibleDrawPacketCount);
+                    writer.Key("cullJobs");
+                    writer.Uint(viewStats.m_cullJobCount);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+                writer.Key("objects");
+                writer.Uint(frameStats.m_objectCount);
+                writer.Key("objectsInMainView");
+                writer.Uint(frameStats.m_objectsInFrustumCount);
+                writer.Key("estimatedLodHistogram");
+                writer.StartArray();
+                for (uint32_t lodObjectCount : frameStats.m_lodHistogram)
+                {
+                    writer.Uint(lodObjectCount);
+                }
+                writer.EndArray();
+                writer.EndObject();
+            });
+    }
+
     void CullingAndLodExampleComponent::ResetNoClipController()
     {
         using namespace AZ;
@@ -181,6 +238,13 @@ namespace AtomSampleViewer
 
         float spacing = 2.0f*objectModelAsset->GetAabb().GetExtents().GetMaxElement();
 
+        // The statistics only track the grid objects, the plane is always visible and has a single LOD
+        CullingLodStatistics::Object statsObject;
+        statsObject.m_radius = 0.5f * objectModelAsset->GetAabb().GetExtents().GetLength();
+        statsObject.m_lodCount = aznumeric_cast<uint32_t>(objectModelAsset->GetLodAssets().size());
+        AZStd::vector<CullingLodStatistics::Object> statsObjects;
+        statsObjects.reserve(numAlongXAxis * numAlongYAxis);
+
         for (uint32_t x = 0; x < numAlongXAxis; ++x)
         {
             for (uint32_t y = 0; y < numAlongYAxis; ++y)
@@ -189,9 +253,16 @@ namespace AtomSampleViewer
                 Transform modelToWorld = Transform::CreateTranslation(Vector3(x * spacing, y * spacing, 2.0f));
                 meshFP->SetTransform(meshHandle, modelToWorld);
                 m_meshHandles.push_back(AZStd::move(meshHandle));
+
+                statsObject.m_center = modelToWorld.TransformPoint(objectModelAsset->GetAabb().GetCenter());
+                statsObjects.push_back(statsObject);
             }
         }
 
+        m_gridSizeX = numAlongXAxis;
+        m_gridSizeY = numAlongYAxis;
+        m_cullingStats.SetObjects(AZStd::move(statsObjects));
+
         auto planeMeshHandle = meshFP->AcquireMesh(Render::MeshHandleDescriptor(planeModelAsset, material));
         Vector3 planeNonUniformScale(numAlongXAxis * spacing, numAlongYAxis * spacing, 1.0f);
         Transform planeModelToWorld = Transform::CreateTranslation(Vector3(0.5f * numAlongXAxis * spacing, 0.5f * numAlongYAxis * spacing, 0.0f));
@@ -308,15 +379,15 @@ namespace AtomSampleViewer
 
         ImGui::Spacing();
 
-        if (ImGui::Button("Spawn 20x20 Grid of objects"))
+        if (ScriptableImGui::Button("Spawn 20x20 Grid of objects"))
         {
             SpawnModelsIn2DGrid(20, 20);
         }
-        if (ImGui::Button("Spawn 50x50 Grid of objects"))
+        if (ScriptableImGui::Button("Spawn 50x50 Grid of objects"))
         {
             SpawnModelsIn2DGrid(50, 50);
         }
-        if (ImGui::Button("Spawn 100x100 Grid of objects"))
+        if (ScriptableImGui::Button("Spawn 100x100 Grid of objects"))
         {
             SpawnModelsIn2DGrid(100, 100);
         }
@@ -412,7 +483,7 @@ namespace AtomSampleViewer
         ImGui::Indent();
         {
             int diskLightCount = m_diskLightCount;
-            if (ImGui::SliderInt("Number", &diskLightCount, 0, DiskLightCountMax))
+            if (ScriptableImGui::SliderInt("Number", &diskLightCount, 0, DiskLightCountMax))
             {
                 UpdateDiskLightCount(static_cast<uint16_t>(diskLightCount));
             }
@@ -448,6 +519,17 @@ namespace AtomSampleViewer
         }
         ImGui::Unindent();
 
+        ImGui::Separator();
+
+        ImGui::Text("Culling Statistics");
+        ImGui::Indent();
+        {
+            m_cullingStats.DrawImGui();
+        }
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
         // For automated screenshot verification testing: force the camera transform and turn on the debug window so the cull stats show up in the screenshot(s)
         if (ScriptableImGui::Button("Begin Verification"))
         {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <CommonSampleComponentBase.h>
+#include <CullingAndLodExampleBus.h>
 #include <Atom/Feature/CoreLights/DirectionalLightFeatureProcessorInterface.h>
 #include <Atom/Feature/CoreLights/DiskLightFeatureProcessorInterface.h>
 #include <Atom/Feature/CoreLights/ShadowConstants.h>
@@ -20,6 +21,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Random.h>
 #include <AzFramework/Entity/EntityContext.h>
+#include <Utils/CullingLodStatistics.h>
 #include <Utils/ImGuiSidebar.h>
 
 namespace AtomSampleViewer
@@ -27,6 +29,7 @@ namespace AtomSampleViewer
     class CullingAndLodExampleComponent final
         : public CommonSampleComponentBase
         , public AZ::TickBus::Handler
+        , private CullingAndLodExampleRequestBus::Handler
     {
     public:
         AZ_COMPONENT(CullingAndLodExampleComponent, "CA7AB736-5C80-425E-8DF3-E1C22971D79C", CommonSampleComponentBase);
@@ -76,6 +79,9 @@ namespace AtomSampleViewer
         // AZ::TickBus::Handler
         void OnTick(float deltaTime, AZ::ScriptTimePoint timePoint) override;
 
+        // CullingAndLodExampleRequestBus::Handler
+        bool WriteCullingStatistics(const AZStd::string& filePath) override;
+
         void ResetNoClipController();
 
         void SaveCameraConfiguration();
@@ -101,6 +107,11 @@ namespace AtomSampleViewer
         // models
         AZStd::vector<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandles;
         AZStd::vector<AZ::Render::MeshHandleDescriptor::ModelChangedEvent::Handler> m_modelChangedHandlers;
+        uint32_t m_gridSizeX = 0;
+        uint32_t m_gridSizeY = 0;
+
+        // statistics
+        CullingLodStatistics m_cullingStats;
 
         // GUI
         ImGuiSidebar m_imguiSidebar;
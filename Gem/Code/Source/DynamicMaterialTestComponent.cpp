@@ -22,6 +22,7 @@
 #include <AzCore/Math/Random.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/MaterialInstancePool.h>
 
 AZ_DECLARE_BUDGET(AtomSampleViewer);
 
@@ -90,10 +91,19 @@ namespace AtomSampleViewer
         m_waitingForMeshes = true;
     }
 
+    void DynamicMaterialTestComponent::CreateLatticeInstances(AZStd::span<const Transform> transforms)
+    {
+        for (const Transform& transform : transforms)
+        {
+            CreateLatticeInstance(transform);
+        }
+    }
+
     void DynamicMaterialTestComponent::CreateLatticeInstance(const Transform& transform)
     {
         AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset = m_materialConfigs[m_currentMaterialConfig].m_materialAsset;
-        AZ::Data::Instance<AZ::RPI::Material> material = Material::Create(materialAsset);
+        // Every entity animates its own material, so none of them can be shared
+        AZ::Data::Instance<AZ::RPI::Material> material = MaterialInstancePool::GetInstance()->AcquireUnique(materialAsset);
          
         Render::MeshHandleDescriptor meshDescriptor(m_modelAsset, material);
         meshDescriptor.m_isRayTracingEnabled = false;
@@ -117,6 +127,10 @@ namespace AtomSampleViewer
             GetMeshFeatureProcessor()->ReleaseMesh(meshHandle);
         }
         m_meshHandles.clear();
+        for (auto& material : m_materials)
+        {
+            MaterialInstancePool::GetInstance()->Release(material);
+        }
         m_materials.clear();
 
         m_loadedMeshCounter = 0;
@@ -210,9 +224,10 @@ namespace AtomSampleViewer
         AZ::Debug::Timer timer;
         timer.Stamp();
 
+        MaterialInstancePool* materialInstancePool = MaterialInstancePool::GetInstance();
         for (auto& material : m_materials)
         {
-            material->Compile();
+            materialInstancePool->Compile(material);
         }
 
         m_compileTimer.PushValue(timer.GetDeltaTimeInSeconds() * 1'000'000);
@@ -43,8 +43,10 @@ namespace AtomSampleViewer
 
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void DestroyLatticeInstances() override;
+
+        void CreateLatticeInstance(const AZ::Transform& transform);
         
         // AZ::TickBus::Handler overrides...
         void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime) override;
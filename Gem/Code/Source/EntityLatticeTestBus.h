@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Performance/LatticeScalingSweep.h>
+#include <AzCore/EBus/EBus.h>
+
+namespace AtomSampleViewer
+{
+    //! Requests handled by the active EntityLatticeTestComponent sample, used by scripts to drive the lattice.
+    class EntityLatticeTestRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        //! Starts stepping the lattice through the instance counts of the settings. The max dimension is filled in by the sample.
+        //! Returns false if a sweep is already running or the settings are invalid.
+        virtual bool StartScalingSweep(const LatticeScalingSweep::Settings& settings) = 0;
+
+        //! Ends a running sweep early and restores the lattice.
+        virtual void StopScalingSweep() = 0;
+
+        virtual bool IsScalingSweepRunning() const = 0;
+    };
+
+    using EntityLatticeTestRequestBus = AZ::EBus<EntityLatticeTestRequests>;
+
+} // namespace AtomSampleViewer
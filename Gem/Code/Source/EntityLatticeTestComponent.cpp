@@ -19,6 +19,7 @@
 #include <Automation/ScriptableImGui.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/MaterialInstancePool.h>
 #include <EntityLatticeTestComponent_Traits_Platform.h>
 
 namespace AtomSampleViewer
@@ -48,13 +49,19 @@ namespace AtomSampleViewer
 
         m_defaultIbl.Init(m_scene);
         BuildLattice();
+
+        EntityLatticeTestRequestBus::Handler::BusConnect();
     }
 
     void EntityLatticeTestComponent::Deactivate()
     {
         Debug::CameraControllerRequestBus::Event(GetCameraEntityId(), &Debug::CameraControllerRequestBus::Events::Disable);
 
+        EntityLatticeTestRequestBus::Handler::BusDisconnect();
+        m_scalingSweep.Stop();
+
         DestroyLatticeInstances();
+        AZStd::vector<Transform>().swap(m_latticeTransforms);
         m_defaultIbl.Reset();
     }
 
@@ -66,32 +73,22 @@ namespace AtomSampleViewer
 
     void EntityLatticeTestComponent::BuildLattice()
     {
+        const AZStd::chrono::steady_clock::time_point buildStartTime = AZStd::chrono::steady_clock::now();
+
         PrepareCreateLatticeInstances(GetInstanceCount());
 
-        // We first rotate the model by 180 degrees before translating it. This is to make it face the camera as it did
-        // when the world was Y-up.
-        Transform transform = Transform::CreateRotationZ(Constants::Pi);
-        m_worldAabb = AZ::Aabb::CreateNull();
+        LatticeBuilder::Layout layout;
+        layout.m_width = m_latticeWidth;
+        layout.m_depth = m_latticeDepth;
+        layout.m_height = m_latticeHeight;
+        layout.m_spacing = Vector3(m_spacingX, m_spacingY, m_spacingZ);
+        layout.m_entityScale = m_entityScale;
+        m_worldAabb = LatticeBuilder::Build(layout, m_latticeTransforms);
 
-        for (int32_t x = 0; x < m_latticeWidth; ++x)
-        {
-            for (int32_t y = 0; y < m_latticeDepth; ++y)
-            {
-                for (int32_t z = 0; z < m_latticeHeight; ++z)
-                {
-                    Vector3 position(
-                        static_cast<float>(x) * m_spacingX,
-                        static_cast<float>(y) * m_spacingY,
-                        static_cast<float>(z) * m_spacingZ);
-
-                    transform.SetTranslation(position);
-                    transform.SetUniformScale(m_entityScale);
-                    CreateLatticeInstance(transform);
-                    m_worldAabb.AddPoint(transform.GetTranslation());
-                }
-            }
-        }
+        CreateLatticeInstances(m_latticeTransforms);
         FinalizeLatticeInstances();
+
+        m_lastBuildTimeMs = AZStd::chrono::duration<float, AZStd::milli>(AZStd::chrono::steady_clock::now() - buildStartTime).count();
     }
 
     uint32_t EntityLatticeTestComponent::GetInstanceCount() const
@@ -133,6 +130,57 @@ namespace AtomSampleViewer
         m_defaultIbl.SetExposure(exposure);
     }
     
+    bool EntityLatticeTestComponent::StartScalingSweep(const LatticeScalingSweep::Settings& settings)
+    {
+        if (m_scalingSweep.IsRunning())
+        {
+            return false;
+        }
+
+        LatticeScalingSweep::Settings sweepSettings = settings;
+        sweepSettings.m_maxDimension = m_latticeSizeMax;
+
+        LatticeScalingSweep::Callbacks callbacks;
+        callbacks.m_buildLattice = [this](uint32_t width, uint32_t depth, uint32_t height)
+        {
+            SetLatticeDimensions(width, depth, height);
+            RebuildLattice();
+        };
+        callbacks.m_isLatticeReady = [this]()
+        {
+            return IsLatticeReady();
+        };
+        callbacks.m_sweepFinished = [this]()
+        {
+            RestoreLatticeAfterSweep();
+        };
+
+        m_preSweepDimensions[0] = m_latticeWidth;
+        m_preSweepDimensions[1] = m_latticeDepth;
+        m_preSweepDimensions[2] = m_latticeHeight;
+        return m_scalingSweep.Start(sweepSettings, callbacks);
+    }
+
+    void EntityLatticeTestComponent::StopScalingSweep()
+    {
+        if (m_scalingSweep.IsRunning())
+        {
+            m_scalingSweep.Stop();
+            RestoreLatticeAfterSweep();
+        }
+    }
+
+    bool EntityLatticeTestComponent::IsScalingSweepRunning() const
+    {
+        return m_scalingSweep.IsRunning();
+    }
+
+    void EntityLatticeTestComponent::RestoreLatticeAfterSweep()
+    {
+        SetLatticeDimensions(m_preSweepDimensions[0], m_preSweepDimensions[1], m_preSweepDimensions[2]);
+        RebuildLattice();
+    }
+
     void EntityLatticeTestComponent::RenderImGuiLatticeControls()
     {
         bool latticeChanged = false;
@@ -178,5 +226,22 @@ namespace AtomSampleViewer
         {
             RebuildLattice();
         }
+
+        ImGui::Text("Lattice build time: %.2f ms", m_lastBuildTimeMs);
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        MaterialInstancePool::GetInstance()->DrawImGuiStats();
+
+        if (m_scalingSweep.IsRunning() || !m_scalingSweep.GetResults().empty())
+        {
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
+            m_scalingSweep.DrawImGui();
+        }
     }
 } // namespace AtomSampleViewer
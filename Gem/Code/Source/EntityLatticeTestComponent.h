@@ -9,10 +9,14 @@
 #pragma once
 
 #include <CommonSampleComponentBase.h>
+#include <EntityLatticeTestBus.h>
+#include <Performance/LatticeBuilder.h>
+#include <Performance/LatticeScalingSweep.h>
 #include <Utils/Utils.h>
 #include <EntityLatticeTestComponent_Traits_Platform.h>
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/chrono/chrono.h>
 
 struct ImGuiContext;
 
@@ -21,6 +25,7 @@ namespace AtomSampleViewer
     //! Common base class for test components that display a lattice of entities.
     class EntityLatticeTestComponent
         : public CommonSampleComponentBase
+        , public EntityLatticeTestRequestBus::Handler
     {
     public:
         AZ_RTTI(EntityLatticeTestComponent, "{73C13F66-6F5B-43D3-B1F0-CB4F7BEA1334}", CommonSampleComponentBase)
@@ -53,14 +58,25 @@ namespace AtomSampleViewer
 
         void SetIBLExposure(float exposure);
 
+        //! Returns true once the lattice that was last built is fully set up. Scaling sweeps wait for this before they start
+        //! measuring a step, so subclasses that finish building the lattice over several frames should override it.
+        virtual bool IsLatticeReady() const { return true; }
+
     private:
+        // EntityLatticeTestRequestBus::Handler overrides...
+        bool StartScalingSweep(const LatticeScalingSweep::Settings& settings) override;
+        void StopScalingSweep() override;
+        bool IsScalingSweepRunning() const override;
+
+        void RestoreLatticeAfterSweep();
 
-        //! Called once before CreateLatticeInstance() is called for each instance so the subclass can prepare for the total number of instances.
+        //! Called once before CreateLatticeInstances() so the subclass can prepare for the total number of instances.
         virtual void PrepareCreateLatticeInstances(uint32_t instanceCount) = 0;
 
-        //! This is called for each entity in the lattice when it is being built. The subclass should attach
-        //! whatever components are necessary to achieve the desired result.
-        virtual void CreateLatticeInstance(const AZ::Transform& transform) = 0;
+        //! This is called once with the transforms of every entity in the lattice when it is being built. The transforms are
+        //! generated up front, so subclasses that only record per-instance data can size their storage once and fill it in bulk.
+        //! The subclass should attach whatever components are necessary to achieve the desired result.
+        virtual void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) = 0;
 
         //! This is called after all the instances are created to any final work. Not required.
         virtual void FinalizeLatticeInstances() {};
@@ -86,7 +102,13 @@ namespace AtomSampleViewer
         float m_spacingZ = 5.0f;
 
         float m_entityScale = 1.0f;
-        
+
+        AZStd::vector<AZ::Transform> m_latticeTransforms;   //< Reused between rebuilds so resizing the lattice doesn't reallocate
+        float m_lastBuildTimeMs = 0.0f;
+
+        LatticeScalingSweep m_scalingSweep;
+        int32_t m_preSweepDimensions[3] = { 0, 0, 0 };  //< Width, depth and height to restore when the sweep ends
+
         Utils::DefaultIBL m_defaultIbl;
     };
 } // namespace AtomSampleViewer
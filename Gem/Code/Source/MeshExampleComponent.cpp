@@ -210,12 +210,12 @@ namespace AtomSampleViewer
             // Without this assurance We would need to call  AzToolsFramework::AssetSystem::AssetSystemRequest::GetSourceInfoBySourceUUID()
             // to figure out what's the source of this azmaterial. But, Atom can not include AzToolsFramework.
             return assetInfo.m_assetId.m_subId == 0;
-        });
+        }, AssetCatalogIndex::Scope::ForExtension("azmaterial"));
 
         m_modelBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::ModelAsset>();
-        });
+        }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::ModelAsset>()));
 
         m_materialBrowser.Activate();
         m_modelBrowser.Activate();
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/AssetSwapScheduler.h>
+#include <Utils/JsonFile.h>
+
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    const char* AssetSwapScheduler::GetStrategyName(Strategy strategy)
+    {
+        switch (strategy)
+        {
+        case Strategy::AllAtOnce:
+            return "All At Once";
+        case Strategy::Amortized:
+            return "Amortized";
+        default:
+            return "";
+        }
+    }
+
+    void AssetSwapScheduler::Begin(size_t itemCount)
+    {
+        m_itemCount = itemCount;
+        m_nextItem = 0;
+        m_switchFrameCount = 0;
+        m_switchTotalMs = 0.0f;
+    }
+
+    void AssetSwapScheduler::Cancel()
+    {
+        Begin(0);
+    }
+
+    bool AssetSwapScheduler::Update(const SwapFunction& swapItem)
+    {
+        if (!IsSwitching())
+        {
+            return false;
+        }
+
+        using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+        const Clock::time_point frameStartTime = Clock::now();
+        const bool isAmortized = m_strategy == Strategy::Amortized;
+
+        float frameCostMs = 0.0f;
+        do
+        {
+            swapItem(m_nextItem++);
+            frameCostMs = AZStd::chrono::duration_cast<Milliseconds>(Clock::now() - frameStartTime).count();
+        } while (IsSwitching() && (!isAmortized || frameCostMs < m_frameBudgetMs));
+
+        Statistics& statistics = m_statistics[static_cast<size_t>(m_strategy)];
+        statistics.m_frameCostMs.PushValue(frameCostMs);
+        ++m_switchFrameCount;
+        m_switchTotalMs += frameCostMs;
+
+        if (IsSwitching())
+        {
+            return false;
+        }
+
+        ++statistics.m_completedSwitchCount;
+        statistics.m_lastSwitchFrameCount = m_switchFrameCount;
+        statistics.m_lastSwitchTotalMs = m_switchTotalMs;
+        return true;
+    }
+
+    void AssetSwapScheduler::ResetStatistics()
+    {
+        for (Statistics& statistics : m_statistics)
+        {
+            statistics = Statistics();
+        }
+    }
+
+    bool AssetSwapScheduler::WriteStatistics(const AZStd::string& filePath) const
+    {
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("frameBudgetMs");
+                writer.Double(m_frameBudgetMs);
+
+                writer.Key("strategies");
+                writer.StartArray();
+                for (size_t i = 0; i < m_statistics.size(); ++i)
+                {
+                    const Statistics& statistics = m_statistics[i];
+                    writer.StartObject();
+                    writer.Key("name");
+                    writer.String(GetStrategyName(static_cast<Strategy>(i)));
+                    writer.Key("completedSwitches");
+                    writer.Uint(statistics.m_completedSwitchCount);
+                    writer.Key("workFrames");
+                    writer.Uint64(statistics.m_frameCostMs.GetCount());
+                    writer.Key("frameCostMeanMs");
+                    writer.Double(statistics.m_frameCostMs.GetMean());
+                    writer.Key("frameCostP99Ms");
+                    writer.Double(statistics.m_frameCostMs.GetQuantile(FrameTimeStatistics::Quantile::P99));
+                    writer.Key("worstFrameCostMs");
+                    writer.Double(statistics.m_frameCostMs.GetMaximum());
+                    writer.Key("lastSwitchFrames");
+                    writer.Uint(statistics.m_lastSwitchFrameCount);
+                    writer.Key("lastSwitchTotalMs");
+                    writer.Double(statistics.m_lastSwitchTotalMs);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+                writer.EndObject();
+            });
+    }
+
+    void AssetSwapScheduler::DrawImGuiComparison() const
+    {
+        if (IsSwitching())
+        {
+            ImGui::Text("Switching: %zu / %zu", m_nextItem, m_itemCount);
+        }
+        else
+        {
+            ImGui::Text("Switching: idle");
+        }
+
+        ImGui::Columns(3);
+        ImGui::Text(" ");
+        ImGui::NextColumn();
+        ImGui::Text("%s", GetStrategyName(Strategy::AllAtOnce));
+        ImGui::NextColumn();
+        ImGui::Text("%s", GetStrategyName(Strategy::Amortized));
+        ImGui::NextColumn();
+
+        const char* rowNames[] = { "Switches", "Mean Frame (ms)", "Worst Frame (ms)", "Frames/Switch", "Total/Switch (ms)" };
+        for (size_t row = 0; row < AZ_ARRAY_SIZE(rowNames); ++row)
+        {
+            ImGui::Text("%s", rowNames[row]);
+            ImGui::NextColumn();
+            for (const Statistics& statistics : m_statistics)
+            {
+                if (statistics.m_frameCostMs.GetCount() == 0)
+                {
+                    ImGui::Text("-");
+                }
+                else if (row == 0)
+                {
+                    ImGui::Text("%u", statistics.m_completedSwitchCount);
+                }
+                else if (row == 1)
+                {
+                    ImGui::Text("%.2f", statistics.m_frameCostMs.GetMean());
+                }
+                else if (row == 2)
+                {
+                    ImGui::Text("%.2f", statistics.m_frameCostMs.GetMaximum());
+                }
+                else if (row == 3)
+                {
+                    ImGui::Text("%u", statistics.m_lastSwitchFrameCount);
+                }
+                else
+                {
+                    ImGui::Text("%.2f", statistics.m_lastSwitchTotalMs);
+                }
+                ImGui::NextColumn();
+            }
+        }
+        ImGui::Columns(1);
+    }
+} // namespace AtomSampleViewer
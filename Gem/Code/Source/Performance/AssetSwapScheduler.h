@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Utils/FrameTimeStatistics.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Schedules swapping the assets of many items, either all in one frame or spread over frames under a time budget, and
+    //! records how much swap work each frame did so the two strategies can be compared.
+    class AssetSwapScheduler
+    {
+    public:
+        enum class Strategy
+        {
+            AllAtOnce,
+            Amortized,
+            Count
+        };
+
+        struct Statistics
+        {
+            uint32_t m_completedSwitchCount = 0;
+            uint32_t m_lastSwitchFrameCount = 0;    //!< Frames the last completed switch was spread over
+            float m_lastSwitchTotalMs = 0.0f;       //!< Swap work of the last completed switch, summed over its frames
+            FrameTimeStatistics m_frameCostMs;      //!< Swap work of each frame that did any, the maximum is the worst spike
+        };
+
+        using SwapFunction = AZStd::function<void(size_t itemIndex)>;
+
+        static const char* GetStrategyName(Strategy strategy);
+
+        void SetStrategy(Strategy strategy) { m_strategy = strategy; }
+        Strategy GetStrategy() const { return m_strategy; }
+
+        void SetFrameBudgetMs(float frameBudgetMs) { m_frameBudgetMs = frameBudgetMs; }
+        float GetFrameBudgetMs() const { return m_frameBudgetMs; }
+
+        //! Schedules items [0, itemCount) to be swapped, replacing a switch that's still in progress.
+        void Begin(size_t itemCount);
+
+        //! Drops the items that haven't been swapped yet.
+        void Cancel();
+
+        bool IsSwitching() const { return m_nextItem < m_itemCount; }
+        size_t GetPendingCount() const { return m_itemCount - m_nextItem; }
+
+        //! Swaps pending items in order. AllAtOnce swaps all of them, Amortized stops once the frame budget is used up, but
+        //! always swaps at least one item so a switch finishes even if a single swap is over budget.
+        //! Call once per frame. Returns true on the frame the switch completes.
+        bool Update(const SwapFunction& swapItem);
+
+        const Statistics& GetStatistics(Strategy strategy) const { return m_statistics[static_cast<size_t>(strategy)]; }
+        void ResetStatistics();
+
+        bool WriteStatistics(const AZStd::string& filePath) const;
+
+        //! Draws the statistics of both strategies side by side.
+        void DrawImGuiComparison() const;
+
+    private:
+        using Clock = AZStd::chrono::steady_clock;
+
+        Strategy m_strategy = Strategy::Amortized;
+        float m_frameBudgetMs = 2.0f;
+
+        size_t m_itemCount = 0;
+        size_t m_nextItem = 0;
+        uint32_t m_switchFrameCount = 0;
+        float m_switchTotalMs = 0.0f;
+
+        AZStd::array<Statistics, static_cast<size_t>(Strategy::Count)> m_statistics;
+    };
+} // namespace AtomSampleViewer
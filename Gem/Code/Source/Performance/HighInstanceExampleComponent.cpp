@@ -17,13 +17,18 @@
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
+#include <Atom/RHI/MemoryStatistics.h>
+#include <Atom/RHI/RHISystemInterface.h>
 
 #include <Automation/ScriptRunnerBus.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzFramework/Windowing/WindowBus.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/ImGuiHistogramQueue.h>
+#include <Utils/MaterialInstancePool.h>
 
 AZ_DECLARE_BUDGET(AtomSampleViewer);
 
@@ -31,6 +36,46 @@ namespace AtomSampleViewer
 {
     using namespace AZ;
 
+    namespace
+    {
+        // Makes the mesh feature processor batch meshes that share a model and material into instanced draws
+        constexpr const char* MeshInstancingCVar = "r_meshInstancingEnabled";
+
+        bool GetMeshInstancingEnabled()
+        {
+            bool enabled = false;
+            if (AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->GetCvarValue(MeshInstancingCVar, enabled);
+            }
+            return enabled;
+        }
+
+        void SetMeshInstancingEnabled(bool enabled)
+        {
+            if (AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get())
+            {
+                console->PerformCommand(AZStd::string::format("%s %s", MeshInstancingCVar, enabled ? "true" : "false").c_str());
+            }
+        }
+
+        size_t GetUsedGpuMemoryBytes()
+        {
+            const RHI::MemoryStatistics* memoryStatistics = RHI::RHISystemInterface::Get()->GetMemoryStatistics();
+            if (!memoryStatistics)
+            {
+                return 0;
+            }
+
+            size_t usedBytes = 0;
+            for (const RHI::MemoryStatistics::Heap& heap : memoryStatistics->m_heaps)
+            {
+                usedBytes += heap.m_memoryUsage.m_usedResidentInBytes;
+            }
+            return usedBytes;
+        }
+    } // namespace
+
     void HighInstanceTestComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -50,12 +95,12 @@ namespace AtomSampleViewer
         m_materialBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::MaterialAsset>();
-        });
+        }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::MaterialAsset>()));
 
         m_modelBrowser.SetFilter([](const AZ::Data::AssetInfo& assetInfo)
         {
             return assetInfo.m_assetType == azrtti_typeid<AZ::RPI::ModelAsset>();
-        });
+        }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<AZ::RPI::ModelAsset>()));
 
         // Only use a diffuse white material so light colors are easily visible.
         const AZStd::vector<AZStd::string> materialAllowlist =
@@ -92,6 +137,14 @@ namespace AtomSampleViewer
         m_directionalLightFeatureProcessor = m_scene->GetFeatureProcessor<Render::DirectionalLightFeatureProcessorInterface>();
         m_diskLightFeatureProcessor = m_scene->GetFeatureProcessor<Render::DiskLightFeatureProcessorInterface>();
 
+        // Scripts and headless runs pick the draw mode by setting the cvar before opening the sample
+        m_preActivateInstancedDraws = GetMeshInstancingEnabled();
+        m_useInstancedDraws = m_preActivateInstancedDraws;
+
+        // Memory statistics are only available while they're gathered, so this tells whether another system turned them on
+        m_preActivateGatherMemoryStatistics = RHI::RHISystemInterface::Get()->GetMemoryStatistics() != nullptr;
+        RHI::RHISystemInterface::Get()->ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags::GatherMemoryStatistics, true);
+
         AZ::TickBus::Handler::BusConnect();
 
         m_imguiSidebar.Activate();
@@ -150,6 +203,15 @@ namespace AtomSampleViewer
             &AzFramework::WindowRequestBus::Events::SetSyncInterval,
             m_preActivateVSyncInterval);
 
+        if (m_useInstancedDraws != m_preActivateInstancedDraws)
+        {
+            SetMeshInstancingEnabled(m_preActivateInstancedDraws);
+        }
+        if (!m_preActivateGatherMemoryStatistics)
+        {
+            RHI::RHISystemInterface::Get()->ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags::GatherMemoryStatistics, false);
+        }
+
         m_materialBrowser.Deactivate();
         m_modelBrowser.Deactivate();
 
@@ -161,20 +223,30 @@ namespace AtomSampleViewer
     void HighInstanceTestComponent::PrepareCreateLatticeInstances(uint32_t instanceCount)
     {
         m_modelInstanceData.reserve(instanceCount);
+        m_instanceTransforms.Reserve(instanceCount);
         DestroyLights();
     }
 
-    void HighInstanceTestComponent::CreateLatticeInstance(const AZ::Transform& transform)
+    void HighInstanceTestComponent::CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms)
     {
-        m_modelInstanceData.emplace_back<ModelInstanceData>({});
-        ModelInstanceData& data = m_modelInstanceData.back();
-        data.m_modelAssetId = GetRandomModelId();
-        data.m_materialAssetId = GetRandomMaterialId();
-        data.m_transform = transform;
+        const size_t firstInstance = m_modelInstanceData.size();
+        m_modelInstanceData.resize(firstInstance + transforms.size());
+        for (size_t i = firstInstance; i < m_modelInstanceData.size(); ++i)
+        {
+            m_modelInstanceData[i].m_modelAssetId = GetRandomModelId();
+            m_modelInstanceData[i].m_materialAssetId = GetRandomMaterialId();
+        }
+        m_instanceTransforms.Add(transforms);
     }
 
     void HighInstanceTestComponent::FinalizeLatticeInstances()
     {
+        m_latticeBuildStartTime = Clock::now();
+
+        // The comparison only holds for a single lattice
+        m_drawModeStatistics[0] = {};
+        m_drawModeStatistics[1] = {};
+
         AZStd::set<AZ::Data::AssetId> assetIds;
 
         for (ModelInstanceData& instanceData : m_modelInstanceData)
@@ -224,37 +296,231 @@ namespace AtomSampleViewer
 
     void HighInstanceTestComponent::OnAllAssetsReadyActivate()
     {
-        for (ModelInstanceData& instanceData : m_modelInstanceData)
+        // Instances pick from a handful of assets, so each material instance and model asset is only looked up once
+        ReleaseResolvedMaterials();
+        m_resolvedModels.clear();
+        for (const ModelInstanceData& instanceData : m_modelInstanceData)
         {
-            AZ::Data::Instance<AZ::RPI::Material> materialInstance;
-            if (instanceData.m_materialAssetId.IsValid())
+            if (instanceData.m_materialAssetId.IsValid() && m_resolvedMaterials.find(instanceData.m_materialAssetId) == m_resolvedMaterials.end())
             {
                 AZ::Data::Asset<RPI::MaterialAsset> materialAsset;
                 materialAsset.Create(instanceData.m_materialAssetId);
-                materialInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
+                m_resolvedMaterials[instanceData.m_materialAssetId] = MaterialInstancePool::GetInstance()->Acquire(materialAsset);
 
                 // cache the material when its loaded
                 m_cachedMaterials.insert(materialAsset);
             }
 
-            if (instanceData.m_modelAssetId.IsValid())
+            if (instanceData.m_modelAssetId.IsValid() && m_resolvedModels.find(instanceData.m_modelAssetId) == m_resolvedModels.end())
             {
                 AZ::Data::Asset<AZ::RPI::ModelAsset> modelAsset;
                 modelAsset.Create(instanceData.m_modelAssetId);
-
-                instanceData.m_meshHandle = GetMeshFeatureProcessor()->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelAsset, materialInstance));
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform);
+                m_resolvedModels[instanceData.m_modelAssetId] = modelAsset;
             }
         }
 
-        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+        StartMeshAcquisition();
+
         AZ::TickBus::Handler::BusConnect();
     }
 
+    void HighInstanceTestComponent::StartMeshAcquisition()
+    {
+        // The mesh handles are acquired in OnTick(), the script resumes once all of them exist
+        m_acquiredInstanceCount = 0;
+        m_isAcquiringMeshes = true;
+        m_timeToFirstFrameMs = 0.0f;
+        m_acquisitionTimeMs = 0.0f;
+        m_instancesPerSecond = 0.0f;
+        m_acquisitionStartTime = Clock::now();
+    }
+
+    bool HighInstanceTestComponent::AcquireMeshHandles()
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        // Checking the clock is cheap next to acquiring a mesh, but there's no need to do it for every instance
+        static constexpr size_t InstancesPerBudgetCheck = 64;
+
+        const Clock::time_point startTime = Clock::now();
+        const auto budget = AZStd::chrono::duration_cast<Clock::duration>(AZStd::chrono::duration<float, AZStd::milli>(m_acquisitionBudgetMs));
+
+        Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+        const size_t instanceCount = m_modelInstanceData.size();
+        while (m_acquiredInstanceCount < instanceCount)
+        {
+            const size_t chunkEnd = AZStd::min(m_acquiredInstanceCount + InstancesPerBudgetCheck, instanceCount);
+            for (; m_acquiredInstanceCount < chunkEnd; ++m_acquiredInstanceCount)
+            {
+                ModelInstanceData& instanceData = m_modelInstanceData[m_acquiredInstanceCount];
+                auto modelIter = m_resolvedModels.find(instanceData.m_modelAssetId);
+                if (modelIter == m_resolvedModels.end())
+                {
+                    continue;
+                }
+
+                auto materialIter = m_resolvedMaterials.find(instanceData.m_materialAssetId);
+                AZ::Data::Instance<AZ::RPI::Material> materialInstance = materialIter != m_resolvedMaterials.end() ? materialIter->second : nullptr;
+
+                instanceData.m_meshHandle = meshFeatureProcessor->AcquireMesh(AZ::Render::MeshHandleDescriptor(modelIter->second, materialInstance));
+                meshFeatureProcessor->SetTransform(instanceData.m_meshHandle, m_instanceTransforms.GetTransform(m_acquiredInstanceCount));
+            }
+
+            if (Clock::now() - startTime >= budget)
+            {
+                break;
+            }
+        }
+
+        return m_acquiredInstanceCount == instanceCount;
+    }
+
+    void HighInstanceTestComponent::DrawMeshAcquisitionStatistics()
+    {
+        ImGui::Text("Mesh Acquisition");
+        ImGui::SliderFloat("Budget Per Frame (ms)", &m_acquisitionBudgetMs, 0.5f, 100.0f, "%.1f");
+        ImGui::Text("Acquired: %zu / %zu", m_acquiredInstanceCount, m_modelInstanceData.size());
+        ImGui::Text("Unique Models: %zu, Materials: %zu", m_resolvedModels.size(), m_resolvedMaterials.size());
+        ImGui::Text("Time To First Frame: %.1f ms", m_timeToFirstFrameMs);
+        if (m_isAcquiringMeshes)
+        {
+            ImGui::Text("Acquisition Time: in progress");
+        }
+        else
+        {
+            ImGui::Text("Acquisition Time: %.1f ms (%.0f instances/s)", m_acquisitionTimeMs, m_instancesPerSecond);
+        }
+    }
+
+    void HighInstanceTestComponent::SetInstancedDrawsEnabled(bool enabled)
+    {
+        m_useInstancedDraws = enabled;
+        SetMeshInstancingEnabled(enabled);
+
+        // If the lattice is still waiting for its assets, the new mode is picked up when acquisition starts
+        if (!m_isAcquiringMeshes && m_acquiredInstanceCount == 0)
+        {
+            return;
+        }
+
+        // Instancing is decided when a mesh's draw packets are built, so the lattice is acquired again from scratch.
+        // The build start time is reset too, so the time to first frame only measures this mode.
+        DestroyHandles();
+        m_latticeBuildStartTime = Clock::now();
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::PauseScriptWithTimeout, 120.0f);
+        StartMeshAcquisition();
+    }
+
+    void HighInstanceTestComponent::UpdateDrawModeStatistics()
+    {
+        AZ_PROFILE_FUNCTION(AtomSampleViewer);
+
+        AZStd::unordered_map<AZ::Data::AssetId, size_t> lodMeshCounts;
+        for (const auto& [modelAssetId, modelAsset] : m_resolvedModels)
+        {
+            const bool hasLods = modelAsset.IsReady() && !modelAsset->GetLodAssets().empty();
+            lodMeshCounts[modelAssetId] = hasLods ? modelAsset->GetLodAssets()[0]->GetMeshes().size() : 1;
+        }
+
+        // These are estimates from the lattice, not counts read back from the mesh feature processor or the RHI.
+        // Per instance, every mesh of every handle is a draw item. Instanced, each model and material pair is drawn once.
+        AZStd::set<AZStd::pair<AZ::Data::AssetId, AZ::Data::AssetId>> batches;
+        size_t drawItemCount = 0;
+        for (size_t i = 0; i < m_acquiredInstanceCount; ++i)
+        {
+            const ModelInstanceData& instanceData = m_modelInstanceData[i];
+            auto meshCountIter = lodMeshCounts.find(instanceData.m_modelAssetId);
+            if (!instanceData.m_meshHandle.IsValid() || meshCountIter == lodMeshCounts.end())
+            {
+                continue;
+            }
+
+            const bool isNewBatch = batches.insert({ instanceData.m_modelAssetId, instanceData.m_materialAssetId }).second;
+            if (!m_useInstancedDraws || isNewBatch)
+            {
+                drawItemCount += meshCountIter->second;
+            }
+        }
+
+        DrawModeStatistics& statistics = m_drawModeStatistics[m_useInstancedDraws];
+        statistics = {};
+        statistics.m_isValid = true;
+        statistics.m_batchCount = batches.size();
+        statistics.m_drawItemCount = drawItemCount;
+    }
+
+    void HighInstanceTestComponent::DrawDrawModeComparison()
+    {
+        ImGui::Text("Draw Mode");
+
+        bool useInstancedDraws = m_useInstancedDraws;
+        if (ImGui::Checkbox("Instanced Draws", &useInstancedDraws))
+        {
+            SetInstancedDrawsEnabled(useInstancedDraws);
+        }
+
+        ImGui::Columns(3);
+        ImGui::Text(" ");
+        ImGui::NextColumn();
+        ImGui::Text("Per Instance");
+        ImGui::NextColumn();
+        ImGui::Text("Instanced");
+        ImGui::NextColumn();
+
+        const char* rowNames[] = { "Batches (est.)", "Draw Items (est.)", "CPU Frame (ms)", "GPU Memory (MiB)" };
+        for (size_t row = 0; row < AZ_ARRAY_SIZE(rowNames); ++row)
+        {
+            ImGui::Text("%s", rowNames[row]);
+            ImGui::NextColumn();
+            for (const DrawModeStatistics& statistics : m_drawModeStatistics)
+            {
+                if (!statistics.m_isValid)
+                {
+                    ImGui::Text("-");
+                }
+                else if (row == 0)
+                {
+                    ImGui::Text("%zu", statistics.m_batchCount);
+                }
+                else if (row == 1)
+                {
+                    ImGui::Text("%zu", statistics.m_drawItemCount);
+                }
+                else if (row == 2)
+                {
+                    ImGui::Text("%.2f", statistics.m_cpuFrameTimeMs);
+                }
+                else
+                {
+                    ImGui::Text("%.1f", statistics.m_gpuMemoryBytes / (1024.0f * 1024.0f));
+                }
+                ImGui::NextColumn();
+            }
+        }
+        ImGui::Columns(1);
+    }
+
     void HighInstanceTestComponent::DestroyLatticeInstances()
     {
         DestroyHandles();
+        ReleaseResolvedMaterials();
         m_modelInstanceData.clear();
+        m_instanceTransforms.Clear();
+    }
+
+    void HighInstanceTestComponent::ReleaseResolvedMaterials()
+    {
+        for (auto& [materialAssetId, material] : m_resolvedMaterials)
+        {
+            MaterialInstancePool::GetInstance()->Release(material);
+        }
+        m_resolvedMaterials.clear();
+    }
+
+    bool HighInstanceTestComponent::IsLatticeReady() const
+    {
+        // Before the assets are ready nothing has been acquired yet, so this is only true once every mesh handle exists
+        return !m_isAcquiringMeshes && m_acquiredInstanceCount == m_modelInstanceData.size();
     }
 
     void HighInstanceTestComponent::DestroyLights()
@@ -276,6 +542,14 @@ namespace AtomSampleViewer
             GetMeshFeatureProcessor()->ReleaseMesh(instanceData.m_meshHandle);
             instanceData.m_meshHandle = {};
         }
+        m_acquiredInstanceCount = 0;
+
+        if (m_isAcquiringMeshes)
+        {
+            // The lattice was rebuilt before it finished streaming in
+            m_isAcquiringMeshes = false;
+            ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+        }
     }
 
     AZ::Data::AssetId HighInstanceTestComponent::GetRandomModelId() const
@@ -313,16 +587,57 @@ namespace AtomSampleViewer
     {
 		AZ_PROFILE_FUNCTION(AtomSampleViewer);
 
+        m_frameTimeStatistics.PushValue(deltaTime * 1000.0f);
+        m_cpuFrameTimeStatistics.PushValue(static_cast<float>(RHI::RHISystemInterface::Get()->GetCpuFrameTime()));
+
+        if (m_isAcquiringMeshes)
+        {
+            const bool isFirstFrame = m_acquiredInstanceCount == 0;
+            const bool isDone = AcquireMeshHandles();
+
+            using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+            const Clock::time_point now = Clock::now();
+            if (isFirstFrame)
+            {
+                m_timeToFirstFrameMs = AZStd::chrono::duration_cast<Milliseconds>(now - m_latticeBuildStartTime).count();
+            }
+
+            if (isDone)
+            {
+                m_isAcquiringMeshes = false;
+                m_acquisitionTimeMs = AZStd::chrono::duration_cast<Milliseconds>(now - m_acquisitionStartTime).count();
+                m_instancesPerSecond = m_acquisitionTimeMs > 0.0f ? m_acquiredInstanceCount * 1000.0f / m_acquisitionTimeMs : 0.0f;
+
+                // Frames spent streaming in the lattice would skew the statistics of the test itself
+                m_frameTimeStatistics.Reset();
+                m_cpuFrameTimeStatistics.Reset();
+                UpdateDrawModeStatistics();
+                ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::ResumeScript);
+            }
+        }
+        else if (DrawModeStatistics& statistics = m_drawModeStatistics[m_useInstancedDraws]; statistics.m_isValid)
+        {
+            statistics.m_cpuFrameTimeMs = m_cpuFrameTimeStatistics.GetMedian();
+            statistics.m_gpuMemoryBytes = GetUsedGpuMemoryBytes();
+        }
+
         if (m_updateTransformEnabled)
         {
+            AZ_PROFILE_SCOPE(AtomSampleViewer, "HighInstanceTestComponent: UpdateTransforms");
+
             float radians = static_cast<float>(fmod(scriptTime.GetSeconds(), AZ::Constants::TwoPi));
             AZ::Vector3 rotation(radians, radians, radians);
             AZ::Transform rotationTransform;
             rotationTransform.SetFromEulerRadians(rotation);
 
-            for (ModelInstanceData& instanceData : m_modelInstanceData)
+            m_instanceTransforms.UpdateRotated(rotationTransform.GetRotation());
+
+            // Submitted in one pass over the contiguous results, in the same order as the handles
+            Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+            AZStd::span<const AZ::Transform> worldTransforms = m_instanceTransforms.GetWorldTransforms();
+            for (size_t i = 0; i < m_acquiredInstanceCount; ++i)
             {
-                GetMeshFeatureProcessor()->SetTransform(instanceData.m_meshHandle, instanceData.m_transform * rotationTransform);
+                meshFeatureProcessor->SetTransform(m_modelInstanceData[i].m_meshHandle, worldTransforms[i]);
             }
         }
 
@@ -364,6 +679,29 @@ namespace AtomSampleViewer
                 ImGui::Checkbox("Enable Directional Light", &m_directionalLightEnabled);
             }
 
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
+            DrawMeshAcquisitionStatistics();
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
+            DrawDrawModeComparison();
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Spacing();
+
+            ImGui::Text("Frame Time");
+            ImGuiHistogramQueue::DrawStatistics(m_frameTimeStatistics, "ms");
+            if (ImGui::Button("Reset Frame Time Statistics"))
+            {
+                m_frameTimeStatistics.Reset();
+            }
+
             m_imguiSidebar.End();
         }
 
@@ -9,12 +9,16 @@
 #pragma once
 
 #include <EntityLatticeTestComponent.h>
+#include <Performance/InstanceTransformStore.h>
+#include <Utils/FrameTimeStatistics.h>
 #include <Utils/ImGuiSidebar.h>
 #include <Utils/ImGuiAssetBrowser.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <Atom/Feature/CoreLights/DirectionalLightFeatureProcessorInterface.h>
@@ -73,12 +77,24 @@ namespace AtomSampleViewer
 
         //! EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void FinalizeLatticeInstances() override;
         void DestroyLatticeInstances() override;
+        bool IsLatticeReady() const override;
         void DestroyLights();
 
         void DestroyHandles();
+        void ReleaseResolvedMaterials();
+
+        // Acquires mesh handles for the next instances until the per-frame budget runs out. Returns true once every instance has one.
+        bool AcquireMeshHandles();
+        void StartMeshAcquisition();
+        void DrawMeshAcquisitionStatistics();
+
+        // Switches the mesh feature processor between one draw per mesh handle and instanced draws, then re-acquires the lattice
+        void SetInstancedDrawsEnabled(bool enabled);
+        void UpdateDrawModeStatistics();
+        void DrawDrawModeComparison();
 
         AZ::Data::AssetId GetRandomModelId() const;
         AZ::Data::AssetId GetRandomMaterialId() const;
@@ -102,9 +118,9 @@ namespace AtomSampleViewer
         HighInstanceTestParameters m_testParameters;
 
     private:
+        // The transforms of the instances are kept separately in m_instanceTransforms, at the same indices
         struct ModelInstanceData
         {
-            AZ::Transform m_transform;
             AZ::Data::AssetId m_modelAssetId;
             AZ::Data::AssetId m_materialAssetId;
             AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
@@ -115,6 +131,41 @@ namespace AtomSampleViewer
         ImGuiAssetBrowser m_modelBrowser;
         
         AZStd::vector<ModelInstanceData> m_modelInstanceData;
+        InstanceTransformStore m_instanceTransforms;
+
+        // Mesh handles are acquired over several frames, so the first frame isn't delayed by the whole lattice.
+        // Materials and models are resolved once per unique asset before that, instead of once per instance.
+        using Clock = AZStd::chrono::steady_clock;
+        static constexpr float DefaultAcquisitionBudgetMs = 4.0f;
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Instance<AZ::RPI::Material>> m_resolvedMaterials;
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::Asset<AZ::RPI::ModelAsset>> m_resolvedModels;
+        size_t m_acquiredInstanceCount = 0;      //< Instances [0, m_acquiredInstanceCount) have a mesh handle
+        bool m_isAcquiringMeshes = false;
+        float m_acquisitionBudgetMs = DefaultAcquisitionBudgetMs;
+        Clock::time_point m_latticeBuildStartTime;
+        Clock::time_point m_acquisitionStartTime;
+        float m_timeToFirstFrameMs = 0.0f;       //< From building the lattice to the first frame with meshes
+        float m_acquisitionTimeMs = 0.0f;        //< From the first to the last acquired mesh handle
+        float m_instancesPerSecond = 0.0f;
+
+        // Instanced draws group the cells that share a model and material into one draw with per-instance data, which is done
+        // by the mesh feature processor when r_meshInstancingEnabled is set. The last statistics of each mode are kept, so both
+        // modes can be compared on the same lattice. The batch and draw item counts are estimated from the lattice, they aren't
+        // measured from the mesh feature processor.
+        struct DrawModeStatistics
+        {
+            bool m_isValid = false;
+            size_t m_batchCount = 0;            //< Unique model and material pairs
+            size_t m_drawItemCount = 0;         //< Estimated draw items for LOD 0, before culling
+            float m_cpuFrameTimeMs = 0.0f;      //< Median RHI CPU frame time
+            size_t m_gpuMemoryBytes = 0;        //< Resident memory used across all GPU heaps, always 0 on the null RHI
+        };
+
+        bool m_useInstancedDraws = false;
+        bool m_preActivateInstancedDraws = false;
+        bool m_preActivateGatherMemoryStatistics = false;
+        DrawModeStatistics m_drawModeStatistics[2];  //< Indexed by m_useInstancedDraws
+        FrameTimeStatistics m_cpuFrameTimeStatistics{ FrameTimeStatistics::DefaultStutterThresholdMs };
 
         struct Compare
         {
@@ -137,6 +188,8 @@ namespace AtomSampleViewer
         AZStd::vector<AZStd::string> m_expandedModelList; // has models that are more expensive on the gpu
         AZStd::vector<AZStd::string> m_simpleModelList; // Aims to keep the test cpu bottlenecked by using trivial geometry such as a cube
 
+        FrameTimeStatistics m_frameTimeStatistics{ FrameTimeStatistics::DefaultStutterThresholdMs };
+
         float m_originalFarClipDistance;
         bool m_updateTransformEnabled = false;
         bool m_useSimpleModels = true;
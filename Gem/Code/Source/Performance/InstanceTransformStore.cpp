@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/InstanceTransformStore.h>
+#include <Utils/ParallelForChunks.h>
+
+namespace AtomSampleViewer
+{
+    void InstanceTransformStore::Reserve(size_t count)
+    {
+        for (AZStd::vector<float>* values : { &m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY, &m_rotationZ, &m_rotationW, &m_scale })
+        {
+            values->reserve(count);
+        }
+    }
+
+    void InstanceTransformStore::Clear()
+    {
+        for (AZStd::vector<float>* values : { &m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY, &m_rotationZ, &m_rotationW, &m_scale,
+                                              &m_worldRotationX, &m_worldRotationY, &m_worldRotationZ, &m_worldRotationW })
+        {
+            values->clear();
+        }
+        m_worldTransforms.clear();
+    }
+
+    void InstanceTransformStore::Add(const AZ::Transform& transform)
+    {
+        const AZ::Vector3& position = transform.GetTranslation();
+        const AZ::Quaternion& rotation = transform.GetRotation();
+        m_positionX.push_back(position.GetX());
+        m_positionY.push_back(position.GetY());
+        m_positionZ.push_back(position.GetZ());
+        m_rotationX.push_back(rotation.GetX());
+        m_rotationY.push_back(rotation.GetY());
+        m_rotationZ.push_back(rotation.GetZ());
+        m_rotationW.push_back(rotation.GetW());
+        m_scale.push_back(transform.GetUniformScale());
+    }
+
+    void InstanceTransformStore::Add(AZStd::span<const AZ::Transform> transforms)
+    {
+        const size_t first = GetCount();
+        for (AZStd::vector<float>* values : { &m_positionX, &m_positionY, &m_positionZ, &m_rotationX, &m_rotationY, &m_rotationZ, &m_rotationW, &m_scale })
+        {
+            values->resize(first + transforms.size());
+        }
+
+        Utils::ParallelForChunks(transforms.size(), InstancesPerJob, [this, transforms, first](size_t, size_t chunkFirst, size_t chunkCount)
+            {
+                SetRange(transforms.subspan(chunkFirst, chunkCount), first + chunkFirst);
+            });
+    }
+
+    void InstanceTransformStore::SetRange(AZStd::span<const AZ::Transform> transforms, size_t first)
+    {
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            const AZ::Vector3& position = transforms[i].GetTranslation();
+            const AZ::Quaternion& rotation = transforms[i].GetRotation();
+            m_positionX[first + i] = position.GetX();
+            m_positionY[first + i] = position.GetY();
+            m_positionZ[first + i] = position.GetZ();
+            m_rotationX[first + i] = rotation.GetX();
+            m_rotationY[first + i] = rotation.GetY();
+            m_rotationZ[first + i] = rotation.GetZ();
+            m_rotationW[first + i] = rotation.GetW();
+            m_scale[first + i] = transforms[i].GetUniformScale();
+        }
+    }
+
+    AZ::Transform InstanceTransformStore::GetTransform(size_t index) const
+    {
+        return AZ::Transform(
+            AZ::Vector3(m_positionX[index], m_positionY[index], m_positionZ[index]),
+            AZ::Quaternion(m_rotationX[index], m_rotationY[index], m_rotationZ[index], m_rotationW[index]),
+            m_scale[index]);
+    }
+
+    void InstanceTransformStore::UpdateRotated(const AZ::Quaternion& rotation)
+    {
+        const size_t count = GetCount();
+        m_worldRotationX.resize(count);
+        m_worldRotationY.resize(count);
+        m_worldRotationZ.resize(count);
+        m_worldRotationW.resize(count);
+        m_worldTransforms.resize(count, AZ::Transform::CreateIdentity());
+
+        Utils::ParallelForChunks(count, InstancesPerJob, [this, &rotation](size_t, size_t first, size_t chunkCount)
+            {
+                UpdateRotatedRange(rotation, first, chunkCount);
+            });
+    }
+
+    void InstanceTransformStore::UpdateRotatedRange(const AZ::Quaternion& rotation, size_t first, size_t count)
+    {
+        AZ_Assert(first + count <= m_worldTransforms.size(), "UpdateRotated() must size the outputs before updating a range");
+
+        const float rx = rotation.GetX();
+        const float ry = rotation.GetY();
+        const float rz = rotation.GetZ();
+        const float rw = rotation.GetW();
+
+        const float* __restrict x = m_rotationX.data() + first;
+        const float* __restrict y = m_rotationY.data() + first;
+        const float* __restrict z = m_rotationZ.data() + first;
+        const float* __restrict w = m_rotationW.data() + first;
+        float* __restrict outX = m_worldRotationX.data() + first;
+        float* __restrict outY = m_worldRotationY.data() + first;
+        float* __restrict outZ = m_worldRotationZ.data() + first;
+        float* __restrict outW = m_worldRotationW.data() + first;
+
+        // Quaternion product instanceRotation * rotation. Translation and scale are unchanged, because the rotation is applied
+        // in the instance's local space.
+        for (size_t i = 0; i < count; ++i)
+        {
+            outX[i] = w[i] * rx + x[i] * rw + y[i] * rz - z[i] * ry;
+            outY[i] = w[i] * ry - x[i] * rz + y[i] * rw + z[i] * rx;
+            outZ[i] = w[i] * rz + x[i] * ry - y[i] * rx + z[i] * rw;
+            outW[i] = w[i] * rw - x[i] * rx - y[i] * ry - z[i] * rz;
+        }
+
+        for (size_t i = first; i < first + count; ++i)
+        {
+            m_worldTransforms[i] = AZ::Transform(
+                AZ::Vector3(m_positionX[i], m_positionY[i], m_positionZ[i]),
+                AZ::Quaternion(m_worldRotationX[i], m_worldRotationY[i], m_worldRotationZ[i], m_worldRotationW[i]),
+                m_scale[i]);
+        }
+    }
+} // namespace AtomSampleViewer
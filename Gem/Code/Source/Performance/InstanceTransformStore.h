@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Stores the transforms of many instances as a structure of arrays, so per-frame updates stream through contiguous
+    //! floats instead of strided AZ::Transform objects. The update kernels are plain loops over those arrays, which the
+    //! compiler vectorizes, and large stores are split into chunks that run on the job system.
+    class InstanceTransformStore
+    {
+    public:
+        //! Stores with fewer instances than this are updated on the calling thread.
+        static constexpr size_t InstancesPerJob = 8192;
+
+        void Reserve(size_t count);
+        void Clear();
+        void Add(const AZ::Transform& transform);
+
+        //! Adds many instances at once. The arrays are resized once and large ranges are split across jobs.
+        void Add(AZStd::span<const AZ::Transform> transforms);
+
+        size_t GetCount() const { return m_scale.size(); }
+
+        //! Returns the transform the instance was added with.
+        AZ::Transform GetTransform(size_t index) const;
+
+        //! Sets each world transform to the instance's transform followed by the given rotation in its local space, which is the
+        //! same as GetTransform(i) * AZ::Transform::CreateFromQuaternion(rotation).
+        void UpdateRotated(const AZ::Quaternion& rotation);
+
+        //! Same as UpdateRotated() for a range of instances, on the calling thread.
+        void UpdateRotatedRange(const AZ::Quaternion& rotation, size_t first, size_t count);
+
+        //! The results of the last update, one per instance. Instances that were never updated have an identity transform.
+        AZStd::span<const AZ::Transform> GetWorldTransforms() const { return m_worldTransforms; }
+
+    private:
+        //! Writes the transforms into instances [first, first + transforms.size()), which must already exist.
+        void SetRange(AZStd::span<const AZ::Transform> transforms, size_t first);
+
+        AZStd::vector<float> m_positionX;
+        AZStd::vector<float> m_positionY;
+        AZStd::vector<float> m_positionZ;
+        AZStd::vector<float> m_rotationX;
+        AZStd::vector<float> m_rotationY;
+        AZStd::vector<float> m_rotationZ;
+        AZStd::vector<float> m_rotationW;
+        AZStd::vector<float> m_scale;
+
+        // Rotations computed by the kernel, before they're assembled into m_worldTransforms
+        AZStd::vector<float> m_worldRotationX;
+        AZStd::vector<float> m_worldRotationY;
+        AZStd::vector<float> m_worldRotationZ;
+        AZStd::vector<float> m_worldRotationW;
+
+        AZStd::vector<AZ::Transform> m_worldTransforms;
+    };
+} // namespace AtomSampleViewer
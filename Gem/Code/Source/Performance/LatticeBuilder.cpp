@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/LatticeBuilder.h>
+#include <Utils/ParallelForChunks.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace AtomSampleViewer
+{
+    AZ::Aabb LatticeBuilder::Build(const Layout& layout, AZStd::vector<AZ::Transform>& transforms)
+    {
+        const size_t count = static_cast<size_t>(layout.m_width) * layout.m_depth * layout.m_height;
+        transforms.resize(count);
+
+        // Each chunk writes its own slice of the transforms and its own bounds, so nothing is shared until the reduction
+        AZStd::vector<AZ::Aabb> jobBounds(Utils::GetChunkCount(count, CellsPerJob), AZ::Aabb::CreateNull());
+        Utils::ParallelForChunks(count, CellsPerJob, [&layout, &transforms, &jobBounds](size_t chunk, size_t first, size_t cellCount)
+            {
+                jobBounds[chunk] = BuildRange(layout, first, AZStd::span<AZ::Transform>(transforms.data() + first, cellCount));
+            });
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        for (const AZ::Aabb& jobBound : jobBounds)
+        {
+            bounds.AddAabb(jobBound);
+        }
+        return bounds;
+    }
+
+    AZ::Aabb LatticeBuilder::BuildRange(const Layout& layout, size_t first, AZStd::span<AZ::Transform> transforms)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        if (transforms.empty())
+        {
+            return bounds;
+        }
+
+        // We first rotate the model by 180 degrees before translating it. This is to make it face the camera as it did
+        // when the world was Y-up.
+        AZ::Transform cellTransform = AZ::Transform::CreateRotationZ(AZ::Constants::Pi);
+        cellTransform.SetUniformScale(layout.m_entityScale);
+
+        // Only the first cell needs the divisions, the rest step through the lattice like the nested loops would
+        const size_t cellsPerSlice = static_cast<size_t>(layout.m_depth) * layout.m_height;
+        uint32_t x = static_cast<uint32_t>(first / cellsPerSlice);
+        uint32_t y = static_cast<uint32_t>((first / layout.m_height) % layout.m_depth);
+        uint32_t z = static_cast<uint32_t>(first % layout.m_height);
+
+        for (AZ::Transform& transform : transforms)
+        {
+            const AZ::Vector3 position = AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * layout.m_spacing;
+            cellTransform.SetTranslation(position);
+            transform = cellTransform;
+            bounds.AddPoint(position);
+
+            if (++z == layout.m_height)
+            {
+                z = 0;
+                if (++y == layout.m_depth)
+                {
+                    y = 0;
+                    ++x;
+                }
+            }
+        }
+
+        return bounds;
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AtomSampleViewer
+{
+    //! Generates the transforms of the cells of an entity lattice. Large lattices are generated in chunks on the job system,
+    //! each of which also computes the bounds of its cells, and the lattice bounds are reduced from those.
+    class LatticeBuilder
+    {
+    public:
+        //! Lattices with fewer cells than this are built on the calling thread.
+        static constexpr size_t CellsPerJob = 4096;
+
+        struct Layout
+        {
+            uint32_t m_width = 1;
+            uint32_t m_depth = 1;
+            uint32_t m_height = 1;
+            AZ::Vector3 m_spacing = AZ::Vector3::CreateOne();
+            float m_entityScale = 1.0f;
+        };
+
+        //! Resizes the transforms to one per cell and fills them ordered by x, then y, then z, with z varying fastest.
+        //! Returns the bounds of the cell positions, which is null for an empty lattice.
+        static AZ::Aabb Build(const Layout& layout, AZStd::vector<AZ::Transform>& transforms);
+
+        //! Fills the transforms of consecutive cells starting at cell index first, on the calling thread, and returns the
+        //! bounds of their positions.
+        static AZ::Aabb BuildRange(const Layout& layout, size_t first, AZStd::span<AZ::Transform> transforms);
+    };
+} // namespace AtomSampleViewer
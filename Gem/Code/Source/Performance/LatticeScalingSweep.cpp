@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/LatticeScalingSweep.h>
+#include <Utils/Utils.h>
+#include <Utils/JsonFile.h>
+
+#include <Atom/RHI/RHISystemInterface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+
+#include <imgui/imgui.h>
+
+#include <math.h>
+
+namespace AtomSampleViewer
+{
+    void LatticeScalingSweep::FitLatticeDimensions(uint32_t instanceCount, uint32_t maxDimension, uint32_t& width, uint32_t& depth, uint32_t& height)
+    {
+        maxDimension = AZStd::max(maxDimension, 1u);
+        const uint64_t maxCount = static_cast<uint64_t>(maxDimension) * maxDimension * maxDimension;
+        const uint64_t count = AZStd::clamp<uint64_t>(instanceCount, 1, maxCount);
+
+        // Try square bases around the cube root, and bases one cell deeper, and pick the height that gets closest to the count.
+        // Ties go to the more cubic lattice.
+        const int64_t cubeRoot = static_cast<int64_t>(cbrt(static_cast<double>(count)) + 0.5);
+        uint64_t bestError = AZStd::numeric_limits<uint64_t>::max();
+        uint32_t bestSpread = AZStd::numeric_limits<uint32_t>::max();
+        for (int64_t side = cubeRoot - 2; side <= cubeRoot + 2; ++side)
+        {
+            if (side < 1 || side > maxDimension)
+            {
+                continue;
+            }
+
+            for (int64_t extraDepth = 0; extraDepth <= 1; ++extraDepth)
+            {
+                const uint64_t candidateWidth = static_cast<uint64_t>(side);
+                const uint64_t candidateDepth = AZStd::min<uint64_t>(candidateWidth + extraDepth, maxDimension);
+                const uint64_t base = candidateWidth * candidateDepth;
+                const uint64_t candidateHeight = AZStd::clamp<uint64_t>((count + base / 2) / base, 1, maxDimension);
+
+                const uint64_t candidateCount = base * candidateHeight;
+                const uint64_t error = candidateCount > count ? candidateCount - count : count - candidateCount;
+                const uint64_t largest = AZStd::max(AZStd::max(candidateWidth, candidateDepth), candidateHeight);
+                const uint64_t smallest = AZStd::min(AZStd::min(candidateWidth, candidateDepth), candidateHeight);
+                const uint32_t spread = static_cast<uint32_t>(largest - smallest);
+                if (error < bestError || (error == bestError && spread < bestSpread))
+                {
+                    bestError = error;
+                    bestSpread = spread;
+                    width = static_cast<uint32_t>(candidateWidth);
+                    depth = static_cast<uint32_t>(candidateDepth);
+                    height = static_cast<uint32_t>(candidateHeight);
+                }
+            }
+        }
+    }
+
+    void LatticeScalingSweep::ComputeScaling(AZStd::span<StepResult> results)
+    {
+        const StepResult* previous = nullptr;
+        for (StepResult& result : results)
+        {
+            result.m_cpuFrameTimePerInstanceUs = 0.0;
+            result.m_memoryPerInstanceBytes = 0.0;
+            result.m_scalingExponent = 0.0;
+
+            if (result.m_timedOut || result.m_instanceCount == 0)
+            {
+                continue;
+            }
+
+            if (!previous || result.m_instanceCount <= previous->m_instanceCount)
+            {
+                // Nothing to difference against, so use the average cost of every instance
+                result.m_cpuFrameTimePerInstanceUs = result.m_cpuFrameTimeMedianMs * 1000.0 / result.m_instanceCount;
+                result.m_memoryPerInstanceBytes = static_cast<double>(result.m_processMemoryBytes) / result.m_instanceCount;
+            }
+            else
+            {
+                const double addedInstances = static_cast<double>(result.m_instanceCount - previous->m_instanceCount);
+                result.m_cpuFrameTimePerInstanceUs = (result.m_cpuFrameTimeMedianMs - previous->m_cpuFrameTimeMedianMs) * 1000.0 / addedInstances;
+                result.m_memoryPerInstanceBytes =
+                    (static_cast<double>(result.m_processMemoryBytes) - static_cast<double>(previous->m_processMemoryBytes)) / addedInstances;
+
+                if (result.m_cpuFrameTimeMedianMs > 0.0f && previous->m_cpuFrameTimeMedianMs > 0.0f)
+                {
+                    result.m_scalingExponent = log(static_cast<double>(result.m_cpuFrameTimeMedianMs) / previous->m_cpuFrameTimeMedianMs) /
+                        log(static_cast<double>(result.m_instanceCount) / previous->m_instanceCount);
+                }
+            }
+
+            previous = &result;
+        }
+    }
+
+    bool LatticeScalingSweep::ParseInstanceCounts(AZStd::string_view text, AZStd::vector<uint32_t>& instanceCounts)
+    {
+        instanceCounts.clear();
+
+        while (!text.empty())
+        {
+            const size_t separator = text.find(',');
+            AZStd::string entry(text.substr(0, separator));
+            text = separator == AZStd::string_view::npos ? AZStd::string_view() : text.substr(separator + 1);
+
+            AzFramework::StringFunc::TrimWhiteSpace(entry, true, true);
+            if (entry.empty() || entry.find_first_not_of("0123456789") != AZStd::string::npos)
+            {
+                return false;
+            }
+
+            const unsigned long long value = AZStd::stoull(entry);
+            if (value == 0 || value > AZStd::numeric_limits<uint32_t>::max())
+            {
+                return false;
+            }
+            instanceCounts.push_back(static_cast<uint32_t>(value));
+        }
+
+        return !instanceCounts.empty();
+    }
+
+    LatticeScalingSweep::~LatticeScalingSweep()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    bool LatticeScalingSweep::Start(const Settings& settings, const Callbacks& callbacks)
+    {
+        if (IsRunning() || settings.m_instanceCounts.empty() || settings.m_captureFrames == 0 || !callbacks.m_buildLattice || !callbacks.m_isLatticeReady)
+        {
+            return false;
+        }
+
+        m_settings = settings;
+        AZStd::sort(m_settings.m_instanceCounts.begin(), m_settings.m_instanceCounts.end());
+        m_callbacks = callbacks;
+        if (!m_callbacks.m_getProcessMemoryBytes)
+        {
+            m_callbacks.m_getProcessMemoryBytes = &Utils::GetProcessResidentMemoryBytes;
+        }
+
+        m_results.clear();
+        m_results.reserve(m_settings.m_instanceCounts.size());
+        m_stepIndex = 0;
+
+        AZ::TickBus::Handler::BusConnect();
+        BeginStep();
+        return true;
+    }
+
+    void LatticeScalingSweep::Stop()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        // The step in progress has no measurements yet
+        m_results.pop_back();
+        EndSweep(false);
+    }
+
+    void LatticeScalingSweep::BeginStep()
+    {
+        StepResult result;
+        result.m_requestedInstanceCount = m_settings.m_instanceCounts[m_stepIndex];
+        FitLatticeDimensions(result.m_requestedInstanceCount, m_settings.m_maxDimension, result.m_width, result.m_depth, result.m_height);
+        result.m_instanceCount = result.m_width * result.m_depth * result.m_height;
+        m_results.push_back(result);
+
+        AZ_TracePrintf("LatticeScalingSweep", "Step %zu/%zu: %u instances (%ux%ux%u)\n", m_stepIndex + 1, m_settings.m_instanceCounts.size(),
+            result.m_instanceCount, result.m_width, result.m_depth, result.m_height);
+
+        m_phase = Phase::Activating;
+        m_phaseFrames = 0;
+        m_stepStartTime = Clock::now();
+        m_callbacks.m_buildLattice(result.m_width, result.m_depth, result.m_height);
+    }
+
+    void LatticeScalingSweep::NextStep()
+    {
+        ComputeScaling(m_results);
+
+        ++m_stepIndex;
+        if (m_stepIndex < m_settings.m_instanceCounts.size())
+        {
+            BeginStep();
+        }
+        else
+        {
+            EndSweep(true);
+        }
+    }
+
+    void LatticeScalingSweep::EndSweep(bool notify)
+    {
+        m_phase = Phase::Idle;
+        AZ::TickBus::Handler::BusDisconnect();
+
+        if (!m_settings.m_outputFilePath.empty())
+        {
+            if (WriteResults(m_settings.m_outputFilePath))
+            {
+                AZ_TracePrintf("LatticeScalingSweep", "Wrote %zu steps to '%s'\n", m_results.size(), m_settings.m_outputFilePath.c_str());
+            }
+            else
+            {
+                AZ_Error("LatticeScalingSweep", false, "Failed to write '%s'", m_settings.m_outputFilePath.c_str());
+            }
+        }
+
+        if (notify && m_callbacks.m_sweepFinished)
+        {
+            m_callbacks.m_sweepFinished();
+        }
+    }
+
+    void LatticeScalingSweep::Update(float cpuFrameTimeMs)
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        StepResult& result = m_results.back();
+        switch (m_phase)
+        {
+        case Phase::Activating:
+        {
+            using Milliseconds = AZStd::chrono::duration<float, AZStd::milli>;
+            const float elapsedMs = AZStd::chrono::duration_cast<Milliseconds>(Clock::now() - m_stepStartTime).count();
+            if (m_callbacks.m_isLatticeReady())
+            {
+                result.m_activationTimeMs = elapsedMs;
+                m_phase = Phase::Warmup;
+                m_phaseFrames = 0;
+            }
+            else if (elapsedMs > m_settings.m_activationTimeoutSeconds * 1000.0f)
+            {
+                AZ_Warning("LatticeScalingSweep", false, "The lattice of %u instances wasn't ready after %.0f seconds, skipping it",
+                    result.m_instanceCount, m_settings.m_activationTimeoutSeconds);
+                result.m_timedOut = true;
+                result.m_activationTimeMs = elapsedMs;
+                NextStep();
+            }
+            break;
+        }
+        case Phase::Warmup:
+            if (++m_phaseFrames >= m_settings.m_warmupFrames)
+            {
+                m_phase = Phase::Capturing;
+                m_phaseFrames = 0;
+                m_cpuFrameTimeStatistics.Reset();
+            }
+            break;
+        case Phase::Capturing:
+            m_cpuFrameTimeStatistics.PushValue(cpuFrameTimeMs);
+            if (++m_phaseFrames >= m_settings.m_captureFrames)
+            {
+                result.m_cpuFrameTimeMeanMs = m_cpuFrameTimeStatistics.GetMean();
+                result.m_cpuFrameTimeMedianMs = m_cpuFrameTimeStatistics.GetMedian();
+                result.m_cpuFrameTimeP99Ms = m_cpuFrameTimeStatistics.GetQuantile(FrameTimeStatistics::Quantile::P99);
+                result.m_processMemoryBytes = m_callbacks.m_getProcessMemoryBytes();
+                NextStep();
+            }
+            break;
+        case Phase::Idle:
+            break;
+        }
+    }
+
+    void LatticeScalingSweep::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        Update(static_cast<float>(AZ::RHI::RHISystemInterface::Get()->GetCpuFrameTime()));
+    }
+
+    bool LatticeScalingSweep::WriteResults(const AZStd::string& filePath) const
+    {
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("warmupFrames");
+                writer.Uint(m_settings.m_warmupFrames);
+                writer.Key("captureFrames");
+                writer.Uint(m_settings.m_captureFrames);
+
+                writer.Key("steps");
+                writer.StartArray();
+                for (const StepResult& result : m_results)
+                {
+                    writer.StartObject();
+                    writer.Key("requestedInstanceCount");
+                    writer.Uint(result.m_requestedInstanceCount);
+                    writer.Key("instanceCount");
+                    writer.Uint(result.m_instanceCount);
+                    writer.Key("dimensions");
+                    writer.StartArray();
+                    writer.Uint(result.m_width);
+                    writer.Uint(result.m_depth);
+                    writer.Uint(result.m_height);
+                    writer.EndArray();
+                    writer.Key("timedOut");
+                    writer.Bool(result.m_timedOut);
+                    writer.Key("activationTimeMs");
+                    writer.Double(result.m_activationTimeMs);
+                    writer.Key("cpuFrameTimeMeanMs");
+                    writer.Double(result.m_cpuFrameTimeMeanMs);
+                    writer.Key("cpuFrameTimeMedianMs");
+                    writer.Double(result.m_cpuFrameTimeMedianMs);
+                    writer.Key("cpuFrameTimeP99Ms");
+                    writer.Double(result.m_cpuFrameTimeP99Ms);
+                    writer.Key("processMemoryBytes");
+                    writer.Uint64(result.m_processMemoryBytes);
+                    writer.Key("cpuFrameTimePerInstanceUs");
+                    writer.Double(result.m_cpuFrameTimePerInstanceUs);
+                    writer.Key("memoryPerInstanceBytes");
+                    writer.Double(result.m_memoryPerInstanceBytes);
+                    writer.Key("scalingExponent");
+                    writer.Double(result.m_scalingExponent);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+                writer.EndObject();
+            });
+    }
+
+    void LatticeScalingSweep::DrawImGui() const
+    {
+        if (IsRunning())
+        {
+            const char* phaseNames[] = { "idle", "waiting for the lattice", "warming up", "capturing" };
+            ImGui::Text("Scaling Sweep: step %zu/%zu, %s", m_stepIndex + 1, m_settings.m_instanceCounts.size(), phaseNames[static_cast<int>(m_phase)]);
+        }
+        else if (!m_results.empty())
+        {
+            ImGui::Text("Scaling Sweep");
+        }
+
+        for (const StepResult& result : m_results)
+        {
+            if (IsRunning() && &result == &m_results.back())
+            {
+                break;
+            }
+
+            if (result.m_timedOut)
+            {
+                ImGui::Text("%8u: timed out", result.m_instanceCount);
+            }
+            else
+            {
+                ImGui::Text("%8u: %.2f ms, %.0f MiB, %.2f us/instance, exponent %.2f", result.m_instanceCount, result.m_cpuFrameTimeMedianMs,
+                    result.m_processMemoryBytes / (1024.0 * 1024.0), result.m_cpuFrameTimePerInstanceUs, result.m_scalingExponent);
+            }
+        }
+    }
+} // namespace AtomSampleViewer
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Utils/FrameTimeStatistics.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Steps an entity lattice through a list of instance counts and records how the cost grows with the count.
+    //! For each step the lattice is rebuilt, then the sweep waits for the sample to report that the lattice is ready,
+    //! idles for some warmup frames and captures the CPU frame time for a number of frames. The results form a scaling
+    //! curve, which shows where per-instance costs go superlinear.
+    class LatticeScalingSweep
+        : public AZ::TickBus::Handler
+    {
+    public:
+        struct Settings
+        {
+            AZStd::vector<uint32_t> m_instanceCounts;
+            uint32_t m_maxDimension = 100;          //!< Largest width, depth or height the lattice supports
+            uint32_t m_warmupFrames = 60;           //!< Frames between the lattice becoming ready and the capture
+            uint32_t m_captureFrames = 120;
+            float m_activationTimeoutSeconds = 120.0f;
+            AZStd::string m_outputFilePath;         //!< The results are written here as JSON when the sweep ends, if not empty
+        };
+
+        //! How the sweep drives the sample that owns the lattice
+        struct Callbacks
+        {
+            AZStd::function<void(uint32_t width, uint32_t depth, uint32_t height)> m_buildLattice;
+            AZStd::function<bool()> m_isLatticeReady;
+            AZStd::function<uint64_t()> m_getProcessMemoryBytes;   //!< Optional, defaults to Utils::GetProcessResidentMemoryBytes()
+            AZStd::function<void()> m_sweepFinished;               //!< Optional, called after the last step
+        };
+
+        struct StepResult
+        {
+            uint32_t m_requestedInstanceCount = 0;
+            uint32_t m_instanceCount = 0;           //!< The count of the lattice that was built, the closest the dimensions allow
+            uint32_t m_width = 0;
+            uint32_t m_depth = 0;
+            uint32_t m_height = 0;
+            float m_activationTimeMs = 0.0f;        //!< From rebuilding the lattice to the sample reporting it ready
+            bool m_timedOut = false;                //!< The lattice wasn't ready within the timeout, no frames were captured
+            double m_cpuFrameTimeMeanMs = 0.0;
+            float m_cpuFrameTimeMedianMs = 0.0f;
+            float m_cpuFrameTimeP99Ms = 0.0f;
+            uint64_t m_processMemoryBytes = 0;      //!< Resident memory at the end of the capture
+
+            // Derived from the previous step by ComputeScaling()
+            double m_cpuFrameTimePerInstanceUs = 0.0;    //!< Marginal frame time of each added instance
+            double m_memoryPerInstanceBytes = 0.0;       //!< Marginal memory of each added instance
+            double m_scalingExponent = 0.0;              //!< Local slope of log(frame time) over log(count), 1 is linear
+        };
+
+        //! Picks near-cubic lattice dimensions whose product is as close as possible to the instance count.
+        static void FitLatticeDimensions(uint32_t instanceCount, uint32_t maxDimension, uint32_t& width, uint32_t& depth, uint32_t& height);
+
+        //! Fills the derived fields of each result from the step before it. The results must be sorted by instance count.
+        static void ComputeScaling(AZStd::span<StepResult> results);
+
+        //! Parses a list of instance counts separated by commas, such as "1000, 8000, 27000". Returns false if any entry is invalid.
+        static bool ParseInstanceCounts(AZStd::string_view text, AZStd::vector<uint32_t>& instanceCounts);
+
+        ~LatticeScalingSweep() override;
+
+        //! Returns false and does nothing if the settings are invalid. The instance counts are swept in ascending order.
+        bool Start(const Settings& settings, const Callbacks& callbacks);
+
+        //! Ends the sweep early, keeping the results of the finished steps. The results are written, but m_sweepFinished isn't called.
+        void Stop();
+
+        bool IsRunning() const { return m_phase != Phase::Idle; }
+
+        //! Advances the sweep by one frame. This is called on tick while the sweep is running.
+        void Update(float cpuFrameTimeMs);
+
+        AZStd::span<const StepResult> GetResults() const { return m_results; }
+
+        bool WriteResults(const AZStd::string& filePath) const;
+
+        void DrawImGui() const;
+
+    private:
+        // AZ::TickBus::Handler overrides...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        void BeginStep();
+        void NextStep();
+        void EndSweep(bool notify);
+
+        enum class Phase
+        {
+            Idle,
+            Activating,
+            Warmup,
+            Capturing
+        };
+
+        using Clock = AZStd::chrono::steady_clock;
+
+        Settings m_settings;
+        Callbacks m_callbacks;
+        Phase m_phase = Phase::Idle;
+        size_t m_stepIndex = 0;
+        uint32_t m_phaseFrames = 0;
+        Clock::time_point m_stepStartTime;
+        FrameTimeStatistics m_cpuFrameTimeStatistics;
+        AZStd::vector<StepResult> m_results;
+    };
+} // namespace AtomSampleViewer
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/SampleSwitchProfiler.h>
+#include <Utils/JsonFile.h>
+
+#include <AzCore/std/chrono/chrono.h>
+
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        struct PhaseMeans
+        {
+            uint32_t m_switchCount = 0;
+            AZStd::array<double, SampleSwitchProfiler::PhaseCount> m_phaseMs = {};
+            double m_totalMs = 0.0;
+        };
+
+        PhaseMeans GetPhaseMeans(const AZStd::vector<SampleSwitchProfiler::SwitchRecord>& records, bool isWarmStart)
+        {
+            PhaseMeans means;
+            for (const SampleSwitchProfiler::SwitchRecord& record : records)
+            {
+                if (record.m_isWarmStart == isWarmStart)
+                {
+                    ++means.m_switchCount;
+                    for (uint32_t i = 0; i < SampleSwitchProfiler::PhaseCount; ++i)
+                    {
+                        means.m_phaseMs[i] += record.m_phaseMs[i];
+                    }
+                    means.m_totalMs += record.m_totalMs;
+                }
+            }
+            if (means.m_switchCount > 0)
+            {
+                for (double& phaseMs : means.m_phaseMs)
+                {
+                    phaseMs /= means.m_switchCount;
+                }
+                means.m_totalMs /= means.m_switchCount;
+            }
+            return means;
+        }
+
+        void WritePhases(Utils::JsonWriter& writer, const AZStd::array<double, SampleSwitchProfiler::PhaseCount>& phaseMs)
+        {
+            writer.StartObject();
+            for (uint32_t i = 0; i < SampleSwitchProfiler::PhaseCount; ++i)
+            {
+                writer.Key(SampleSwitchProfiler::GetPhaseName(static_cast<SampleSwitchProfiler::Phase>(i)));
+                writer.Double(phaseMs[i]);
+            }
+            writer.EndObject();
+        }
+    }
+
+    const char* SampleSwitchProfiler::GetPhaseName(Phase phase)
+    {
+        switch (phase)
+        {
+        case Phase::Shutdown:
+            return "Shutdown";
+        case Phase::SceneTeardown:
+            return "SceneTeardown";
+        case Phase::PipelineCreation:
+            return "PipelineCreation";
+        case Phase::AssetPreload:
+            return "AssetPreload";
+        case Phase::FirstFrame:
+            return "FirstFrame";
+        default:
+            return "";
+        }
+    }
+
+    SampleSwitchProfiler::SampleSwitchProfiler(TimeSource timeSource)
+        : m_timeSource(AZStd::move(timeSource))
+    {
+        if (!m_timeSource)
+        {
+            m_timeSource = []()
+            {
+                using Milliseconds = AZStd::chrono::duration<double, AZStd::milli>;
+                return AZStd::chrono::duration_cast<Milliseconds>(AZStd::chrono::steady_clock::now().time_since_epoch()).count();
+            };
+        }
+    }
+
+    void SampleSwitchProfiler::BeginSwitch(AZStd::string_view sampleName)
+    {
+        if (m_isSwitching)
+        {
+            CompleteSwitch();
+        }
+
+        m_currentRecord = SwitchRecord();
+        m_currentRecord.m_sampleName = sampleName;
+        m_currentPhase = Phase::Shutdown;
+        m_switchStartMs = m_phaseStartMs = m_timeSource();
+        m_isSwitching = true;
+    }
+
+    void SampleSwitchProfiler::BeginPhase(Phase phase)
+    {
+        if (!m_isSwitching)
+        {
+            return;
+        }
+
+        const double nowMs = m_timeSource();
+        m_currentRecord.m_phaseMs[static_cast<uint32_t>(m_currentPhase)] += nowMs - m_phaseStartMs;
+        m_currentPhase = phase;
+        m_phaseStartMs = nowMs;
+    }
+
+    void SampleSwitchProfiler::SetWarmStart(bool isWarmStart)
+    {
+        m_currentRecord.m_isWarmStart = isWarmStart;
+    }
+
+    void SampleSwitchProfiler::EndSwitchSetup()
+    {
+        BeginPhase(Phase::FirstFrame);
+    }
+
+    void SampleSwitchProfiler::OnFrameBegin()
+    {
+        if (m_isSwitching && m_currentPhase == Phase::FirstFrame)
+        {
+            CompleteSwitch();
+        }
+    }
+
+    void SampleSwitchProfiler::CompleteSwitch()
+    {
+        const double nowMs = m_timeSource();
+        m_currentRecord.m_phaseMs[static_cast<uint32_t>(m_currentPhase)] += nowMs - m_phaseStartMs;
+        m_currentRecord.m_totalMs = nowMs - m_switchStartMs;
+        m_records.push_back(AZStd::move(m_currentRecord));
+        m_isSwitching = false;
+    }
+
+    void SampleSwitchProfiler::Reset()
+    {
+        m_records.clear();
+    }
+
+    bool SampleSwitchProfiler::WriteRecords(const AZStd::string& filePath) const
+    {
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("switches");
+                writer.StartArray();
+                for (const SwitchRecord& record : m_records)
+                {
+                    writer.StartObject();
+                    writer.Key("sample");
+                    writer.String(record.m_sampleName.c_str());
+                    writer.Key("warmStart");
+                    writer.Bool(record.m_isWarmStart);
+                    writer.Key("phasesMs");
+                    WritePhases(writer, record.m_phaseMs);
+                    writer.Key("totalMs");
+                    writer.Double(record.m_totalMs);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+
+                for (bool isWarmStart : { false, true })
+                {
+                    const PhaseMeans means = GetPhaseMeans(m_records, isWarmStart);
+                    writer.Key(isWarmStart ? "warm" : "cold");
+                    writer.StartObject();
+                    writer.Key("switches");
+                    writer.Uint(means.m_switchCount);
+                    writer.Key("meanPhasesMs");
+                    WritePhases(writer, means.m_phaseMs);
+                    writer.Key("meanTotalMs");
+                    writer.Double(means.m_totalMs);
+                    writer.EndObject();
+                }
+                writer.EndObject();
+            });
+    }
+
+    void SampleSwitchProfiler::DrawImGui() const
+    {
+        const PhaseMeans coldMeans = GetPhaseMeans(m_records, false);
+        const PhaseMeans warmMeans = GetPhaseMeans(m_records, true);
+
+        if (!m_records.empty())
+        {
+            ImGui::Text("Last switch: %s (%s)", m_records.back().m_sampleName.c_str(), m_records.back().m_isWarmStart ? "warm" : "cold");
+        }
+
+        ImGui::Columns(4);
+        const char* columnNames[] = { "Phase", "Last (ms)", "Cold mean", "Warm mean" };
+        for (const char* columnName : columnNames)
+        {
+            ImGui::Text("%s", columnName);
+            ImGui::NextColumn();
+        }
+        for (uint32_t i = 0; i <= PhaseCount; ++i)
+        {
+            const bool isTotal = i == PhaseCount;
+            ImGui::Text("%s", isTotal ? "Total" : GetPhaseName(static_cast<Phase>(i)));
+            ImGui::NextColumn();
+            ImGui::Text("%.2f", m_records.empty() ? 0.0 : (isTotal ? m_records.back().m_totalMs : m_records.back().m_phaseMs[i]));
+            ImGui::NextColumn();
+            ImGui::Text("%.2f", isTotal ? coldMeans.m_totalMs : coldMeans.m_phaseMs[i]);
+            ImGui::NextColumn();
+            ImGui::Text("%.2f", isTotal ? warmMeans.m_totalMs : warmMeans.m_phaseMs[i]);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::Text("Switches: %u cold, %u warm", coldMeans.m_switchCount, warmMeans.m_switchCount);
+    }
+} // namespace AtomSampleViewer
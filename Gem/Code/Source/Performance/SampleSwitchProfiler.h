@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Records how long each phase of a sample switch takes, from shutting down the previous sample to the first frame of
+    //! the new one, so that switch cost can be tracked over whole test suites.
+    class SampleSwitchProfiler
+    {
+    public:
+        enum class Phase : uint32_t
+        {
+            Shutdown,           //!< Deactivating and destroying the previous sample
+            SceneTeardown,      //!< Releasing the previous scene and its pipelines
+            PipelineCreation,   //!< Creating the scene and pipelines for the new sample
+            AssetPreload,       //!< Activating the new sample, which is where samples load their assets
+            FirstFrame,         //!< The rest of the frame the new sample was activated in
+            Count
+        };
+
+        static constexpr uint32_t PhaseCount = static_cast<uint32_t>(Phase::Count);
+
+        struct SwitchRecord
+        {
+            AZStd::string m_sampleName;
+            bool m_isWarmStart = false;     //!< The scene and pipelines of the previous sample were reused
+            AZStd::array<double, PhaseCount> m_phaseMs = {};
+            double m_totalMs = 0.0;
+        };
+
+        //! Returns the current time in milliseconds
+        using TimeSource = AZStd::function<double()>;
+
+        static const char* GetPhaseName(Phase phase);
+
+        //! @param timeSource the clock used for the measurements, the steady clock if empty
+        explicit SampleSwitchProfiler(TimeSource timeSource = {});
+
+        //! Starts recording a switch to the sample with the Shutdown phase, completing a switch that is still open.
+        void BeginSwitch(AZStd::string_view sampleName);
+
+        //! Ends the current phase and starts the next one. Phases that are skipped are recorded as 0 ms.
+        void BeginPhase(Phase phase);
+
+        void SetWarmStart(bool isWarmStart);
+
+        //! Starts the FirstFrame phase, which ends with the next call to OnFrameBegin().
+        void EndSwitchSetup();
+
+        //! Completes a switch that is waiting for its first frame. Call at the start of every frame.
+        void OnFrameBegin();
+
+        bool IsSwitching() const { return m_isSwitching; }
+
+        const AZStd::vector<SwitchRecord>& GetRecords() const { return m_records; }
+        void Reset();
+
+        //! Writes every recorded switch and the mean phase times of cold and warm switches to a JSON file.
+        bool WriteRecords(const AZStd::string& filePath) const;
+
+        void DrawImGui() const;
+
+    private:
+        void CompleteSwitch();
+
+        TimeSource m_timeSource;
+        AZStd::vector<SwitchRecord> m_records;
+        SwitchRecord m_currentRecord;
+        Phase m_currentPhase = Phase::Shutdown;
+        double m_switchStartMs = 0.0;
+        double m_phaseStartMs = 0.0;
+        bool m_isSwitching = false;
+    };
+} // namespace AtomSampleViewer
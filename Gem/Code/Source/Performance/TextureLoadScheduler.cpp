@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Performance/TextureLoadScheduler.h>
+
+#include <AzCore/std/algorithm.h>
+
+namespace AtomSampleViewer
+{
+    const char* TextureLoadScheduler::GetPolicyName(Policy policy)
+    {
+        switch (policy)
+        {
+        case Policy::Fifo:
+            return "FIFO";
+        case Policy::Prioritized:
+            return "Prioritized";
+        default:
+            return "";
+        }
+    }
+
+    float TextureLoadScheduler::ComputePriority(float screenArea, float distance)
+    {
+        // Keep images at the viewer from dividing by zero
+        constexpr float MinDistance = 0.01f;
+        return screenArea / AZStd::max(distance, MinDistance);
+    }
+
+    bool TextureLoadScheduler::IsIssuedAfter(const Request& lhs, const Request& rhs) const
+    {
+        if (m_policy == Policy::Prioritized && lhs.m_priority != rhs.m_priority)
+        {
+            return lhs.m_priority < rhs.m_priority;
+        }
+        return lhs.m_sequence > rhs.m_sequence;
+    }
+
+    void TextureLoadScheduler::RebuildQueue()
+    {
+        AZStd::make_heap(m_queue.begin(), m_queue.end(), [this](const Request& lhs, const Request& rhs)
+            {
+                return IsIssuedAfter(lhs, rhs);
+            });
+    }
+
+    void TextureLoadScheduler::SetPolicy(Policy policy)
+    {
+        if (m_policy != policy)
+        {
+            m_policy = policy;
+            RebuildQueue();
+        }
+    }
+
+    void TextureLoadScheduler::Enqueue(uint32_t requestId, float priority, uint64_t bytes)
+    {
+        m_queue.push_back({ requestId, priority, bytes, m_nextSequence++ });
+        AZStd::push_heap(m_queue.begin(), m_queue.end(), [this](const Request& lhs, const Request& rhs)
+            {
+                return IsIssuedAfter(lhs, rhs);
+            });
+    }
+
+    uint32_t TextureLoadScheduler::Update(const IssueFunction& issue)
+    {
+        const auto issuedAfter = [this](const Request& lhs, const Request& rhs)
+        {
+            return IsIssuedAfter(lhs, rhs);
+        };
+
+        uint32_t issuedCount = 0;
+        uint64_t issuedBytes = 0;
+        while (!m_queue.empty() && m_inFlight.size() < m_maxInFlightLoads)
+        {
+            const Request& next = m_queue.front();
+            const bool isFirstLoad = issuedCount == 0 && m_inFlight.empty();
+            if (!isFirstLoad && issuedBytes + next.m_bytes > m_maxBytesPerFrame)
+            {
+                break;
+            }
+
+            const Request request = next;
+            AZStd::pop_heap(m_queue.begin(), m_queue.end(), issuedAfter);
+            m_queue.pop_back();
+
+            m_inFlight.push_back(request.m_requestId);
+            issuedBytes += request.m_bytes;
+            ++issuedCount;
+            issue(request.m_requestId);
+        }
+        return issuedCount;
+    }
+
+    void TextureLoadScheduler::OnLoadFinished(uint32_t requestId)
+    {
+        auto iter = AZStd::find(m_inFlight.begin(), m_inFlight.end(), requestId);
+        if (iter != m_inFlight.end())
+        {
+            m_inFlight.erase(iter);
+        }
+    }
+
+    void TextureLoadScheduler::Clear()
+    {
+        m_queue.clear();
+        m_inFlight.clear();
+    }
+} // namespace AtomSampleViewer
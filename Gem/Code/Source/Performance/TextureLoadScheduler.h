@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AtomSampleViewer
+{
+    //! Decides when queued texture loads are issued. Requests wait in a queue, either in the order they were queued or by
+    //! priority, and are issued as long as the number of loads in flight and the bytes issued in the current frame stay
+    //! under their limits. Loads count as in flight until OnLoadFinished() is called for them.
+    class TextureLoadScheduler
+    {
+    public:
+        enum class Policy
+        {
+            Fifo,
+            Prioritized,
+            Count
+        };
+
+        static constexpr uint32_t DefaultMaxInFlightLoads = 8;
+        static constexpr uint64_t DefaultMaxBytesPerFrame = 32 * 1024 * 1024;
+
+        using IssueFunction = AZStd::function<void(uint32_t requestId)>;
+
+        static const char* GetPolicyName(Policy policy);
+
+        //! Returns the screen-space priority of an image: its area on screen divided by its distance from the viewer.
+        static float ComputePriority(float screenArea, float distance);
+
+        //! Changing the policy reorders the requests that are still queued.
+        void SetPolicy(Policy policy);
+        Policy GetPolicy() const { return m_policy; }
+
+        void SetMaxInFlightLoads(uint32_t maxInFlightLoads) { m_maxInFlightLoads = maxInFlightLoads; }
+        uint32_t GetMaxInFlightLoads() const { return m_maxInFlightLoads; }
+
+        void SetMaxBytesPerFrame(uint64_t maxBytesPerFrame) { m_maxBytesPerFrame = maxBytesPerFrame; }
+        uint64_t GetMaxBytesPerFrame() const { return m_maxBytesPerFrame; }
+
+        //! Queues a load. Requests with the same priority are issued in the order they were queued.
+        void Enqueue(uint32_t requestId, float priority, uint64_t bytes);
+
+        //! Issues queued loads until a limit is reached. Each frame issues at least one load if none are in flight, so a
+        //! single load larger than the byte limit isn't stuck. Call once per frame.
+        //! @return the number of loads issued
+        uint32_t Update(const IssueFunction& issue);
+
+        //! Frees the in-flight slot of a load that finished or failed.
+        void OnLoadFinished(uint32_t requestId);
+
+        //! Drops queued requests and forgets loads in flight.
+        void Clear();
+
+        size_t GetQueuedCount() const { return m_queue.size(); }
+        size_t GetInFlightCount() const { return m_inFlight.size(); }
+        bool IsIdle() const { return m_queue.empty() && m_inFlight.empty(); }
+
+    private:
+        struct Request
+        {
+            uint32_t m_requestId = 0;
+            float m_priority = 0.0f;
+            uint64_t m_bytes = 0;
+            uint64_t m_sequence = 0;
+        };
+
+        // Orders the heap so its front is the request to issue next
+        bool IsIssuedAfter(const Request& lhs, const Request& rhs) const;
+        void RebuildQueue();
+
+        Policy m_policy = Policy::Prioritized;
+        uint32_t m_maxInFlightLoads = DefaultMaxInFlightLoads;
+        uint64_t m_maxBytesPerFrame = DefaultMaxBytesPerFrame;
+        uint64_t m_nextSequence = 0;
+        AZStd::vector<Request> m_queue;         //!< A heap ordered by IsIssuedAfter()
+        AZStd::vector<uint32_t> m_inFlight;
+    };
+} // namespace AtomSampleViewer
@@ -7,6 +7,8 @@
  */
 #include <Utils/Utils.h>
 
+#include <stdio.h>
+#include <unistd.h>
 #include <AzCore/PlatformIncl.h>
 
 namespace AtomSampleViewer
@@ -27,5 +29,21 @@ namespace AtomSampleViewer
         {
             return false;
         }
+
+        uint64_t GetProcessResidentMemoryBytes()
+        {
+            // The second field of statm is the resident set size in pages
+            FILE* statm = fopen("/proc/self/statm", "r");
+            if (!statm)
+            {
+                return 0;
+            }
+
+            unsigned long long totalPages = 0;
+            unsigned long long residentPages = 0;
+            const int fieldCount = fscanf(statm, "%llu %llu", &totalPages, &residentPages);
+            fclose(statm);
+            return fieldCount == 2 ? residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+        }
     } // namespace Utils
 } // namespace AtomSampleViewer
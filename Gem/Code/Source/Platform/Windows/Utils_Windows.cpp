@@ -8,6 +8,7 @@
 #include <Utils/Utils.h>
 
 #include <AzCore/PlatformIncl.h>
+#include <psapi.h>
 
 namespace AtomSampleViewer
 {
@@ -60,5 +61,15 @@ namespace AtomSampleViewer
 
             return result;
         }
+
+        uint64_t GetProcessResidentMemoryBytes()
+        {
+            PROCESS_MEMORY_COUNTERS counters;
+            if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            {
+                return 0;
+            }
+            return counters.WorkingSetSize;
+        }
     } // namespace Utils
 } // namespace AtomSampleViewer
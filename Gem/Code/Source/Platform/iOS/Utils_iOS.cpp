@@ -8,6 +8,7 @@
 #include <Utils/Utils.h>
 
 #include <AzCore/PlatformIncl.h>
+#include <mach/mach.h>
 
 namespace AtomSampleViewer
 {
@@ -27,5 +28,16 @@ namespace AtomSampleViewer
         {
             return false;
         }
+
+        uint64_t GetProcessResidentMemoryBytes()
+        {
+            mach_task_basic_info_data_t info;
+            mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+            if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &infoCount) != KERN_SUCCESS)
+            {
+                return 0;
+            }
+            return info.resident_size;
+        }
     } // namespace Utils
 } // namespace AtomSampleViewer
@@ -7,6 +7,7 @@
  */
 
 #include <ProceduralSkinnedMesh.h>
+#include <Utils/ParallelForChunks.h>
 
 #include <AzCore/Math/MathUtils.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetHelpers.h>
@@ -32,6 +33,7 @@ namespace AtomSampleViewer
         m_subMeshCount = skinnedMeshConfig.m_subMeshCount;
 
         // For now, use a conservative AABB. A better AABB will be added with ATOM-3624
+        m_aabb = AZ::Aabb::CreateNull();
         m_aabb.AddPoint(AZ::Vector3(-m_height - m_radius, -m_height - m_radius, -m_height - m_radius));
         m_aabb.AddPoint(AZ::Vector3(m_height + m_radius, m_height + m_radius, m_height + m_radius));
 
@@ -155,21 +157,50 @@ namespace AtomSampleViewer
 
         m_uvs.resize(m_vertexCount);
 
-        for (uint32_t vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
+        // The vectors keep their capacity, so regenerating a mesh of the same or a smaller size doesn't allocate.
+        // Every vertex only depends on its segment, so ranges of vertices are generated in parallel
+        Utils::ParallelForChunks(m_vertexCount, VerticesPerJob, [this](size_t, size_t firstVertex, size_t vertexCount)
+            {
+                CalculateVertexRange(aznumeric_cast<uint32_t>(firstVertex), aznumeric_cast<uint32_t>(vertexCount));
+            });
+    }
+
+    void ProceduralSkinnedMesh::UpdateAnimations(
+        uint32_t meshCount, const AZStd::function<ProceduralSkinnedMesh&(uint32_t)>& getMesh, float time, bool useOutOfSyncBoneAnimation)
+    {
+        Utils::ParallelForChunks(meshCount, MeshesPerAnimationJob,
+            [&getMesh, time, useOutOfSyncBoneAnimation](size_t, size_t firstMesh, size_t chunkMeshCount)
+            {
+                for (size_t i = firstMesh; i < firstMesh + chunkMeshCount; ++i)
+                {
+                    getMesh(aznumeric_cast<uint32_t>(i)).UpdateAnimation(time, useOutOfSyncBoneAnimation);
+                }
+            });
+    }
+
+    void ProceduralSkinnedMesh::CalculateVertexRange(uint32_t firstVertex, uint32_t vertexCount)
+    {
+        AZ_Assert(firstVertex + vertexCount <= m_vertexCount, "Vertex range is outside of the mesh");
+
+        const float segmentAngle = AZ::Constants::TwoPi / static_cast<float>(m_verticesPerSegment - 1);
+        const uint32_t endVertex = firstVertex + vertexCount;
+        for (uint32_t vertexIndex = firstVertex; vertexIndex < endVertex; ++vertexIndex)
         {
             // Vertices circle around the origin counter-clockwise, then move up one segment and do it again.
             uint32_t indexWithinTheCurrentSegment = vertexIndex % m_verticesPerSegment;
             uint32_t segmentIndex = vertexIndex / m_verticesPerSegment;
 
             // Get the x and y positions from a unit circle
-            float vertexAngle = (AZ::Constants::TwoPi / static_cast<float>(m_verticesPerSegment - 1)) * static_cast<float>(indexWithinTheCurrentSegment);
-            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = cosf(vertexAngle) * m_radius;
-            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = sinf(vertexAngle) * m_radius;
+            float vertexAngle = segmentAngle * static_cast<float>(indexWithinTheCurrentSegment);
+            const float positionX = cosf(vertexAngle) * m_radius;
+            const float positionY = sinf(vertexAngle) * m_radius;
+            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = positionX;
+            m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = positionY;
             m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 2] = m_segmentHeightOffsets[segmentIndex];
 
             // Normals are flat on the z-plane and point away from the origin in the direction of the vertex position
-            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 0];
-            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = m_positions[(vertexIndex * RPI::PositionFloatsPerVert) + 1];
+            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 0] = positionX;
+            m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 1] = positionY;
             m_normals[(vertexIndex * RPI::PositionFloatsPerVert) + 2] = 0.0f;
 
             // Bitangent is straight down
@@ -177,6 +208,16 @@ namespace AtomSampleViewer
             m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+1] = 0.0f;
             m_bitangents[(vertexIndex * RPI::PositionFloatsPerVert)+2] = -1.0f;
 
+            // Tangent for each side points horizontally from the left vertex to the right vertex of each side.
+            // The last vertex of the segment has the first vertex of the segment as its neighbor, not just the next vertex
+            // (which would be in the next segment). The neighbor's position is computed here rather than read back, so the
+            // range doesn't depend on vertices another job writes.
+            const float rightVertexAngle = segmentAngle * static_cast<float>((indexWithinTheCurrentSegment + 1) % m_verticesPerSegment);
+            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+0] = positionX - cosf(rightVertexAngle) * m_radius;
+            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+1] = positionY - sinf(rightVertexAngle) * m_radius;
+            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+2] = 0.0f;
+            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+3] = 1.0f;
+
             for (size_t i = 0; i < m_influencesPerVertex; ++i)
             {
                 // m_blendIndices has two id's packed into a single uint32
@@ -208,20 +249,6 @@ namespace AtomSampleViewer
             // The uvs stretch from bottom to top
             m_uvs[vertexIndex][1] = m_segmentHeights[segmentIndex] / m_height;
         }
-
-        // Do a separate pass on the tangents, since the positions need to be known first
-        for (uint32_t vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
-        {
-            // Tangent for each side points horizontally from the left vertex to the right vertex of each side
-            uint32_t leftVertex = vertexIndex;
-            // The last vertex of the segment will have the first vertex of the segment as its neighbor, not just the next vertex (which would be in the next segment)
-            uint32_t rightVertex = (leftVertex + 1) % m_verticesPerSegment;
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+0] = m_positions[(leftVertex * RPI::PositionFloatsPerVert) + 0] - m_positions[(rightVertex * RPI::PositionFloatsPerVert)+0];
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+1] = m_positions[(leftVertex * RPI::PositionFloatsPerVert) + 1] - m_positions[(rightVertex * RPI::PositionFloatsPerVert)+1];
-
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+2] = 0.0f;
-            m_tangents[(vertexIndex * RPI::TangentFloatsPerVert)+3] = 1.0f;
-        }
     }
 
     void ProceduralSkinnedMesh::CalculateBones()
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/functional.h>
 
 namespace AtomSampleViewer
 {
@@ -26,6 +27,7 @@ namespace AtomSampleViewer
 
     //! Class for creating SkinnedMeshInputBuffers with arbitrary bone/vertex counts
     //! Assumes z-up right handed coordinate system
+    //! Resizing a mesh reuses the memory of its buffers, and large meshes are generated by parallel jobs.
     class ProceduralSkinnedMesh
     {
     public:
@@ -41,6 +43,21 @@ namespace AtomSampleViewer
         uint32_t GetAlignedVertCountForRGBAStream() const;
         static const uint32_t MaxInfluencesPerVertex = 4;
 
+        //! Vertices generated by each job. Even, so that two jobs never write the same packed pair of blend indices.
+        static constexpr uint32_t VerticesPerJob = 8192;
+
+        //! Meshes animated by each job of UpdateAnimations()
+        static constexpr uint32_t MeshesPerAnimationJob = 4;
+
+        //! Animates the bones of meshCount meshes, where getMesh(i) returns the i-th mesh. The bones of a mesh depend on each
+        //! other but the meshes don't, so more than MeshesPerAnimationJob meshes are animated by parallel jobs.
+        static void UpdateAnimations(
+            uint32_t meshCount, const AZStd::function<ProceduralSkinnedMesh&(uint32_t)>& getMesh, float time, bool useOutOfSyncBoneAnimation = false);
+
+        //! Generates the per-vertex data of vertices [firstVertex, firstVertex + vertexCount) into the buffers sized by
+        //! Resize(). Resize() calls it for each job, it's public so the generation can be measured on a single thread.
+        void CalculateVertexRange(uint32_t firstVertex, uint32_t vertexCount);
+
         // Mesh data that's used for rendering
         AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
         AZStd::vector<uint32_t> m_indices;
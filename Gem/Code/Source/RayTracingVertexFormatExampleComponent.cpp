@@ -246,7 +246,7 @@ namespace AtomSampleViewer
             [](const Data::AssetInfo& assetInfo)
             {
                 return assetInfo.m_assetType == azrtti_typeid<RPI::ModelAsset>();
-            });
+            }, AssetCatalogIndex::Scope::ForType(azrtti_typeid<RPI::ModelAsset>()));
 
         m_modelBrowser.SetDefaultPinnedAssets(
             {
@@ -138,6 +138,8 @@
 
 #include <Passes/RayTracingAmbientOcclusionPass.h>
 
+#include <Utils/AssetCatalogIndex.h>
+#include <Utils/MaterialInstancePool.h>
 #include <Utils/Utils.h>
 
 #include <Profiler/ProfilerImGuiBus.h>
@@ -159,6 +161,7 @@ namespace AtomSampleViewer
         constexpr const char* GpuProfilerToolName = "GPU Profiler";
         constexpr const char* FileIoProfilerToolName = "File IO Profiler";
         constexpr const char* TransientAttachmentProfilerToolName = "Transient Attachment Profiler";
+        constexpr const char* SampleSwitchTimingsToolName = "Sample Switch Timings";
         constexpr const char* SampleSetting = "/O3DE/AtomSampleViewer/Sample";
     }
 
@@ -368,10 +371,23 @@ namespace AtomSampleViewer
         return m_scriptableImGui.get();
     }
 
+    MaterialInstancePool* SampleComponentManager::GetMaterialInstancePoolInstance()
+    {
+        AZ_Assert(m_materialInstancePool, "Material Instance Pool is nullptr");
+        return m_materialInstancePool.get();
+    }
+
+    AssetCatalogIndex* SampleComponentManager::GetAssetCatalogIndexInstance()
+    {
+        AZ_Assert(m_assetCatalogIndex, "Asset Catalog Index is nullptr");
+        return m_assetCatalogIndex.get();
+    }
+
     SampleComponentManager::SampleComponentManager()
         : m_imguiFrameCaptureSaver("@user@/frame_capture.xml")
     {
         m_imGuiFrameTimer = AZStd::make_unique<ImGuiHistogramQueue>(FrameTimeDefaultLogSize, FrameTimeDefaultLogSize, 250.0f);
+        m_imGuiFrameTimer->SetStutterThreshold(FrameTimeStatistics::DefaultStutterThresholdMs);
 
         m_exampleEntity = aznew AZ::Entity();
 
@@ -397,6 +413,8 @@ namespace AtomSampleViewer
 
         m_scriptManager = AZStd::make_unique<ScriptManager>();
         m_scriptableImGui = AZStd::make_unique<ScriptableImGui>();
+        m_materialInstancePool = AZStd::make_unique<MaterialInstancePool>();
+        m_assetCatalogIndex = AZStd::make_unique<AssetCatalogIndex>();
     }
 
     void SampleComponentManager::Activate()
@@ -525,9 +543,12 @@ namespace AtomSampleViewer
                 {
                     timingSamplesCount = AZStd::clamp<int>(timingSamplesCount, FrameTimeMinLogSize, FrameTimeMaxLogSize);
                     m_imGuiFrameTimer = AZStd::make_unique<ImGuiHistogramQueue>(timingSamplesCount, timingSamplesCount, 250.0f);
+                    m_imGuiFrameTimer->SetStutterThreshold(FrameTimeStatistics::DefaultStutterThresholdMs);
                 }
         }
 
+        m_warmSampleSwitch = commandLine->HasSwitch("warmSampleSwitch");
+
         // Set default screenshot folder to relative path 'Screenshots'
         AZ::IO::Path screenshotFolder = "Screenshots";
         // Get folder from command line if it exists
@@ -551,6 +572,7 @@ namespace AtomSampleViewer
         m_imguiFrameCaptureSaver.Activate();
 
         SampleComponentManagerRequestBus::Handler::BusConnect();
+        m_assetCatalogIndex->Activate();
         m_scriptManager->Activate();
 
         m_wasActivated = true;
@@ -565,6 +587,7 @@ namespace AtomSampleViewer
         AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
         AZ::Render::ImGuiSystemNotificationBus::Handler::BusDisconnect();
         m_scriptManager->Deactivate();
+        m_assetCatalogIndex->Deactivate();
         m_imguiFrameCaptureSaver.Deactivate();
         SampleComponentSingletonRequestBus::Handler::BusDisconnect();
         SampleComponentManagerRequestBus::Handler::BusDisconnect();
@@ -585,6 +608,8 @@ namespace AtomSampleViewer
 
     void SampleComponentManager::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_sampleSwitchProfiler.OnFrameBegin();
+
         if (auto* xrSystem = AZ::RPI::RPISystemInterface::Get()->GetXRSystem())
         {
             EnableRenderPipeline(xrSystem->GetRHIXRRenderingInterface()->IsDefaultRenderPipelineEnabledOnHost());
@@ -666,6 +691,7 @@ namespace AtomSampleViewer
         m_escapeDown = false;
 
         m_scriptManager->TickScript(deltaTime);
+        m_materialInstancePool->EndFrame();
 
         if (m_isFrameCapturePending)
         {
@@ -894,6 +920,11 @@ namespace AtomSampleViewer
             ShowTransientAttachmentProfilerWindow();
         }
 
+        if (m_showSampleSwitchTimings)
+        {
+            ShowSampleSwitchTimingsWindow();
+        }
+
         m_scriptManager->TickImGui();
 
         m_contentWarningDialog.TickPopup();
@@ -1094,6 +1125,12 @@ namespace AtomSampleViewer
 
                     Utils::ReportScriptableAction("ShowTool('%s', %s)", TransientAttachmentProfilerToolName, m_showTransientAttachmentProfiler ? "true" : "false");
                 }
+
+                if (ImGui::MenuItem(SampleSwitchTimingsToolName))
+                {
+                    m_showSampleSwitchTimings = !m_showSampleSwitchTimings;
+                    Utils::ReportScriptableAction("ShowTool('%s', %s)", SampleSwitchTimingsToolName, m_showSampleSwitchTimings ? "true" : "false");
+                }
                 ImGui::EndMenu();
             }
 
@@ -1194,6 +1231,20 @@ namespace AtomSampleViewer
         }
     }
 
+    void SampleComponentManager::ShowSampleSwitchTimingsWindow()
+    {
+        if (ImGui::Begin(SampleSwitchTimingsToolName, &m_showSampleSwitchTimings, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings))
+        {
+            ImGui::Checkbox("Warm Sample Switch", &m_warmSampleSwitch);
+            m_sampleSwitchProfiler.DrawImGui();
+            if (ImGui::Button("Reset"))
+            {
+                m_sampleSwitchProfiler.Reset();
+            }
+        }
+        ImGui::End();
+    }
+
     void SampleComponentManager::ShowResizeViewportDialog()
     {
         static int size[2] = { 0, 0 };
@@ -1241,8 +1292,14 @@ namespace AtomSampleViewer
         {
             ImGuiHistogramQueue::WidgetSettings settings;
             settings.m_reportInverse = false;
+            settings.m_showStatistics = true;
             settings.m_units = "ms";
             m_imGuiFrameTimer->Tick(deltaTime * 1000.0f, settings);
+
+            if (ImGui::Button("Reset Statistics"))
+            {
+                m_imGuiFrameTimer->ResetStatistics();
+            }
         }
         ImGui::End();
     }
@@ -1296,11 +1353,12 @@ namespace AtomSampleViewer
         return m_isFrameCapturePending;
     }
 
-    void SampleComponentManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed)
+    void SampleComponentManager::RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, bool incrementalRun, int shardIndex, int shardCount,
+        const AZStd::string& shardRunId)
     {
         if (m_scriptManager)
         {
-            m_scriptManager->RunMainTestSuite(suiteFilePath, exitOnTestEnd, randomSeed);
+            m_scriptManager->RunMainTestSuite(suiteFilePath, exitOnTestEnd, randomSeed, incrementalRun, shardIndex, shardCount, shardRunId);
         }
     }
 
@@ -1357,6 +1415,16 @@ namespace AtomSampleViewer
         }
     }
 
+    bool SampleComponentManager::WriteSampleSwitchTimings(const AZStd::string& filePath)
+    {
+        return m_sampleSwitchProfiler.WriteRecords(filePath);
+    }
+
+    void SampleComponentManager::SetWarmSampleSwitchEnabled(bool enabled)
+    {
+        m_warmSampleSwitch = enabled;
+    }
+
     void SampleComponentManager::EnableXrPipelines(bool value)
     {
         for (RPI::RenderPipelinePtr xrPipeline : m_xrPipelines)
@@ -1551,6 +1619,11 @@ namespace AtomSampleViewer
             m_showTransientAttachmentProfiler = enable;
             return true;
         }
+        else if (toolName == SampleSwitchTimingsToolName)
+        {
+            m_showSampleSwitchTimings = enable;
+            return true;
+        }
         return false;
     }
 
@@ -1561,23 +1634,44 @@ namespace AtomSampleViewer
             return;
         }
 
+        const SampleEntry& sampleEntry = m_availableSamples[m_selectedSampleIndex];
+        m_sampleSwitchProfiler.BeginSwitch(sampleEntry.m_fullName);
+
         ShutdownActiveSample();
 
         // Reset the camera *before* activating the sample, because the sample's Activate() function might
         // want to reposition the camera.
         CameraReset();
 
-        const SampleEntry& sampleEntry = m_availableSamples[m_selectedSampleIndex];
-
-        // Create scene and render pipeline before create sample component
+        // Create scene and render pipeline before create sample component.
+        // The Switch*Sample() functions are inlined here so the teardown and creation can be timed separately.
+        m_sampleSwitchProfiler.BeginPhase(SampleSwitchProfiler::Phase::SceneTeardown);
         if (sampleEntry.m_pipelineType == SamplePipelineType::RHI)
         {
-            SwitchSceneForRHISample();
+            ReleaseRPIScene();
+            ReleaseRHIScene();
+            m_sampleSwitchProfiler.BeginPhase(SampleSwitchProfiler::Phase::PipelineCreation);
+            CreateSceneForRHISample();
         }
         else if (sampleEntry.m_pipelineType == SamplePipelineType::RPI)
         {
-            SwitchSceneForRPISample();
+            const bool reuseScene = m_warmSampleSwitch && CanReuseRPIScene();
+            m_sampleSwitchProfiler.SetWarmStart(reuseScene);
+            ReleaseRHIScene();
+            if (reuseScene)
+            {
+                m_sampleSwitchProfiler.BeginPhase(SampleSwitchProfiler::Phase::PipelineCreation);
+                // The previous sample may have pointed the pipeline at a view of its own
+                m_renderPipeline->SetDefaultViewFromEntity(m_cameraEntity->GetId());
+            }
+            else
+            {
+                ReleaseRPIScene();
+                m_sampleSwitchProfiler.BeginPhase(SampleSwitchProfiler::Phase::PipelineCreation);
+                CreateSceneForRPISample();
+            }
         }
+        m_sampleSwitchProfiler.BeginPhase(SampleSwitchProfiler::Phase::AssetPreload);
 
         SampleComponentConfig config(m_windowContext, m_cameraEntity->GetId(), m_entityContextId); 
         // special setup for RHI samples
@@ -1610,6 +1704,9 @@ namespace AtomSampleViewer
 
         // Even though this is done in CameraReset(), the example component wasn't activated at the time so we have to send this event again.
         ExampleComponentRequestBus::Event(m_exampleEntity->GetId(), &ExampleComponentRequestBus::Events::ResetCamera);
+
+        // The switch is complete once the manager ticks again, after the first frame of the new sample
+        m_sampleSwitchProfiler.EndSwitchSetup();
     }
 
     void SampleComponentManager::CameraReset()
@@ -1737,6 +1834,7 @@ namespace AtomSampleViewer
         sceneDesc.m_nameId = AZ::Name("RPI");
         m_rpiScene = RPI::Scene::CreateScene(sceneDesc);
         m_rpiScene->EnableAllFeatureProcessors();
+        m_rpiSceneNumMsaaSamples = m_numMsaaSamples;
 
         // Bind m_rpiScene to the GameEntityContext's AzFramework::Scene so the RPI Scene can be found by the entity context
         auto sceneSystem = AzFramework::SceneSystemInterface::Get();
@@ -1865,6 +1963,31 @@ namespace AtomSampleViewer
         CreateSceneForRPISample();
     }
 
+    bool SampleComponentManager::CanReuseRPIScene() const
+    {
+        if (!m_rpiScene || !m_renderPipeline || m_rpiSceneNumMsaaSamples != m_numMsaaSamples)
+        {
+            return false;
+        }
+
+        // Samples that add pipelines of their own or replace the default pipeline need a fresh scene
+        if (m_rpiScene->GetDefaultRenderPipeline() != m_renderPipeline)
+        {
+            return false;
+        }
+        for (const RPI::RenderPipelinePtr& renderPipeline : m_rpiScene->GetRenderPipelines())
+        {
+            const bool isOwnPipeline = renderPipeline == m_renderPipeline
+                || renderPipeline->GetId() == AZ::Name("BRDFTexturePipeline")
+                || AZStd::find(m_xrPipelines.begin(), m_xrPipelines.end(), renderPipeline) != m_xrPipelines.end();
+            if (!isOwnPipeline)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // AzFramework::AssetCatalogEventBus::Handler overrides ...
     void SampleComponentManager::OnCatalogLoaded([[maybe_unused]] const char* catalogFile)
     {
@@ -39,6 +39,8 @@
 #include <AzFramework/Entity/EntityContextBus.h>
 #include <RHI/BasicRHIComponent.h>
 
+#include <Performance/SampleSwitchProfiler.h>
+
 #include <Utils/ImGuiSaveFilePath.h>
 #include <Utils/ImGuiHistogramQueue.h>
 #include <Utils/ImGuiMessageBox.h>
@@ -101,6 +103,7 @@ namespace AtomSampleViewer
         void CreateSceneForRPISample();
         void ReleaseRPIScene();
         void SwitchSceneForRPISample();
+        bool CanReuseRPIScene() const;
 
         void RenderImGui(float deltaTime);
 
@@ -116,6 +119,7 @@ namespace AtomSampleViewer
         void ShowGpuProfilerWindow();
         void ShowFileIoProfilerWindow();
         void ShowTransientAttachmentProfilerWindow();
+        void ShowSampleSwitchTimingsWindow();
 
         void RequestExit();
         void SampleChange();
@@ -129,7 +133,8 @@ namespace AtomSampleViewer
         bool ShowTool(const AZStd::string& toolName, bool enable) override;
         void RequestFrameCapture(const AZStd::string& filePath, bool hideImGui) override;
         bool IsFrameCapturePending() override;
-        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) override;
+        void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, bool incrementalRun, int shardIndex, int shardCount,
+            const AZStd::string& shardRunId) override;
         void SetNumMSAASamples(int16_t numMsaaSamples) override;
         int16_t GetNumMSAASamples() override;
         void SetDefaultNumMSAASamples(int16_t defaultNumMsaaSamples) override;
@@ -139,12 +144,16 @@ namespace AtomSampleViewer
         void RegisterSampleComponent(const SampleEntry& sample) override;
         ScriptManager* GetScriptManagerInstance() override;
         ScriptableImGui* GetScriptableImGuiInstance() override;
+        MaterialInstancePool* GetMaterialInstancePoolInstance() override;
+        AssetCatalogIndex* GetAssetCatalogIndexInstance() override;
 
         void ResetNumMSAASamples() override;
         void ResetRPIScene() override;
         void ClearRPIScene() override;
         void EnableRenderPipeline(bool value) override;
         void EnableXrPipelines(bool value) override;
+        bool WriteSampleSwitchTimings(const AZStd::string& filePath) override;
+        void SetWarmSampleSwitchEnabled(bool enabled) override;
 
         // FrameCaptureNotificationBus overrides...
         void OnFrameCaptureFinished(AZ::Render::FrameCaptureResult result, const AZStd::string& info) override;
@@ -205,6 +214,7 @@ namespace AtomSampleViewer
         bool m_showGpuProfiler = false;
         bool m_showFileIoProfiler = false;
         bool m_showTransientAttachmentProfiler = false;
+        bool m_showSampleSwitchTimings = false;
 
         bool m_ctrlModifierLDown = false;
         bool m_ctrlModifierRDown = false;
@@ -238,6 +248,12 @@ namespace AtomSampleViewer
 
         AZStd::unique_ptr<ScriptManager> m_scriptManager;
         AZStd::unique_ptr<ScriptableImGui> m_scriptableImGui;
+        AZStd::unique_ptr<MaterialInstancePool> m_materialInstancePool;
+        AZStd::unique_ptr<AssetCatalogIndex> m_assetCatalogIndex;
+
+        SampleSwitchProfiler m_sampleSwitchProfiler;
+        // Keep the RPI scene and its pipelines between RPI samples when they're compatible, instead of recreating them
+        bool m_warmSampleSwitch = false;
 
         AZStd::shared_ptr<AZ::RPI::WindowContext> m_windowContext;
 
@@ -254,6 +270,8 @@ namespace AtomSampleViewer
         // number of MSAA samples
         int16_t m_numMsaaSamples = 1; 
         int16_t m_defaultNumMsaaSamples = 1;
+        // number of MSAA samples m_rpiScene's pipelines were created with
+        int16_t m_rpiSceneNumMsaaSamples = 0;
 
         // Cache PC and XR pipelines
         AZ::RPI::RenderPipelinePtr m_renderPipeline = nullptr;
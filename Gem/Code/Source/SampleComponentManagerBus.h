@@ -92,7 +92,12 @@ namespace AtomSampleViewer
         //! @param suiteFilePath path to the compiled luac test script
         //! @param exitOnTestEnd if true, exits AtomSampleViewerStandalone when the script finishes, used in jenkins
         //! @param randomSeed the seed for the random generator, frequently used inside lua tests to shuffle the order of the test execution
-        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed) = 0;
+        //! @param incrementalRun if true, skips the tests that passed in an earlier run if none of their assets or baseline images changed since then
+        //! @param shardIndex which part of the test suite this process runs, from 0 to shardCount - 1
+        //! @param shardCount number of processes the test suite is split across. Each shard exports its results, and they're merged into one summary.
+        //! @param shardRunId identifies the run that all shards belong to, so results of earlier runs aren't merged
+        virtual void RunMainTestSuite(const AZStd::string& suiteFilePath, bool exitOnTestEnd, int randomSeed, bool incrementalRun, int shardIndex, int shardCount,
+            const AZStd::string& shardRunId) = 0;
 
         //! Set the number of MSAA samples
         //! @param numMSAASamples the number of MSAA samples
@@ -121,11 +126,19 @@ namespace AtomSampleViewer
 
         //! Enables or disables the XR pipelines.
         virtual void EnableXrPipelines(bool value) = 0;
+
+        //! Writes the phase timings of every sample switch since startup to a JSON file. Returns false if the file couldn't be written.
+        virtual bool WriteSampleSwitchTimings(const AZStd::string& filePath) = 0;
+
+        //! When enabled, switching between RPI samples keeps the RPI scene and its pipelines if they're compatible with the next sample.
+        virtual void SetWarmSampleSwitchEnabled(bool enabled) = 0;
     };
     using SampleComponentManagerRequestBus = AZ::EBus<SampleComponentManagerRequests>;
 
     class ScriptManager;
     class ScriptableImGui;
+    class MaterialInstancePool;
+    class AssetCatalogIndex;
 
     class SampleComponentSingletonRequests
         : public AZ::EBusTraits
@@ -134,6 +147,8 @@ namespace AtomSampleViewer
 
         virtual ScriptManager* GetScriptManagerInstance() = 0;
         virtual ScriptableImGui* GetScriptableImGuiInstance() = 0;
+        virtual MaterialInstancePool* GetMaterialInstancePoolInstance() = 0;
+        virtual AssetCatalogIndex* GetAssetCatalogIndexInstance() = 0;
         virtual void RegisterSampleComponent(const SampleEntry& sample) = 0;
     };
     using SampleComponentSingletonRequestBus = AZ::EBus<SampleComponentSingletonRequests>;
@@ -18,6 +18,7 @@
 #include <AzCore/Component/Entity.h>
 
 #include <RHI/BasicRHIComponent.h>
+#include <Utils/MaterialInstancePool.h>
 
 #include <SceneReloadSoakTestComponent_Traits_Platform.h>
 
@@ -72,7 +73,7 @@ namespace AtomSampleViewer
 
     void SceneReloadSoakTestComponent::PrepareCreateLatticeInstances(uint32_t instanceCount)
     {
-        m_materialIsUnique.reserve(instanceCount);
+        m_materials.reserve(instanceCount);
         m_meshHandles.reserve(instanceCount);
 
         const char* materialPath = DefaultPbrMaterialPath;
@@ -90,15 +91,24 @@ namespace AtomSampleViewer
         AZ_Assert(m_modelAssetId.IsValid(), "Failed to get model asset id: %s", modelPath);
     }
 
+    void SceneReloadSoakTestComponent::CreateLatticeInstances(AZStd::span<const Transform> transforms)
+    {
+        for (const Transform& transform : transforms)
+        {
+            CreateLatticeInstance(transform);
+        }
+    }
+
     void SceneReloadSoakTestComponent::CreateLatticeInstance(const Transform& transform)
     {
         Data::Asset<MaterialAsset> materialAsset;
         materialAsset.Create(m_materialAssetId);
 
         // We have a mixture of both unique and shared instance to give more variety and therefore more opportunity for things to break.
-        bool materialIsUnique = (m_materialIsUnique.size() % 2) == 0;
-        auto materialInstance = materialIsUnique ? Material::Create(materialAsset) : Material::FindOrCreate(materialAsset);
-        m_materialIsUnique.push_back(materialIsUnique);
+        MaterialInstancePool* materialInstancePool = MaterialInstancePool::GetInstance();
+        const bool materialIsUnique = (m_materials.size() % 2) == 0;
+        auto materialInstance = materialIsUnique ? materialInstancePool->AcquireUnique(materialAsset) : materialInstancePool->Acquire(materialAsset);
+        m_materials.push_back(materialInstance);
 
         Data::Asset<ModelAsset> modelAsset;
         modelAsset.Create(m_modelAssetId);
@@ -110,12 +120,17 @@ namespace AtomSampleViewer
 
     void SceneReloadSoakTestComponent::DestroyLatticeInstances()
     {
-        m_materialIsUnique.clear();
         for (auto& meshHandle : m_meshHandles)
         {
             GetMeshFeatureProcessor()->ReleaseMesh(meshHandle);
         }
         m_meshHandles.clear();
+
+        for (auto& material : m_materials)
+        {
+            MaterialInstancePool::GetInstance()->Release(material);
+        }
+        m_materials.clear();
     }
 
     void SceneReloadSoakTestComponent::OnTick(float deltaTime, [[maybe_unused]] ScriptTimePoint scriptTime)
@@ -125,6 +140,7 @@ namespace AtomSampleViewer
             // Create a new SimpleLcgRandom every time TickMaterialUpdate is called to keep a consistent seed and consistent color selection.
             SimpleLcgRandom random;
             
+            MaterialInstancePool* materialInstancePool = MaterialInstancePool::GetInstance();
             bool updatedSharedMaterialInstance = false;
             size_t entityIndex = 0;
 
@@ -151,7 +167,9 @@ namespace AtomSampleViewer
                 }
                 const Color color = colorOptions[colorIndexA] * t + colorOptions[colorIndexB] * (1.0f - t);
 
-                if (m_materialIsUnique[entityIndex] || !updatedSharedMaterialInstance)
+                // The shared instance is the same for every entity that uses it, so it only needs to be updated once
+                const bool materialIsShared = materialInstancePool->IsShared(m_materials[entityIndex]);
+                if (!materialIsShared || !updatedSharedMaterialInstance)
                 {
                     for (auto& customMaterialPair : GetMeshFeatureProcessor()->GetCustomMaterials(meshHandle))
                     {
@@ -161,9 +179,9 @@ namespace AtomSampleViewer
                             if (colorPropertyIndex.IsValid())
                             {
                                 material->SetPropertyValue(colorPropertyIndex, color);
-                                material->Compile();
+                                materialInstancePool->Compile(material);
 
-                                if (!m_materialIsUnique[entityIndex])
+                                if (materialIsShared)
                                 {
                                     updatedSharedMaterialInstance = true;
                                 }
@@ -202,6 +220,11 @@ namespace AtomSampleViewer
             m_totalResetCount++;
             AZ_TracePrintf("", "SceneReloadSoakTest RESET # %d @ time %f. Next reset in %f s\n", m_totalResetCount, m_totalTime, m_countdown);
             RebuildLattice();
+
+            // The live instance counts should stay flat across resets, growth here means instances are leaking
+            const MaterialInstancePool::Stats materialStats = MaterialInstancePool::GetInstance()->GetStats();
+            AZ_TracePrintf("", "SceneReloadSoakTest materials: %u shared (%u references), %u unique\n",
+                materialStats.m_sharedInstanceCount, materialStats.m_sharedReferenceCount, materialStats.m_uniqueInstanceCount);
         }
     }
 
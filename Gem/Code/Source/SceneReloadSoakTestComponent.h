@@ -53,9 +53,11 @@ namespace AtomSampleViewer
 
         // EntityLatticeTestComponent overrides...
         void PrepareCreateLatticeInstances(uint32_t instanceCount) override;
-        void CreateLatticeInstance(const AZ::Transform& transform) override;
+        void CreateLatticeInstances(AZStd::span<const AZ::Transform> transforms) override;
         void DestroyLatticeInstances() override;
 
+        void CreateLatticeInstance(const AZ::Transform& transform);
+
         // AZ::TickBus::Handler overrides...
         void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTime) override;
 
@@ -74,7 +76,7 @@ namespace AtomSampleViewer
 
         AZ::Data::AssetId m_materialAssetId;
         AZ::Data::AssetId m_modelAssetId;
-        AZStd::vector<bool> m_materialIsUnique; //!< Tracks whether each entity in the lattice uses its own unique material instance
+        AZStd::vector<AZ::Data::Instance<AZ::RPI::Material>> m_materials;   //!< Acquired from the MaterialInstancePool, shared or unique
         AZStd::vector<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandles;
     };
 } // namespace AtomSampleViewer
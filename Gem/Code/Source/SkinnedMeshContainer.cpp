@@ -24,10 +24,23 @@
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
 #include <Atom/Utils/Utils.h>
 
+#include <Utils/MaterialInstancePool.h>
+
+#include <imgui/imgui.h>
+
 
 namespace
 {
     static const char* const SkinnedMeshMaterial = "materials/defaultpbr.azmaterial";
+
+    // Instances fill rows along the x axis, and the rows are stacked along the y axis behind the first one
+    static const uint32_t InstancesPerRow = 32;
+    // The meshes bend towards the ground on either side of their root, up to their height
+    static const float InstanceSpacingX = 2.5f;
+    static const float InstanceRowGap = 0.25f;
+
+    // Drawing the bones of thousands of instances would overflow the aux geom buffers
+    static const uint32_t MaxBoneDrawInstances = 64;
 }
 
 namespace AtomSampleViewer
@@ -37,24 +50,43 @@ namespace AtomSampleViewer
         , m_meshFeatureProcessor(meshFeatureProcessor)
         , m_skinnedMeshConfig(config)
     {
+        // All instances use the same material, so it's loaded once rather than for every instance
+        auto materialAsset = AZ::RPI::AssetUtils::LoadAssetByProductPath<AZ::RPI::MaterialAsset>(SkinnedMeshMaterial);
+        m_material = MaterialInstancePool::GetInstance()->Acquire(materialAsset);
+
         SetupSkinnedMeshes();
     }
 
     void SkinnedMeshContainer::SetupSkinnedMeshes()
     {
-        m_skinnedMeshes.clear();
-        m_skinnedMeshInstances.clear();
-        SetupNewSkinnedMesh(m_skinnedMeshConfig);
+        if (m_skinnedMeshes.empty())
+        {
+            m_skinnedMeshes.resize(1);
+        }
+
+        // Regenerate the existing meshes in place, so their vertex buffers are reused instead of reallocated
+        for (uint32_t uniqueMeshIndex = 0; uniqueMeshIndex < m_skinnedMeshes.size(); ++uniqueMeshIndex)
+        {
+            SkinnedMeshConfig uniqueMeshConfig = GetUniqueMeshConfig(uniqueMeshIndex);
+            m_skinnedMeshes[uniqueMeshIndex].m_proceduralSkinnedMesh.Resize(uniqueMeshConfig);
+        }
     }
 
     SkinnedMeshContainer::~SkinnedMeshContainer()
     {
         SetActiveSkinnedMeshCount(0);
+        AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler::BusDisconnect();
+        MaterialInstancePool::GetInstance()->Release(m_material);
     }
 
     void SkinnedMeshContainer::SetActiveSkinnedMeshCount(uint32_t activeSkinnedMeshCount)
     {
-        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
+        if (activeSkinnedMeshCount > m_skinnedMeshInstances.size())
+        {
+            m_skinnedMeshInstances.resize(activeSkinnedMeshCount);
+        }
+
+        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size());
         for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
         {
             if (i < activeSkinnedMeshCount)
@@ -84,21 +116,70 @@ namespace AtomSampleViewer
         return m_skinnedMeshConfig;
     }
 
-    void SkinnedMeshContainer::UpdateAnimation(float time, bool useOutOfSyncBoneAnimation)
+    void SkinnedMeshContainer::SetUniqueMeshCount(uint32_t uniqueMeshCount)
     {
-        uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
-        for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
+        uniqueMeshCount = AZ::GetMax(1u, uniqueMeshCount);
+        const uint32_t previousUniqueMeshCount = GetUniqueMeshCount();
+        if (uniqueMeshCount == previousUniqueMeshCount)
         {
-            if (i < m_activeSkinnedMeshCount)
+            return;
+        }
+
+        // Instances are re-created since the mesh each of them uses changes
+        const uint32_t skinnedMeshCount = m_activeSkinnedMeshCount;
+        SetActiveSkinnedMeshCount(0);
+
+        m_skinnedMeshes.resize(uniqueMeshCount);
+        for (uint32_t uniqueMeshIndex = previousUniqueMeshCount; uniqueMeshIndex < uniqueMeshCount; ++uniqueMeshIndex)
+        {
+            SkinnedMeshConfig uniqueMeshConfig = GetUniqueMeshConfig(uniqueMeshIndex);
+            m_skinnedMeshes[uniqueMeshIndex].m_proceduralSkinnedMesh.Resize(uniqueMeshConfig);
+        }
+
+        SetActiveSkinnedMeshCount(skinnedMeshCount);
+    }
+
+    SkinnedMeshConfig SkinnedMeshContainer::GetUniqueMeshConfig(uint32_t uniqueMeshIndex) const
+    {
+        SkinnedMeshConfig uniqueMeshConfig = m_skinnedMeshConfig;
+        uniqueMeshConfig.m_segmentCount += aznumeric_cast<int>(uniqueMeshIndex);
+        return uniqueMeshConfig;
+    }
+
+    AZ::Transform SkinnedMeshContainer::GetInstanceTransform(uint32_t i) const
+    {
+        const ProceduralSkinnedMesh& proceduralSkinnedMesh = m_skinnedMeshes.front().m_proceduralSkinnedMesh;
+        const float instanceSpacingY = proceduralSkinnedMesh.GetSubMeshCount() * proceduralSkinnedMesh.GetSubMeshYOffset() + InstanceRowGap;
+        return AZ::Transform::CreateTranslation(AZ::Vector3(
+            static_cast<float>(i % InstancesPerRow) * InstanceSpacingX, static_cast<float>(i / InstancesPerRow) * instanceSpacingY, 0.0f));
+    }
+
+    size_t SkinnedMeshContainer::GetOutputStreamBytes(const SkinnedMesh& skinnedMesh) const
+    {
+        // The input buffers hold a copy of the vertices for each sub-mesh, and every copy is skinned
+        const ProceduralSkinnedMesh& proceduralSkinnedMesh = skinnedMesh.m_proceduralSkinnedMesh;
+        return static_cast<size_t>(proceduralSkinnedMesh.GetVertexCount()) * proceduralSkinnedMesh.GetSubMeshCount() * SkinningOutputBytesPerVertex;
+    }
+
+    void SkinnedMeshContainer::UpdateAnimation(float time, bool useOutOfSyncBoneAnimation)
+    {
+        // Instances share the bones of their mesh, so only the meshes used by the active instances are animated
+        const uint32_t animatedMeshCount = AZ::GetMin(m_activeSkinnedMeshCount, GetUniqueMeshCount());
+
+        ProceduralSkinnedMesh::UpdateAnimations(animatedMeshCount, [this](uint32_t i) -> ProceduralSkinnedMesh&
             {
-                m_skinnedMeshes[i].m_proceduralSkinnedMesh.UpdateAnimation(time, useOutOfSyncBoneAnimation);
+                return m_skinnedMeshes[i].m_proceduralSkinnedMesh;
+            }, time, useOutOfSyncBoneAnimation);
 
-                if (m_skinnedMeshInstances[i].m_boneTransformBuffer)
-                {
-                    m_skinnedMeshInstances[i].m_boneTransformBuffer->UpdateData(
-                        m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices.data(),
-                        m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices.size() * sizeof(AZ::Matrix3x4));
-                }
+        // The bone transform buffers are updated on the calling thread
+        for (uint32_t i = 0; i < m_activeSkinnedMeshCount; ++i)
+        {
+            const RenderData& renderData = m_skinnedMeshInstances[i];
+            if (renderData.m_boneTransformBuffer)
+            {
+                const ProceduralSkinnedMesh& proceduralSkinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex].m_proceduralSkinnedMesh;
+                renderData.m_boneTransformBuffer->UpdateData(
+                    proceduralSkinnedMesh.m_boneMatrices.data(), proceduralSkinnedMesh.m_boneMatrices.size() * sizeof(AZ::Matrix3x4));
             }
         }
     }
@@ -108,89 +189,87 @@ namespace AtomSampleViewer
         auto rpiScene = AZ::RPI::RPISystemInterface::Get()->GetSceneByName(AZ::Name("RPI"));
         if (auto auxGeom = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(rpiScene))
         {
-            uint32_t skinnedMeshContainerSize = aznumeric_cast<uint32_t>(m_skinnedMeshes.size());
-            for (uint32_t i = 0; i < skinnedMeshContainerSize; ++i)
+            const uint32_t drawnInstanceCount = AZ::GetMin(m_activeSkinnedMeshCount, MaxBoneDrawInstances);
+            for (uint32_t i = 0; i < drawnInstanceCount; ++i)
             {
-                if (i < m_activeSkinnedMeshCount)
+                const RenderData& renderData = m_skinnedMeshInstances[i];
+                for (const AZ::Matrix3x4& boneMatrix : m_skinnedMeshes[renderData.m_skinnedMeshIndex].m_proceduralSkinnedMesh.m_boneMatrices)
                 {
-                    for (const AZ::Matrix3x4& boneMatrix : m_skinnedMeshes[i].m_proceduralSkinnedMesh.m_boneMatrices)
-                    {
-                        AZ::Transform boneTransform = AZ::Transform::CreateFromMatrix3x4(boneMatrix);
-                        AZ::Vector3 center = boneTransform.GetTranslation();
-                        AZ::Vector3 direction = boneTransform.GetRotation().TransformVector(AZ::Vector3(0.0f, 0.0f, 1.0f));
-                        float radius = 0.02f;
-                        float height = 0.05f;
-                        auxGeom->DrawCone(center, direction, radius, height, AZ::Color::CreateFromRgba(0, 0, 255, 255), AZ::RPI::AuxGeomDraw::DrawStyle::Line, AZ::RPI::AuxGeomDraw::DepthTest::Off, AZ::RPI::AuxGeomDraw::DepthWrite::Off);
-                    }
+                    AZ::Transform boneTransform = renderData.m_rootTransform * AZ::Transform::CreateFromMatrix3x4(boneMatrix);
+                    AZ::Vector3 center = boneTransform.GetTranslation();
+                    AZ::Vector3 direction = boneTransform.GetRotation().TransformVector(AZ::Vector3(0.0f, 0.0f, 1.0f));
+                    float radius = 0.02f;
+                    float height = 0.05f;
+                    auxGeom->DrawCone(center, direction, radius, height, AZ::Color::CreateFromRgba(0, 0, 255, 255), AZ::RPI::AuxGeomDraw::DrawStyle::Line, AZ::RPI::AuxGeomDraw::DepthTest::Off, AZ::RPI::AuxGeomDraw::DepthWrite::Off);
                 }
             }
         }
     }
 
-    void SkinnedMeshContainer::SetupNewSkinnedMesh(SkinnedMeshConfig& skinnedMeshConfig)
-    {
-        SkinnedMesh newSkinnedMesh;
-        newSkinnedMesh.m_proceduralSkinnedMesh.Resize(skinnedMeshConfig);
-        m_skinnedMeshes.push_back(AZStd::move(newSkinnedMesh));
-
-        SkinnedMeshContainer::RenderData newRenderData;
-        m_skinnedMeshInstances.push_back(AZStd::move(newRenderData));
-    }
-
     void SkinnedMeshContainer::AcquireSkinnedMesh(uint32_t i)
     {
-        // For now, there is a 1-1 match of input meshes to instances
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
         RenderData& renderData = m_skinnedMeshInstances[i];
-        if (renderData.m_skinnedMeshHandle.IsValid())
+        if (renderData.m_isActive)
         {
             return;
         }
 
+        renderData.m_isActive = true;
+        renderData.m_skinnedMeshIndex = i % GetUniqueMeshCount();
+        renderData.m_rootTransform = GetInstanceTransform(i);
+
+        // The input buffers are created by the first instance of the mesh and shared with the others
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
         skinnedMesh.m_useCount++;
         if (!skinnedMesh.m_skinnedMeshInputBuffers)
         {
             skinnedMesh.m_skinnedMeshInputBuffers = CreateSkinnedMeshInputBuffersFromProceduralSkinnedMesh(skinnedMesh.m_proceduralSkinnedMesh);
         }
 
-        CreateInstance(i);
+        if (!CreateInstance(i))
+        {
+            m_instancesOutOfMemory.push(i);
+            AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler::BusConnect();
+        }
     }
 
-    void SkinnedMeshContainer::CreateInstance(uint32_t i)
+    bool SkinnedMeshContainer::CreateInstance(uint32_t i)
     {
-        // For now, there is a 1-1 match of input meshes to instances
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
         RenderData& renderData = m_skinnedMeshInstances[i];
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
         renderData.m_skinnedMeshInstance = skinnedMesh.m_skinnedMeshInputBuffers->CreateSkinnedMeshInstance();
-        if (renderData.m_skinnedMeshInstance)
+        if (!renderData.m_skinnedMeshInstance)
         {
-            // Create a buffer and populate it with the transforms
-            renderData.m_boneTransformBuffer = CreateBoneTransformBufferFromProceduralSkinnedMesh(skinnedMesh.m_proceduralSkinnedMesh);
-
-            auto materialAsset = AZ::RPI::AssetUtils::LoadAssetByProductPath<AZ::RPI::MaterialAsset>(SkinnedMeshMaterial);
-            auto materialOverrideInstance = AZ::RPI::Material::FindOrCreate(materialAsset);
-
-            if (renderData.m_skinnedMeshInstance->m_model)
+            if (m_totalOutOfMemoryFailures == 0)
             {
-                AZ::Render::MeshHandleDescriptor meshDescriptor(
-                    renderData.m_skinnedMeshInstance->m_model->GetModelAsset(), materialOverrideInstance);
-                meshDescriptor.m_isRayTracingEnabled = false;
-                meshDescriptor.m_isAlwaysDynamic = true;
-                renderData.m_meshHandle = AZStd::make_shared<AZ::Render::MeshFeatureProcessorInterface::MeshHandle>(
-                    m_meshFeatureProcessor->AcquireMesh(meshDescriptor));
-                m_meshFeatureProcessor->SetTransform(*renderData.m_meshHandle, renderData.m_rootTransform);
+                m_outputStreamBytesAtFirstFailure = m_outputStreamBytes;
             }
-            // If render proxies already exist, they will be auto-freed
-            AZ::Render::SkinnedMeshShaderOptions defaultShaderOptions;
-            AZ::Render::SkinnedMeshFeatureProcessorInterface::SkinnedMeshHandleDescriptor desc{ skinnedMesh.m_skinnedMeshInputBuffers, renderData.m_skinnedMeshInstance, renderData.m_meshHandle, renderData.m_boneTransformBuffer, defaultShaderOptions };
-
-            renderData.m_skinnedMeshHandle = m_skinnedMeshFeatureProcessor->AcquireSkinnedMesh(desc);
+            ++m_outOfMemoryFailuresThisFrame;
+            ++m_totalOutOfMemoryFailures;
+            return false;
         }
-        else
+
+        m_outputStreamBytes += GetOutputStreamBytes(skinnedMesh);
+
+        // Create a buffer and populate it with the transforms
+        renderData.m_boneTransformBuffer = CreateBoneTransformBufferFromProceduralSkinnedMesh(skinnedMesh.m_proceduralSkinnedMesh);
+
+        if (renderData.m_skinnedMeshInstance->m_model)
         {
-            m_instancesOutOfMemory.push(i);
-            AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler::BusConnect();
+            AZ::Render::MeshHandleDescriptor meshDescriptor(
+                renderData.m_skinnedMeshInstance->m_model->GetModelAsset(), m_material);
+            meshDescriptor.m_isRayTracingEnabled = false;
+            meshDescriptor.m_isAlwaysDynamic = true;
+            renderData.m_meshHandle = AZStd::make_shared<AZ::Render::MeshFeatureProcessorInterface::MeshHandle>(
+                m_meshFeatureProcessor->AcquireMesh(meshDescriptor));
+            m_meshFeatureProcessor->SetTransform(*renderData.m_meshHandle, renderData.m_rootTransform);
         }
+        // If render proxies already exist, they will be auto-freed
+        AZ::Render::SkinnedMeshShaderOptions defaultShaderOptions;
+        AZ::Render::SkinnedMeshFeatureProcessorInterface::SkinnedMeshHandleDescriptor desc{ skinnedMesh.m_skinnedMeshInputBuffers, renderData.m_skinnedMeshInstance, renderData.m_meshHandle, renderData.m_boneTransformBuffer, defaultShaderOptions };
+
+        renderData.m_skinnedMeshHandle = m_skinnedMeshFeatureProcessor->AcquireSkinnedMesh(desc);
+        return true;
     }
 
     void SkinnedMeshContainer::OnSkinnedMeshOutputStreamMemoryAvailable()
@@ -198,35 +277,125 @@ namespace AtomSampleViewer
         AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler::BusDisconnect();
 
         // Iterate over the instances that previously failed and try to create them again now that memory has been freed
-        // If they fail again, CreateInstance will just add them to the back of the queue
+        // If they fail again, they're added to the back of the queue
         size_t instanceCount = m_instancesOutOfMemory.size();
         for (size_t i = 0; i < instanceCount; ++i)
         {
             uint32_t instanceIndex = m_instancesOutOfMemory.front();
             m_instancesOutOfMemory.pop();
-            CreateInstance(instanceIndex);
+
+            // Skip instances that were released, or released and created again, since they were queued
+            const RenderData& renderData = m_skinnedMeshInstances[instanceIndex];
+            if (!renderData.m_isActive || renderData.m_skinnedMeshInstance)
+            {
+                continue;
+            }
+
+            ++m_outOfMemoryRetriesThisFrame;
+            ++m_totalOutOfMemoryRetries;
+            if (!CreateInstance(instanceIndex))
+            {
+                m_instancesOutOfMemory.push(instanceIndex);
+            }
+        }
+
+        if (!m_instancesOutOfMemory.empty())
+        {
+            AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler::BusConnect();
         }
     }
 
     void SkinnedMeshContainer::ReleaseSkinnedMesh(uint32_t i)
     {
+        RenderData& renderData = m_skinnedMeshInstances[i];
+        if (!renderData.m_isActive)
+        {
+            return;
+        }
+        renderData.m_isActive = false;
+
         // Decrement the use count, and release the input buffers if there are no longer any instances using this skinned mesh
-        SkinnedMesh& skinnedMesh = m_skinnedMeshes[i];
+        SkinnedMesh& skinnedMesh = m_skinnedMeshes[renderData.m_skinnedMeshIndex];
         skinnedMesh.m_useCount--;
         if (skinnedMesh.m_useCount == 0)
         {
             skinnedMesh.m_skinnedMeshInputBuffers.reset();
         }
 
+        if (renderData.m_skinnedMeshInstance)
+        {
+            m_outputStreamBytes -= GetOutputStreamBytes(skinnedMesh);
+        }
+
         // Release the per-instance data
-        RenderData& renderData = m_skinnedMeshInstances[i];
         m_skinnedMeshFeatureProcessor->ReleaseSkinnedMesh(renderData.m_skinnedMeshHandle);
         if (renderData.m_meshHandle)
         {
             m_meshFeatureProcessor->ReleaseMesh(*renderData.m_meshHandle);
+            renderData.m_meshHandle.reset();
         }
 
         renderData.m_skinnedMeshInstance.reset();
         renderData.m_boneTransformBuffer.reset();
     }
+
+    void SkinnedMeshContainer::EndFrame()
+    {
+        m_outOfMemoryFailuresLastFrame = m_outOfMemoryFailuresThisFrame;
+        m_outOfMemoryRetriesLastFrame = m_outOfMemoryRetriesThisFrame;
+        m_outOfMemoryFailuresThisFrame = 0;
+        m_outOfMemoryRetriesThisFrame = 0;
+    }
+
+    SkinnedMeshContainer::Stats SkinnedMeshContainer::GetStats() const
+    {
+        Stats stats;
+        stats.m_uniqueMeshCount = GetUniqueMeshCount();
+        for (const SkinnedMesh& skinnedMesh : m_skinnedMeshes)
+        {
+            if (skinnedMesh.m_skinnedMeshInputBuffers)
+            {
+                const ProceduralSkinnedMesh& mesh = skinnedMesh.m_proceduralSkinnedMesh;
+                const size_t vertexDataBytes = (mesh.m_positions.size() + mesh.m_normals.size() + mesh.m_tangents.size() + mesh.m_bitangents.size() + mesh.m_blendWeights.size()) * sizeof(float)
+                    + (mesh.m_indices.size() + mesh.m_blendIndices.size()) * sizeof(uint32_t)
+                    + mesh.m_uvs.size() * sizeof(mesh.m_uvs[0]);
+                ++stats.m_inputBufferCount;
+                stats.m_inputBufferBytes += vertexDataBytes * mesh.GetSubMeshCount();
+            }
+        }
+
+        stats.m_activeInstanceCount = m_activeSkinnedMeshCount;
+        for (uint32_t i = 0; i < m_activeSkinnedMeshCount; ++i)
+        {
+            if (m_skinnedMeshInstances[i].m_skinnedMeshInstance)
+            {
+                ++stats.m_skinnedInstanceCount;
+            }
+        }
+        stats.m_pendingInstanceCount = stats.m_activeInstanceCount - stats.m_skinnedInstanceCount;
+
+        stats.m_outputStreamBytes = m_outputStreamBytes;
+        stats.m_outputStreamBytesAtFirstFailure = m_outputStreamBytesAtFirstFailure;
+        stats.m_outOfMemoryFailuresLastFrame = m_outOfMemoryFailuresLastFrame;
+        stats.m_outOfMemoryRetriesLastFrame = m_outOfMemoryRetriesLastFrame;
+        stats.m_totalOutOfMemoryFailures = m_totalOutOfMemoryFailures;
+        stats.m_totalOutOfMemoryRetries = m_totalOutOfMemoryRetries;
+        return stats;
+    }
+
+    void SkinnedMeshContainer::DrawImGuiStats() const
+    {
+        const Stats stats = GetStats();
+        ImGui::Text("Instances: %u skinned, %u waiting for memory", stats.m_skinnedInstanceCount, stats.m_pendingInstanceCount);
+        ImGui::Text("Input buffers: %u shared by %u meshes, %.1f MiB",
+            stats.m_inputBufferCount, stats.m_uniqueMeshCount, stats.m_inputBufferBytes / (1024.0f * 1024.0f));
+        ImGui::Text("Output stream (estimated): %.1f MiB", stats.m_outputStreamBytes / (1024.0f * 1024.0f));
+        if (stats.m_totalOutOfMemoryFailures > 0)
+        {
+            ImGui::Text("Out of memory at: %.1f MiB", stats.m_outputStreamBytesAtFirstFailure / (1024.0f * 1024.0f));
+        }
+        ImGui::Text("Out of memory last frame: %u failures, %u retries", stats.m_outOfMemoryFailuresLastFrame, stats.m_outOfMemoryRetriesLastFrame);
+        ImGui::Text("Out of memory total: %llu failures, %llu retries",
+            static_cast<unsigned long long>(stats.m_totalOutOfMemoryFailures), static_cast<unsigned long long>(stats.m_totalOutOfMemoryRetries));
+    }
 }//namespace AtomSampleViewer
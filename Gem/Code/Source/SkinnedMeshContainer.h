@@ -16,6 +16,7 @@
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshOutputStreamManagerInterface.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorBus.h>
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Material/Material.h>
 
 namespace AtomSampleViewer
 {
@@ -24,7 +25,10 @@ namespace AtomSampleViewer
     //! The skinned mesh input buffers are generated using the ProceduralSkinnedMesh class, so that you can easily create
     //! an arbitrary number of skinned meshes with arbitrary complexity such as vertex count and bone count.
     //! Currently supports 1 lod per skinned mesh, one sub-mesh per lod, and 1-4 influences per vertex.
-    //! Currently supports a 1-1 mapping of skinned mesh inputs to skinned mesh instances.
+    //! Instances share the input buffers of their skinned mesh. Instance i uses skinned mesh i % GetUniqueMeshCount(), and
+    //! every unique mesh is a variant of the config with a different segment count, so it has input buffers of its own.
+    //! Instances that don't fit in the skinning output stream are retried when memory becomes available, and the
+    //! container keeps statistics of the output stream use and the retries of each frame.
     class SkinnedMeshContainer
         : private AZ::Render::SkinnedMeshOutputStreamNotificationBus::Handler
     {
@@ -43,25 +47,60 @@ namespace AtomSampleViewer
             AZStd::intrusive_ptr<AZ::Render::SkinnedMeshInstance> m_skinnedMeshInstance = nullptr;
             AZ::Data::Instance<AZ::RPI::Buffer> m_boneTransformBuffer = nullptr;
             AZStd::shared_ptr<AZ::Render::MeshFeatureProcessorInterface::MeshHandle> m_meshHandle;
+            uint32_t m_skinnedMeshIndex = 0;
+            bool m_isActive = false;                //!< Counted in the use count of its skinned mesh, even while waiting for memory
         };
 
+        struct Stats
+        {
+            uint32_t m_uniqueMeshCount = 0;
+            uint32_t m_inputBufferCount = 0;                //!< Unique meshes that have input buffers, shared by their instances
+            uint32_t m_activeInstanceCount = 0;
+            uint32_t m_skinnedInstanceCount = 0;            //!< Active instances that got memory in the skinning output stream
+            uint32_t m_pendingInstanceCount = 0;            //!< Active instances waiting for memory in the skinning output stream
+            size_t m_inputBufferBytes = 0;                  //!< CPU side size of the vertex data of the shared input buffers
+            size_t m_outputStreamBytes = 0;                 //!< Estimated skinning output stream use of the skinned instances
+            size_t m_outputStreamBytesAtFirstFailure = 0;   //!< Estimated use when an instance first didn't fit, 0 if none failed yet
+            uint32_t m_outOfMemoryFailuresLastFrame = 0;    //!< Instances that didn't fit in the previous frame, including retries
+            uint32_t m_outOfMemoryRetriesLastFrame = 0;     //!< Retries of pending instances in the previous frame
+            uint64_t m_totalOutOfMemoryFailures = 0;
+            uint64_t m_totalOutOfMemoryRetries = 0;
+        };
+
+        //! Bytes of skinning output per vertex: position, normal, tangent, bitangent and the previous frame's position.
+        static constexpr size_t SkinningOutputBytesPerVertex = (3 + 3 + 4 + 3 + 3) * sizeof(float);
+
         SkinnedMeshContainer(AZ::Render::SkinnedMeshFeatureProcessorInterface* skinnedMeshFeatureProcessor, AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor, const SkinnedMeshConfig& config);
         AZ_DISABLE_COPY(SkinnedMeshContainer);
         ~SkinnedMeshContainer();
 
         void SetActiveSkinnedMeshCount(uint32_t activeSkinnedMeshCount);
-        uint32_t GetMaxSkinnedMeshes() const { return aznumeric_cast<uint32_t>(m_skinnedMeshes.size()); }
+        uint32_t GetMaxSkinnedMeshes() const { return aznumeric_cast<uint32_t>(m_skinnedMeshInstances.size()); }
         uint32_t GetActiveSkinnedMeshCount() const { return m_activeSkinnedMeshCount; }
 
+        //! Sets how many distinct skinned meshes the instances are spread over. Re-creates the active instances.
+        void SetUniqueMeshCount(uint32_t uniqueMeshCount);
+        uint32_t GetUniqueMeshCount() const { return aznumeric_cast<uint32_t>(m_skinnedMeshes.size()); }
+
         SkinnedMeshConfig GetSkinnedMeshConfig() const;
         void SetSkinnedMeshConfig(const SkinnedMeshConfig& skinnedMeshConfig);
         void UpdateAnimation(float time, bool useOutOfSyncBoneAnimation);
         void DrawBones();
+
+        //! Closes the out-of-memory counts of the current frame. Call once per frame.
+        void EndFrame();
+
+        Stats GetStats() const;
+        void DrawImGuiStats() const;
+
     private:
         void SetupSkinnedMeshes();
-        void SetupNewSkinnedMesh(SkinnedMeshConfig& skinnedMeshConfig);
+        SkinnedMeshConfig GetUniqueMeshConfig(uint32_t uniqueMeshIndex) const;
+        AZ::Transform GetInstanceTransform(uint32_t i) const;
+        size_t GetOutputStreamBytes(const SkinnedMesh& skinnedMesh) const;
         void AcquireSkinnedMesh(uint32_t i);
-        void CreateInstance(uint32_t i);
+        //! Returns false if the instance didn't fit in the skinning output stream
+        bool CreateInstance(uint32_t i);
         void ReleaseSkinnedMesh(uint32_t i);
 
         // SkinnedMeshOutputStreamNotificationBus::Handler overrides
@@ -74,5 +113,15 @@ namespace AtomSampleViewer
         uint32_t m_activeSkinnedMeshCount = 0;
         SkinnedMeshConfig m_skinnedMeshConfig;
         AZStd::queue<uint32_t> m_instancesOutOfMemory;
+        AZ::Data::Instance<AZ::RPI::Material> m_material;
+
+        size_t m_outputStreamBytes = 0;
+        size_t m_outputStreamBytesAtFirstFailure = 0;
+        uint32_t m_outOfMemoryFailuresThisFrame = 0;
+        uint32_t m_outOfMemoryRetriesThisFrame = 0;
+        uint32_t m_outOfMemoryFailuresLastFrame = 0;
+        uint32_t m_outOfMemoryRetriesLastFrame = 0;
+        uint64_t m_totalOutOfMemoryFailures = 0;
+        uint64_t m_totalOutOfMemoryRetries = 0;
     };
 } // namespace AtomSampleViewer
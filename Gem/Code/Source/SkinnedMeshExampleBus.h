@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Requests handled by the active SkinnedMeshExampleComponent sample, used by scripts to collect its measurements.
+    class SkinnedMeshExampleRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        //! Writes the instance counts, skinning memory use, out-of-memory retries and frame times of the sample to a JSON
+        //! file. Returns false if the file couldn't be written.
+        virtual bool WriteSkinnedMeshStatistics(const AZStd::string& filePath) = 0;
+    };
+
+    using SkinnedMeshExampleRequestBus = AZ::EBus<SkinnedMeshExampleRequests>;
+
+} // namespace AtomSampleViewer
@@ -10,6 +10,7 @@
 #include <SampleComponentManager.h>
 #include <SampleComponentConfig.h>
 #include <Automation/ScriptableImGui.h>
+#include <Utils/JsonFile.h>
 
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
 
@@ -29,6 +30,12 @@
 
 namespace AtomSampleViewer
 {
+    namespace
+    {
+        static const int MaxStressInstanceCount = 4096;
+        static const int MaxStressUniqueMeshCount = 64;
+    }
+
     void SkinnedMeshExampleComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -45,6 +52,7 @@ namespace AtomSampleViewer
         m_skinnedMeshContainer->SetActiveSkinnedMeshCount(1);
 
         AZ::TickBus::Handler::BusConnect();
+        SkinnedMeshExampleRequestBus::Handler::BusConnect();
         m_imguiSidebar.Activate();
         ConfigureCamera();
         AddImageBasedLight();
@@ -60,6 +68,7 @@ namespace AtomSampleViewer
     void SkinnedMeshExampleComponent::Deactivate()
     {
         m_skinnedMeshContainer = nullptr;
+        SkinnedMeshExampleRequestBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         m_imguiSidebar.Deactivate();
         GetMeshFeatureProcessor()->ReleaseMesh(m_planeMeshHandle);
@@ -83,6 +92,7 @@ namespace AtomSampleViewer
     void SkinnedMeshExampleComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint timePoint)
     {
         m_runTime += deltaTime;
+        m_frameTimeMs.PushValue(deltaTime * 1000.0f);
         DrawSidebar();
         if (!m_useFixedTime)
         {
@@ -92,6 +102,7 @@ namespace AtomSampleViewer
         {
             m_skinnedMeshContainer->DrawBones();
         }
+        m_skinnedMeshContainer->EndFrame();
     }
 
     void SkinnedMeshExampleComponent::DrawSidebar()
@@ -115,6 +126,7 @@ namespace AtomSampleViewer
         {
             config.m_segmentCount = static_cast<int>(segmentCountFloat);
             m_skinnedMeshContainer->SetSkinnedMeshConfig(config);
+            m_frameTimeMs.Reset();
         }
 
         bool animationWasModified = configWasModified;
@@ -134,9 +146,91 @@ namespace AtomSampleViewer
             m_runTime = 0;
         }
 
+        ImGui::Separator();
+        DrawStressModeControls();
+
         m_imguiSidebar.End();
     }
 
+    void SkinnedMeshExampleComponent::DrawStressModeControls()
+    {
+        bool instancesWereModified = ScriptableImGui::Checkbox("Stress Mode", &m_stressModeEnabled);
+        if (m_stressModeEnabled)
+        {
+            instancesWereModified |= ScriptableImGui::SliderInt("Instance Count", &m_stressInstanceCount, 1, MaxStressInstanceCount);
+            instancesWereModified |= ScriptableImGui::SliderInt("Unique Meshes", &m_stressUniqueMeshCount, 1, MaxStressUniqueMeshCount);
+        }
+
+        if (instancesWereModified)
+        {
+            m_skinnedMeshContainer->SetUniqueMeshCount(m_stressModeEnabled ? m_stressUniqueMeshCount : 1);
+            m_skinnedMeshContainer->SetActiveSkinnedMeshCount(m_stressModeEnabled ? m_stressInstanceCount : 1);
+            m_frameTimeMs.Reset();
+        }
+
+        m_skinnedMeshContainer->DrawImGuiStats();
+        if (m_frameTimeMs.GetCount() > 0)
+        {
+            ImGui::Text("Frame time: %.2f ms mean, %.2f ms p99",
+                m_frameTimeMs.GetMean(), m_frameTimeMs.GetQuantile(FrameTimeStatistics::Quantile::P99));
+        }
+
+        if (ScriptableImGui::Button("Reset Frame Times"))
+        {
+            m_frameTimeMs.Reset();
+        }
+    }
+
+    bool SkinnedMeshExampleComponent::WriteSkinnedMeshStatistics(const AZStd::string& filePath)
+    {
+        const SkinnedMeshConfig config = m_skinnedMeshContainer->GetSkinnedMeshConfig();
+        const SkinnedMeshContainer::Stats stats = m_skinnedMeshContainer->GetStats();
+
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("segmentCount");
+                writer.Int(config.m_segmentCount);
+                writer.Key("verticesPerSegment");
+                writer.Int(config.m_verticesPerSegment);
+                writer.Key("boneCount");
+                writer.Int(config.m_boneCount);
+                writer.Key("subMeshCount");
+                writer.Int(config.m_subMeshCount);
+                writer.Key("uniqueMeshes");
+                writer.Uint(stats.m_uniqueMeshCount);
+                writer.Key("inputBuffers");
+                writer.Uint(stats.m_inputBufferCount);
+                writer.Key("inputBufferBytes");
+                writer.Uint64(stats.m_inputBufferBytes);
+                writer.Key("activeInstances");
+                writer.Uint(stats.m_activeInstanceCount);
+                writer.Key("skinnedInstances");
+                writer.Uint(stats.m_skinnedInstanceCount);
+                writer.Key("pendingInstances");
+                writer.Uint(stats.m_pendingInstanceCount);
+                writer.Key("estimatedOutputStreamBytes");
+                writer.Uint64(stats.m_outputStreamBytes);
+                writer.Key("estimatedOutputStreamBytesAtFirstFailure");
+                writer.Uint64(stats.m_outputStreamBytesAtFirstFailure);
+                writer.Key("outOfMemoryFailuresLastFrame");
+                writer.Uint(stats.m_outOfMemoryFailuresLastFrame);
+                writer.Key("outOfMemoryRetriesLastFrame");
+                writer.Uint(stats.m_outOfMemoryRetriesLastFrame);
+                writer.Key("totalOutOfMemoryFailures");
+                writer.Uint64(stats.m_totalOutOfMemoryFailures);
+                writer.Key("totalOutOfMemoryRetries");
+                writer.Uint64(stats.m_totalOutOfMemoryRetries);
+                writer.Key("frames");
+                writer.Uint64(m_frameTimeMs.GetCount());
+                writer.Key("frameTimeMeanMs");
+                writer.Double(m_frameTimeMs.GetMean());
+                writer.Key("frameTimeP99Ms");
+                writer.Double(m_frameTimeMs.GetQuantile(FrameTimeStatistics::Quantile::P99));
+                writer.EndObject();
+            });
+    }
+
     void SkinnedMeshExampleComponent::CreateSkinnedMeshContainer()
     {
         const auto skinnedMeshFeatureProcessor = m_scene->GetFeatureProcessor<AZ::Render::SkinnedMeshFeatureProcessorInterface>();
@@ -10,6 +10,7 @@
 
 #include <CommonSampleComponentBase.h>
 #include <SkinnedMeshContainer.h>
+#include <SkinnedMeshExampleBus.h>
 
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
@@ -17,6 +18,7 @@
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 #include <AtomCore/Instance/Instance.h>
 
+#include <Utils/FrameTimeStatistics.h>
 #include <Utils/Utils.h>
 #include <Utils/ImGuiSidebar.h>
 
@@ -36,9 +38,12 @@ namespace AtomSampleViewer
     class ProceduralSkinnedMesh;
 
     //! This component creates a simple scene to test Atom's SkinnedMesh system.
+    //! The stress mode spreads thousands of instances over a few shared meshes, to find where the skinning output stream
+    //! runs out of memory and how the frame time scales with the instance count.
     class SkinnedMeshExampleComponent final
         : public CommonSampleComponentBase
         , private AZ::TickBus::Handler
+        , private SkinnedMeshExampleRequestBus::Handler
     {
     public:
 
@@ -53,11 +58,15 @@ namespace AtomSampleViewer
         // AZ::TickBus::Handler
         void OnTick(float deltaTime, AZ::ScriptTimePoint timePoint) override;
 
+        // SkinnedMeshExampleRequestBus::Handler
+        bool WriteSkinnedMeshStatistics(const AZStd::string& filePath) override;
+
         void CreateSkinnedMeshContainer();
         void CreatePlaneObject();
         void ConfigureCamera();
         void AddImageBasedLight();
         void DrawSidebar();
+        void DrawStressModeControls();
 
         Utils::DefaultIBL m_defaultIbl;
         AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_planeMeshHandle;
@@ -68,6 +77,11 @@ namespace AtomSampleViewer
         bool m_useOutOfSyncBoneAnimation = false;
         bool m_drawBones = true;
 
+        bool m_stressModeEnabled = false;
+        int m_stressInstanceCount = 1024;
+        int m_stressUniqueMeshCount = 4;
+        FrameTimeStatistics m_frameTimeMs;      //!< Frame times since the instance count or the meshes last changed
+
         AZStd::unique_ptr<SkinnedMeshContainer> m_skinnedMeshContainer;
     };
 } // namespace AtomSampleViewer
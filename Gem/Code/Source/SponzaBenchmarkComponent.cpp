@@ -85,7 +85,7 @@ namespace AtomSampleViewer
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<SponzaBenchmarkComponent::RunBenchmarkData>()
-                ->Version(0)
+                ->Version(1)
                 ->Field("Name", &SponzaBenchmarkComponent::RunBenchmarkData::m_name)
                 ->Field("FrameCount", &SponzaBenchmarkComponent::RunBenchmarkData::m_frameCount)
                 ->Field("TimeToFirstFrame", &SponzaBenchmarkComponent::RunBenchmarkData::m_timeToFirstFrame)
@@ -93,6 +93,10 @@ namespace AtomSampleViewer
                 ->Field("AverageFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_averageFrameTime)
                 ->Field("50% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_50pFramesUnder)
                 ->Field("90% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_90pFramesUnder)
+                ->Field("99% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_99pFramesUnder)
+                ->Field("99.9% of FrameTimes Under", &SponzaBenchmarkComponent::RunBenchmarkData::m_999pFramesUnder)
+                ->Field("FrameTimeStandardDeviation", &SponzaBenchmarkComponent::RunBenchmarkData::m_frameTimeStandardDeviation)
+                ->Field("StutterCount", &SponzaBenchmarkComponent::RunBenchmarkData::m_stutterCount)
                 ->Field("MinFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_minFrameTime)
                 ->Field("MaxFrameTime", &SponzaBenchmarkComponent::RunBenchmarkData::m_maxFrameTime)
                 ->Field("AverageFrameRate", &SponzaBenchmarkComponent::RunBenchmarkData::m_averageFrameRate)
@@ -394,6 +398,7 @@ namespace AtomSampleViewer
     {
         m_currentRunBenchmarkData = RunBenchmarkData();
         m_currentRunBenchmarkData.m_name = "Sponza Run";
+        m_runFrameTimeStatistics.Reset();
 
         Utils::ToggleRadTMCapture();
         m_benchmarkStartTimePoint = m_currentTimePointInSeconds;
@@ -404,6 +409,7 @@ namespace AtomSampleViewer
         const float dtInMS = deltaTime * 1000.0f;
 
         m_currentRunBenchmarkData.m_frameTimes.push_back(dtInMS);
+        m_runFrameTimeStatistics.PushValue(dtInMS);
         m_currentRunBenchmarkData.m_frameCount++;
         m_currentRunBenchmarkData.m_timeInSeconds = timePoint.GetSeconds() - m_benchmarkStartTimePoint;
         if (dtInMS < m_currentRunBenchmarkData.m_minFrameTime)
@@ -425,33 +431,14 @@ namespace AtomSampleViewer
         m_currentRunBenchmarkData.m_averageFrameTime =
             (m_currentRunBenchmarkData.m_timeInSeconds / m_currentRunBenchmarkData.m_frameCount) * 1000.0f;
 
-        // Need to sort the frame times so we can find the 50th and 90th percentile
-        AZStd::vector<float> sortedFrameTimes = m_currentRunBenchmarkData.m_frameTimes;
-        AZStd::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
-
-        const size_t frameTimeCount = m_currentRunBenchmarkData.m_frameTimes.size();
-
-        const bool evenNumberOfFrames = frameTimeCount & 1;
-        if (!evenNumberOfFrames)
-        {
-            const size_t medianIndex = frameTimeCount / 2;
-
-            m_currentRunBenchmarkData.m_50pFramesUnder = sortedFrameTimes[medianIndex];
-        }
-        else
-        {
-            const size_t medianIndex1 = frameTimeCount / 2;
-            const size_t medianIndex2 = medianIndex1 + 1;
-
-            const float median = (sortedFrameTimes[medianIndex1] + sortedFrameTimes[medianIndex2]) / 2.0f;
-
-            m_currentRunBenchmarkData.m_50pFramesUnder = median;
-        }
-
-        const float p90Indexf = ceilf(static_cast<float>(frameTimeCount) * .9f);
-        const size_t p90Index = static_cast<size_t>(p90Indexf);
-
-        m_currentRunBenchmarkData.m_90pFramesUnder = sortedFrameTimes[p90Index];
+        // The quantiles are estimated while the frames are collected, so there's no need to sort the frame times here
+        using Quantile = FrameTimeStatistics::Quantile;
+        m_currentRunBenchmarkData.m_50pFramesUnder = m_runFrameTimeStatistics.GetQuantile(Quantile::P50);
+        m_currentRunBenchmarkData.m_90pFramesUnder = m_runFrameTimeStatistics.GetQuantile(Quantile::P90);
+        m_currentRunBenchmarkData.m_99pFramesUnder = m_runFrameTimeStatistics.GetQuantile(Quantile::P99);
+        m_currentRunBenchmarkData.m_999pFramesUnder = m_runFrameTimeStatistics.GetQuantile(Quantile::P999);
+        m_currentRunBenchmarkData.m_frameTimeStandardDeviation = m_runFrameTimeStatistics.GetStandardDeviation();
+        m_currentRunBenchmarkData.m_stutterCount = m_runFrameTimeStatistics.GetStutterCount();
         m_currentRunBenchmarkData.m_timeToFirstFrame = m_timeToFirstFrame;
 
         float averageFrameRate = 0.0f;
@@ -617,6 +604,10 @@ namespace AtomSampleViewer
             ImGui::Text("Average Frame Time: %f ms", m_currentRunBenchmarkData.m_averageFrameTime);
             ImGui::Text("50%% Frames Under: %f ms", m_currentRunBenchmarkData.m_50pFramesUnder);
             ImGui::Text("90%% Frames Under: %f ms", m_currentRunBenchmarkData.m_90pFramesUnder);
+            ImGui::Text("99%% Frames Under: %f ms", m_currentRunBenchmarkData.m_99pFramesUnder);
+            ImGui::Text("99.9%% Frames Under: %f ms", m_currentRunBenchmarkData.m_999pFramesUnder);
+            ImGui::Text("Frame Time Std Dev: %f ms", m_currentRunBenchmarkData.m_frameTimeStandardDeviation);
+            ImGui::Text("Stutters: %llu", static_cast<unsigned long long>(m_currentRunBenchmarkData.m_stutterCount));
             ImGui::Text("Min Frame Time: %f ms", m_currentRunBenchmarkData.m_minFrameTime);
             ImGui::Text("Max Frame Time: %f ms", m_currentRunBenchmarkData.m_maxFrameTime);
             ImGui::Text("Average Frame Rate: %f Hz", m_currentRunBenchmarkData.m_averageFrameRate);
@@ -20,6 +20,7 @@
 #include <Atom/Feature/CoreLights/DirectionalLightFeatureProcessorInterface.h>
 #include <Atom/Feature/SkyBox/SkyBoxFeatureProcessorInterface.h>
 
+#include <Utils/FrameTimeStatistics.h>
 #include <Utils/Utils.h>
 
 struct ImGuiContext;
@@ -103,6 +104,10 @@ namespace AtomSampleViewer
             double m_averageFrameTime = 0.0;
             float m_50pFramesUnder = 0.0f;
             float m_90pFramesUnder = 0.0f;
+            float m_99pFramesUnder = 0.0f;
+            float m_999pFramesUnder = 0.0f;
+            double m_frameTimeStandardDeviation = 0.0;
+            AZ::u64 m_stutterCount = 0; // frames over FrameTimeStatistics::DefaultStutterThresholdMs
             float m_minFrameTime = FLT_MAX;
             float m_maxFrameTime = FLT_MIN;
 
@@ -119,6 +124,7 @@ namespace AtomSampleViewer
 
         LoadBenchmarkData m_currentLoadBenchmarkData;
         RunBenchmarkData m_currentRunBenchmarkData;
+        FrameTimeStatistics m_runFrameTimeStatistics{ FrameTimeStatistics::DefaultStutterThresholdMs };
 
         struct CameraPathPoint
         {
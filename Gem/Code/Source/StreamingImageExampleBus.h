@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Requests handled by the active StreamingImageExampleComponent sample, used by scripts to collect its streaming telemetry.
+    class StreamingImageExampleRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        //! Records the residency and pool memory of the streaming images at the current mip bias as a point of the
+        //! residency curve.
+        virtual void RecordResidencyPoint() = 0;
+
+        //! Writes the per-image streaming times, pool memory samples, throughput and residency curve to a JSON file.
+        //! Returns false if the file couldn't be written.
+        virtual bool WriteStreamingTelemetry(const AZStd::string& filePath) = 0;
+    };
+
+    using StreamingImageExampleRequestBus = AZ::EBus<StreamingImageExampleRequests>;
+
+} // namespace AtomSampleViewer
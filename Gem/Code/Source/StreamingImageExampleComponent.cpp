@@ -135,23 +135,10 @@ namespace AtomSampleViewer
             DeleteHotReloadImage();
         }
 
-        m_loadImageStart = AZStd::GetTimeUTCMilliSecond();
-
-        // Queue load all the textures under Textures\Streaming folder
-        for (uint32_t index = 0; index < TestDDSCount; index++)
-        {
-            AZ::IO::Path filePath = TestImageFolder / AZStd::string::format("streaming%d.dds.streamingimage", index);
-            QueueForLoad(filePath.Native());
-        }
-
-        // All Images loaded here have non-power-of-two sizes
-        for (uint32_t index = 0; index < TestPNGCount; index++)
-        {
-            AZ::IO::Path filePath = TestImageFolder / AZStd::string::format("streaming%d.png.streamingimage", index);
-            QueueForLoad(filePath.Native());
-        }
+        LoadImages();
 
         AZ::TickBus::Handler::BusConnect();
+        StreamingImageExampleRequestBus::Handler::BusConnect();
 
         if (m_enableHotReloadTest)
         {
@@ -210,11 +197,13 @@ namespace AtomSampleViewer
         }
         ImageToDraw* imageToDraw = iter;
         ptrdiff_t index = AZStd::distance(m_images.begin(), iter);
+        m_loadScheduler.OnLoadFinished(aznumeric_cast<uint32_t>(index));
 
         AZ::u64 startTime = AZStd::GetTimeUTCMilliSecond();
         imageToDraw->m_image = AZ::RPI::StreamingImage::FindOrCreate(asset);
         AZ::u64 endTime = AZStd::GetTimeUTCMilliSecond();
         m_createImageTime += endTime - startTime;
+        m_telemetry.OnFirstMipResident(aznumeric_cast<uint32_t>(index), GetTelemetryTimeMs());
 
         AZ::Data::AssetInfo info;
         AZ::Data::AssetCatalogRequestBus::BroadcastResult(info, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, imageToDraw->m_image->GetAssetId());
@@ -222,24 +211,9 @@ namespace AtomSampleViewer
 
         imageToDraw->m_srg->SetImage(m_imageInputIndex, imageToDraw->m_image);
 
-        size_t rows = 6;
-        size_t columns = (m_images.size() + rows - 1) / rows;
-        float xOffset = AreaWidth / columns;
-        float yOffset = AreaHeight / rows;
-        AZStd::array<float, 2> mipSize;
-        if (yOffset * ratioYtoX > xOffset / 1.5f) // the xOffset should be 1.5 times of mip size so it can show lower mips
-        {
-            mipSize[0] = xOffset / 1.5f;
-            mipSize[1] = mipSize[0] / ratioYtoX;
-        }
-        else
-        {
-            mipSize[0] = yOffset * ratioYtoX;
-            mipSize[1] = yOffset;
-        }
         AZStd::array<float, 2> position;
-        position[0] = (index / rows) * xOffset + AreaLeft;
-        position[1] = (index % rows) * yOffset + AreaBottom;
+        AZStd::array<float, 2> mipSize;
+        GetImageLayout(index, position, mipSize);
 
         imageToDraw->m_srg->SetConstant(m_positionInputIndex, position);
         imageToDraw->m_srg->SetConstant(m_sizeInputIndex, mipSize);
@@ -264,6 +238,21 @@ namespace AtomSampleViewer
         }
     }
 
+    void StreamingImageExampleComponent::OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        auto iter = AZStd::find_if(m_images.begin(), m_images.end(), [&asset](const ImageToDraw& image)
+        {
+            return image.m_assetId == asset.GetId();
+        });
+
+        // Let the next load take the place of the failed one
+        if (iter != m_images.end())
+        {
+            AZ::Data::AssetBus::MultiHandler::BusDisconnect(asset.GetId());
+            m_loadScheduler.OnLoadFinished(aznumeric_cast<uint32_t>(AZStd::distance(m_images.begin(), iter)));
+        }
+    }
+
     void StreamingImageExampleComponent::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
     {
         OnCatalogAssetAdded(assetId);
@@ -295,6 +284,7 @@ namespace AtomSampleViewer
             AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
         }
         AZ::TickBus::Handler::BusDisconnect();
+        StreamingImageExampleRequestBus::Handler::BusDisconnect();
 
         // If there are any assets that haven't finished loading yet, and thus haven't been disconnected, disconnect now.
         AZ::Data::AssetBus::MultiHandler::BusDisconnect();
@@ -307,6 +297,7 @@ namespace AtomSampleViewer
         m_imguiSidebar.Deactivate();
 
         m_images.clear();
+        m_loadScheduler.Clear();
         m_numImageAssetQueued = 0;
         m_numImageCreated = 0;
 
@@ -331,10 +322,18 @@ namespace AtomSampleViewer
 
     void StreamingImageExampleComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint timePoint)
     {
+        m_loadScheduler.Update([this](uint32_t imageIndex)
+            {
+                IssueImageLoad(imageIndex);
+            });
+
+        const double nowMs = GetTelemetryTimeMs();
+
         // update image streaming states
         uint32_t numStreamed = 0;
-        for (auto& imageInfo : m_images)
+        for (uint32_t imageIndex = 0; imageIndex < m_images.size(); ++imageIndex)
         {
+            ImageToDraw& imageInfo = m_images[imageIndex];
             if (imageInfo.m_image)
             {
                 imageInfo.m_srg->SetConstant<int>(m_residentMipInputIndex, imageInfo.m_image->GetResidentMipLevel());
@@ -342,10 +341,30 @@ namespace AtomSampleViewer
                 if (imageInfo.m_image->IsStreamed())
                 {
                     numStreamed ++;
+                    if (!m_telemetry.IsFullyResident(imageIndex))
+                    {
+                        m_telemetry.OnFullyResident(imageIndex, nowMs, GetImageAssetSize(imageInfo.m_image.get()));
+                    }
                 }
             }
         }
 
+        {
+            Data::Instance<RPI::StreamingImagePool> streamingImagePool = RPI::ImageSystemInterface::Get()->GetSystemStreamingPool();
+            const RHI::HeapMemoryUsage& memoryUsage = streamingImagePool->GetRHIPool()->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            m_telemetry.SampleMemory(nowMs, memoryUsage.m_usedResidentInBytes.load(), memoryUsage.m_totalResidentInBytes.load());
+        }
+
+        if (!m_usefulFrameRecorded)
+        {
+            const double timeToUsefulFrameMs = m_telemetry.GetTimeToUsefulFrameMs();
+            if (timeToUsefulFrameMs >= 0.0)
+            {
+                m_timeToUsefulFrameMs[static_cast<size_t>(m_loadPolicy)] = timeToUsefulFrameMs;
+                m_usefulFrameRecorded = true;
+            }
+        }
+
         // only need to set the image the first time all images were streamed
         if (m_streamingImageEnd == 0 && numStreamed == m_numImageCreated && m_numImageCreated > 0 && m_numImageAssetQueued == m_numImageCreated)
         {
@@ -398,14 +417,19 @@ namespace AtomSampleViewer
             }
 
             int mipBias = streamingImagePool->GetMipBias();
-            ImGui::Text("Mip bias");
-            if (ScriptableImGui::SliderInt("", &mipBias, -aznumeric_cast<int>(RHI::Limits::Image::MipCountMax), RHI::Limits::Image::MipCountMax))
+            if (ScriptableImGui::SliderInt("Mip bias", &mipBias, -aznumeric_cast<int>(RHI::Limits::Image::MipCountMax), RHI::Limits::Image::MipCountMax))
             {
                 streamingImagePool->SetMipBias(aznumeric_cast<int16_t>(mipBias));
             }
             ImGui::Unindent();
             ImGui::EndGroup();
 
+            ImGui::Separator();
+            DisplayLoadSchedulerSettings();
+            ImGui::Separator();
+            m_telemetry.DrawImGui();
+            ImGui::Separator();
+
             // Draw menus and info when streaming is finished
             if (streamingFinished)
             {
@@ -547,6 +571,104 @@ namespace AtomSampleViewer
         ImGui::EndGroup();
     }
 
+    void StreamingImageExampleComponent::DisplayLoadSchedulerSettings()
+    {
+        ImGui::BeginGroup();
+        ImGui::Text("Texture loading");
+        ImGui::Indent();
+
+        bool prioritizedLoading = m_loadScheduler.GetPolicy() == TextureLoadScheduler::Policy::Prioritized;
+        if (ScriptableImGui::Checkbox("Prioritized loading", &prioritizedLoading))
+        {
+            m_loadScheduler.SetPolicy(prioritizedLoading ? TextureLoadScheduler::Policy::Prioritized : TextureLoadScheduler::Policy::Fifo);
+        }
+
+        int maxInFlightLoads = aznumeric_cast<int>(m_loadScheduler.GetMaxInFlightLoads());
+        if (ScriptableImGui::SliderInt("Max in-flight loads", &maxInFlightLoads, 1, 64))
+        {
+            m_loadScheduler.SetMaxInFlightLoads(aznumeric_cast<uint32_t>(maxInFlightLoads));
+        }
+
+        const uint64_t KB = 1024;
+        int maxKBPerFrame = aznumeric_cast<int>(m_loadScheduler.GetMaxBytesPerFrame() / KB);
+        if (ScriptableImGui::SliderInt("Max KB per frame", &maxKBPerFrame, 64, 64 * 1024))
+        {
+            m_loadScheduler.SetMaxBytesPerFrame(aznumeric_cast<uint64_t>(maxKBPerFrame) * KB);
+        }
+
+        ImGui::Text("Queued: %zu, in flight: %zu", m_loadScheduler.GetQueuedCount(), m_loadScheduler.GetInFlightCount());
+
+        // The time the images holding most of the screen-space priority took to show up, for the last load with each policy
+        for (size_t policyIndex = 0; policyIndex < m_timeToUsefulFrameMs.size(); ++policyIndex)
+        {
+            const char* policyName = TextureLoadScheduler::GetPolicyName(static_cast<TextureLoadScheduler::Policy>(policyIndex));
+            if (m_timeToUsefulFrameMs[policyIndex] >= 0.0)
+            {
+                ImGui::Text("%s time to useful frame: %.1f ms", policyName, m_timeToUsefulFrameMs[policyIndex]);
+            }
+            else
+            {
+                ImGui::Text("%s time to useful frame: -", policyName);
+            }
+        }
+
+        if (ScriptableImGui::Button("Reload images"))
+        {
+            ReloadImages();
+        }
+
+        ImGui::Unindent();
+        ImGui::EndGroup();
+    }
+
+    double StreamingImageExampleComponent::GetTelemetryTimeMs() const
+    {
+        using Milliseconds = AZStd::chrono::duration<double, AZStd::milli>;
+        return AZStd::chrono::duration_cast<Milliseconds>(AZStd::chrono::steady_clock::now() - m_telemetryStart).count();
+    }
+
+    void StreamingImageExampleComponent::RecordResidencyPoint()
+    {
+        Data::Instance<RPI::StreamingImagePool> streamingImagePool = RPI::ImageSystemInterface::Get()->GetSystemStreamingPool();
+        const RHI::HeapMemoryUsage& memoryUsage = streamingImagePool->GetRHIPool()->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+
+        StreamingImageTelemetry::ResidencyPoint point;
+        point.m_mipBias = streamingImagePool->GetMipBias();
+        point.m_usedBytes = memoryUsage.m_usedResidentInBytes.load();
+        point.m_allocatedBytes = memoryUsage.m_totalResidentInBytes.load();
+
+        double residentMipSum = 0.0;
+        double residentTexels = 0.0;
+        double fullTexels = 0.0;
+        for (const ImageToDraw& imageInfo : m_images)
+        {
+            if (imageInfo.m_image)
+            {
+                const uint32_t residentMip = imageInfo.m_image->GetResidentMipLevel();
+                const RHI::Size& size = imageInfo.m_image->GetDescriptor().m_size;
+                const double texelCount = static_cast<double>(size.m_width) * size.m_height;
+
+                ++point.m_imageCount;
+                point.m_streamedImageCount += imageInfo.m_image->IsStreamed() ? 1 : 0;
+                residentMipSum += residentMip;
+                residentTexels += texelCount * StreamingImageTelemetry::GetMipTexelRatio(residentMip);
+                fullTexels += texelCount;
+            }
+        }
+        if (point.m_imageCount > 0)
+        {
+            point.m_meanResidentMip = static_cast<float>(residentMipSum / point.m_imageCount);
+            point.m_residentTexelRatio = static_cast<float>(residentTexels / fullTexels);
+        }
+
+        m_telemetry.AddResidencyPoint(point);
+    }
+
+    bool StreamingImageExampleComponent::WriteStreamingTelemetry(const AZStd::string& filePath)
+    {
+        return m_telemetry.WriteJson(filePath);
+    }
+
     bool StreamingImageExampleComponent::CopyFile(const AZStd::string& destFile, const AZStd::string& sourceFile)
     {
         IO::FileIOStream fileRead(sourceFile.c_str(), IO::OpenMode::ModeRead | IO::OpenMode::ModeBinary);
@@ -617,6 +739,100 @@ namespace AtomSampleViewer
         return totalSize;
     }
 
+    void StreamingImageExampleComponent::GetImageLayout(size_t imageIndex, AZStd::array<float, 2>& position, AZStd::array<float, 2>& mipSize) const
+    {
+        const float ratioYtoX = 1.0f;
+
+        size_t rows = 6;
+        size_t columns = (m_images.size() + rows - 1) / rows;
+        float xOffset = AreaWidth / columns;
+        float yOffset = AreaHeight / rows;
+        if (yOffset * ratioYtoX > xOffset / 1.5f) // the xOffset should be 1.5 times of mip size so it can show lower mips
+        {
+            mipSize[0] = xOffset / 1.5f;
+            mipSize[1] = mipSize[0] / ratioYtoX;
+        }
+        else
+        {
+            mipSize[0] = yOffset * ratioYtoX;
+            mipSize[1] = yOffset;
+        }
+        position[0] = (imageIndex / rows) * xOffset + AreaLeft;
+        position[1] = (imageIndex % rows) * yOffset + AreaBottom;
+    }
+
+    void StreamingImageExampleComponent::LoadImages()
+    {
+        m_loadImageStart = AZStd::GetTimeUTCMilliSecond();
+        m_telemetryStart = AZStd::chrono::steady_clock::now();
+        m_telemetry.Start();
+        m_loadPolicy = m_loadScheduler.GetPolicy();
+        m_usefulFrameRecorded = false;
+
+        // Queue load all the textures under Textures\Streaming folder
+        for (uint32_t index = 0; index < TestDDSCount; index++)
+        {
+            AZ::IO::Path filePath = TestImageFolder / AZStd::string::format("streaming%d.dds.streamingimage", index);
+            QueueForLoad(filePath.Native());
+        }
+
+        // All Images loaded here have non-power-of-two sizes
+        for (uint32_t index = 0; index < TestPNGCount; index++)
+        {
+            AZ::IO::Path filePath = TestImageFolder / AZStd::string::format("streaming%d.png.streamingimage", index);
+            QueueForLoad(filePath.Native());
+        }
+
+        // The layout depends on the image count, so priorities are assigned once every image is queued.
+        // Images near the center of the screen are the ones a viewer looks at first.
+        for (uint32_t imageIndex = 0; imageIndex < m_images.size(); ++imageIndex)
+        {
+            AZStd::array<float, 2> position;
+            AZStd::array<float, 2> mipSize;
+            GetImageLayout(imageIndex, position, mipSize);
+            const float centerX = position[0] + mipSize[0] * 0.5f;
+            const float centerY = position[1] + mipSize[1] * 0.5f;
+            const float priority = TextureLoadScheduler::ComputePriority(mipSize[0] * mipSize[1], sqrtf(centerX * centerX + centerY * centerY));
+
+            AZ::Data::AssetInfo info;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(info, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, m_images[imageIndex].m_assetId);
+
+            m_telemetry.AddImage(info.m_relativePath, GetTelemetryTimeMs(), priority);
+            m_loadScheduler.Enqueue(imageIndex, priority, info.m_sizeBytes);
+        }
+    }
+
+    void StreamingImageExampleComponent::ReloadImages()
+    {
+        for (const ImageToDraw& imageInfo : m_images)
+        {
+            AZ::Data::AssetBus::MultiHandler::BusDisconnect(imageInfo.m_assetId);
+        }
+        m_images.clear();
+        m_loadScheduler.Clear();
+
+        m_numImageAssetQueued = 0;
+        m_numImageCreated = 0;
+        m_loadImageEnd = 0;
+        m_createImageTime = 0;
+        m_streamingImageEnd = 0;
+        m_initialImageAssetSize = 0;
+        m_imageAssetSize = 0;
+
+        LoadImages();
+
+        // Pause lua script (automation) until all the images loaded again
+        ScriptRunnerRequestBus::Broadcast(&ScriptRunnerRequests::PauseScriptWithTimeout, 10.0f);
+        m_automationPaused = true;
+    }
+
+    void StreamingImageExampleComponent::IssueImageLoad(uint32_t imageIndex)
+    {
+        ImageToDraw& imageInfo = m_images[imageIndex];
+        imageInfo.m_asset = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::StreamingImageAsset>(imageInfo.m_assetId, AZ::Data::AssetLoadBehavior::PreLoad);
+        AZ::Data::AssetBus::MultiHandler::BusConnect(imageInfo.m_assetId);
+    }
+
     void StreamingImageExampleComponent::QueueForLoad(const AZStd::string& filePath)
     {
         AZ::Data::AssetId imageAssetId;
@@ -627,14 +843,12 @@ namespace AtomSampleViewer
         AZ_Assert(imageAssetId.IsValid(), "Unable to load file %s", filePath.c_str());
         if (imageAssetId.IsValid())
         {
+            // The asset is loaded when the load scheduler issues it
             m_numImageAssetQueued++;
             ImageToDraw img;
-            img.m_asset = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::StreamingImageAsset>(imageAssetId, AZ::Data::AssetLoadBehavior::PreLoad);
             img.m_srg = RPI::ShaderResourceGroup::Create(m_shaderAsset, m_srgLayout->GetName());
             img.m_assetId = imageAssetId;
             m_images.push_back(img);
-
-            AZ::Data::AssetBus::MultiHandler::BusConnect(imageAssetId);
         }
     }
 
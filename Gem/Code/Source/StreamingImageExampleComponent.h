@@ -9,6 +9,7 @@
 #pragma once
 
 #include <CommonSampleComponentBase.h>
+#include <StreamingImageExampleBus.h>
 
 #include <Atom/RHI/IndexBufferView.h>
 #include <Atom/RHI/PipelineState.h>
@@ -22,14 +23,20 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+
+#include <Performance/TextureLoadScheduler.h>
 
 #include <Utils/ImGuiSidebar.h>
+#include <Utils/StreamingImageTelemetry.h>
 
 namespace AtomSampleViewer
 {
     // This AtomSampleViewer example is to test, profile and visualize StreamingImage streaming process as well as 
     // testing the StreamingImage hot reloading function.
     // It starts loading 36 StreamingImageAssets and create the StreamingImages when each asset is ready.
+    // The loads go through a TextureLoadScheduler, which issues them in queue order or by the priority of their place on
+    // screen and limits the loads in flight and the bytes issued per frame.
     // After a StreamingImage is created, it will be drawn on the screen with all the its mips.
     // The mips which are not streamed in are showing are white blocks.
     // When all StreamingImages' mipmaps are streamed in, a profile result would be showing on the screen.
@@ -43,6 +50,7 @@ namespace AtomSampleViewer
         , public AZ::Data::AssetBus::MultiHandler
         , public AZ::TickBus::Handler
         , public AzFramework::AssetCatalogEventBus::Handler
+        , private StreamingImageExampleRequestBus::Handler
     {
     public:
         AZ_COMPONENT(StreamingImageExampleComponent, "{9AF86786-8B14-4C3E-92CD-3152768E417C}", CommonSampleComponentBase);
@@ -87,14 +95,25 @@ namespace AtomSampleViewer
         /// Used to accept image mip chain asset events.
         void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
         void OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
 
         // AssetCatalogEventBus::Handler
         void OnCatalogAssetAdded(const AZ::Data::AssetId& /*assetId*/) override;
         void OnCatalogAssetChanged(const AZ::Data::AssetId& /*assetId*/) override;
 
+        // StreamingImageExampleRequestBus::Handler
+        void RecordResidencyPoint() override;
+        bool WriteStreamingTelemetry(const AZStd::string& filePath) override;
+
+        // Returns the milliseconds since the images were queued, the time base of the telemetry
+        double GetTelemetryTimeMs() const;
+
         // Draw profiling data with Imgui
         void DisplayStreamingProfileData();
 
+        // Draw the load scheduler settings and the time to useful frame of each policy with Imgui
+        void DisplayLoadSchedulerSettings();
+
         // Submit draw packages for each streaming image
         void DrawImages();
 
@@ -119,6 +138,16 @@ namespace AtomSampleViewer
         // Copy the sourceFile and to destFile. If the destFile already exists, overwrite it. 
         bool CopyFile(const AZStd::string& destFile, const AZStd::string& sourceFile);
         void QueueForLoad(const AZStd::string& filePath);
+
+        // Queues all the test images and schedules their loads by the priority of their place on screen
+        void LoadImages();
+        // Releases the test images and loads them again with the current scheduler settings
+        void ReloadImages();
+        // Starts loading the asset of an image, called by the load scheduler
+        void IssueImageLoad(uint32_t imageIndex);
+
+        // Position and size of the mip 0 of an image in the display area
+        void GetImageLayout(size_t imageIndex, AZStd::array<float, 2>& position, AZStd::array<float, 2>& mipSize) const;
         
         //[GFX TODO][ATOM-4040] PAL-ify AtomSampleViewer. We disable m_enableHotReloadTest for following platforms as
         //they dont have access to the root dev folder, only the asset cache folder and the hot reload
@@ -164,6 +193,17 @@ namespace AtomSampleViewer
         AZ::u64 m_initialImageAssetSize = 0;
         // The total size of all the streaming image assets as well as their mipchain assets
         AZ::u64 m_imageAssetSize = 0;
+
+        // Per-image streaming times and pool memory. The images are added in the order of m_images.
+        StreamingImageTelemetry m_telemetry;
+        AZStd::chrono::steady_clock::time_point m_telemetryStart;
+
+        // Orders and throttles the loads of m_images, the request ids are indices into m_images
+        TextureLoadScheduler m_loadScheduler;
+        // The policy the current images were scheduled with and the last time to useful frame measured with each policy
+        TextureLoadScheduler::Policy m_loadPolicy = TextureLoadScheduler::Policy::Prioritized;
+        AZStd::array<double, static_cast<size_t>(TextureLoadScheduler::Policy::Count)> m_timeToUsefulFrameMs = { -1.0, -1.0 };
+        bool m_usefulFrameRecorded = false;
         
         ImGuiSidebar m_imguiSidebar;
 
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/AssetCatalogIndex.h>
+#include <SampleComponentManagerBus.h>
+
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AtomSampleViewer
+{
+    AssetCatalogIndex* AssetCatalogIndex::GetInstance()
+    {
+        static AssetCatalogIndex* s_instance = nullptr;
+        if (!s_instance)
+        {
+            AtomSampleViewer::SampleComponentSingletonRequestBus::BroadcastResult(s_instance, &AtomSampleViewer::SampleComponentSingletonRequestBus::Events::GetAssetCatalogIndexInstance);
+        }
+        return s_instance;
+    }
+
+    AssetCatalogIndex::Scope AssetCatalogIndex::Scope::ForType(const AZ::Data::AssetType& assetType)
+    {
+        Scope scope;
+        scope.m_assetType = assetType;
+        return scope;
+    }
+
+    AssetCatalogIndex::Scope AssetCatalogIndex::Scope::ForExtension(AZStd::string_view extension)
+    {
+        Scope scope;
+        scope.m_extension = extension;
+        AZStd::to_lower(scope.m_extension.begin(), scope.m_extension.end());
+        return scope;
+    }
+
+    AZStd::string AssetCatalogIndex::GetExtension(AZStd::string_view assetPath)
+    {
+        const size_t dotPos = assetPath.find_last_of('.');
+        const size_t slashPos = assetPath.find_last_of("/\\");
+        if (dotPos == AZStd::string_view::npos || (slashPos != AZStd::string_view::npos && dotPos < slashPos))
+        {
+            return {};
+        }
+
+        AZStd::string extension(assetPath.substr(dotPos + 1));
+        AZStd::to_lower(extension.begin(), extension.end());
+        return extension;
+    }
+
+    bool AssetCatalogIndex::PathLess::operator()(const AZ::Data::AssetInfo* lhs, const AZ::Data::AssetInfo* rhs) const
+    {
+        // Products of one source can share a path, the asset id keeps their order stable
+        const int pathOrder = lhs->m_relativePath.compare(rhs->m_relativePath);
+        return pathOrder != 0 ? pathOrder < 0 : lhs->m_assetId < rhs->m_assetId;
+    }
+
+    void AssetCatalogIndex::Activate()
+    {
+        Rebuild();
+        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
+    }
+
+    void AssetCatalogIndex::Deactivate()
+    {
+        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
+        Clear();
+    }
+
+    void AssetCatalogIndex::OnCatalogLoaded([[maybe_unused]] const char* catalogFile)
+    {
+        Rebuild();
+    }
+
+    void AssetCatalogIndex::OnCatalogAssetChanged(const AZ::Data::AssetId& assetId)
+    {
+        UpdateAssetFromCatalog(assetId);
+    }
+
+    void AssetCatalogIndex::OnCatalogAssetAdded(const AZ::Data::AssetId& assetId)
+    {
+        UpdateAssetFromCatalog(assetId);
+    }
+
+    void AssetCatalogIndex::OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo&)
+    {
+        RemoveAsset(assetId);
+    }
+
+    void AssetCatalogIndex::UpdateAssetFromCatalog(const AZ::Data::AssetId& assetId)
+    {
+        AZ::Data::AssetInfo assetInfo;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+        if (assetInfo.m_assetId.IsValid())
+        {
+            AddAsset(assetInfo);
+        }
+        else
+        {
+            RemoveAsset(assetId);
+        }
+    }
+
+    void AssetCatalogIndex::Rebuild()
+    {
+        Clear();
+
+        auto startCB = []() {};
+
+        auto enumerateCB = [this](const AZ::Data::AssetId, const AZ::Data::AssetInfo& assetInfo)
+        {
+            AddAsset(assetInfo);
+        };
+
+        auto endCB = []() {};
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, startCB, enumerateCB, endCB);
+    }
+
+    void AssetCatalogIndex::Clear()
+    {
+        // Buckets stay in the maps with their versions so that browsers see the change
+        ++m_lastVersion;
+        m_allAssets.m_assets.clear();
+        m_allAssets.m_version = m_lastVersion;
+        for (auto& [assetType, bucket] : m_assetsByType)
+        {
+            bucket.m_assets.clear();
+            bucket.m_version = m_lastVersion;
+        }
+        for (auto& [extension, bucket] : m_assetsByExtension)
+        {
+            bucket.m_assets.clear();
+            bucket.m_version = m_lastVersion;
+        }
+        m_assetInfos.clear();
+    }
+
+    void AssetCatalogIndex::AddAsset(const AZ::Data::AssetInfo& assetInfo)
+    {
+        auto existingIter = m_assetInfos.find(assetInfo.m_assetId);
+        if (existingIter != m_assetInfos.end())
+        {
+            const AZ::Data::AssetInfo& existingInfo = existingIter->second;
+            if (existingInfo.m_relativePath == assetInfo.m_relativePath && existingInfo.m_assetType == assetInfo.m_assetType)
+            {
+                existingIter->second.m_sizeBytes = assetInfo.m_sizeBytes;
+                return;
+            }
+            RemoveAsset(assetInfo.m_assetId);
+        }
+
+        const AZ::Data::AssetInfo* storedInfo = &m_assetInfos.emplace(assetInfo.m_assetId, assetInfo).first->second;
+
+        ++m_lastVersion;
+        Bucket* buckets[] = {
+            &m_allAssets,
+            &m_assetsByType[storedInfo->m_assetType],
+            &m_assetsByExtension[GetExtension(storedInfo->m_relativePath)]
+        };
+        for (Bucket* bucket : buckets)
+        {
+            bucket->m_assets.insert(storedInfo);
+            bucket->m_version = m_lastVersion;
+        }
+    }
+
+    void AssetCatalogIndex::RemoveAsset(const AZ::Data::AssetId& assetId)
+    {
+        auto infoIter = m_assetInfos.find(assetId);
+        if (infoIter == m_assetInfos.end())
+        {
+            return;
+        }
+
+        const AZ::Data::AssetInfo* storedInfo = &infoIter->second;
+
+        ++m_lastVersion;
+        Bucket* buckets[] = {
+            &m_allAssets,
+            &m_assetsByType[storedInfo->m_assetType],
+            &m_assetsByExtension[GetExtension(storedInfo->m_relativePath)]
+        };
+        for (Bucket* bucket : buckets)
+        {
+            bucket->m_assets.erase(storedInfo);
+            bucket->m_version = m_lastVersion;
+        }
+
+        m_assetInfos.erase(infoIter);
+    }
+
+    const AssetCatalogIndex::Bucket* AssetCatalogIndex::FindBucket(const Scope& scope) const
+    {
+        if (!scope.m_assetType.IsNull())
+        {
+            auto bucketIter = m_assetsByType.find(scope.m_assetType);
+            return bucketIter != m_assetsByType.end() ? &bucketIter->second : nullptr;
+        }
+        if (!scope.m_extension.empty())
+        {
+            auto bucketIter = m_assetsByExtension.find(scope.m_extension);
+            return bucketIter != m_assetsByExtension.end() ? &bucketIter->second : nullptr;
+        }
+        return &m_allAssets;
+    }
+
+    void AssetCatalogIndex::GetAssets(const Scope& scope, const AssetFilterCallback& shouldInclude, AZStd::vector<Utils::AssetEntry>& assets) const
+    {
+        const Bucket* bucket = FindBucket(scope);
+        if (!bucket)
+        {
+            return;
+        }
+
+        for (const AZ::Data::AssetInfo* assetInfo : bucket->m_assets)
+        {
+            if (!shouldInclude || shouldInclude(*assetInfo))
+            {
+                Utils::AssetEntry entry;
+                entry.m_path = assetInfo->m_relativePath;
+                entry.m_assetId = assetInfo->m_assetId;
+                entry.m_name = assetInfo->m_relativePath;
+
+                assets.push_back(AZStd::move(entry));
+            }
+        }
+    }
+
+    uint64_t AssetCatalogIndex::GetVersion(const Scope& scope) const
+    {
+        const Bucket* bucket = FindBucket(scope);
+        return bucket ? bucket->m_version : 0;
+    }
+} // namespace AtomSampleViewer
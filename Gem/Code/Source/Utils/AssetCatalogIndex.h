@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Utils/Utils.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Asset/AssetCatalogBus.h>
+
+namespace AtomSampleViewer
+{
+    //! A sorted index of the asset catalog, shared by every ImGuiAssetBrowser so they don't each enumerate and sort the
+    //! whole catalog. Entries are kept sorted by path, overall and per asset type and file extension, and catalog events
+    //! insert or remove single entries instead of rebuilding the index.
+    //! Every part of the index has a version that changes with its entries, so browsers only query again when the assets
+    //! they show have changed.
+    //! The index is owned by the SampleComponentManager and is only used from the main thread.
+    class AssetCatalogIndex
+        : public AzFramework::AssetCatalogEventBus::Handler
+    {
+    public:
+        using AssetFilterCallback = AZStd::function<bool(const AZ::Data::AssetInfo& assetInfo)>;
+
+        //! Narrows a query to the assets of one type or with one file extension, so only that part of the index is visited.
+        //! An empty scope visits the whole catalog.
+        struct Scope
+        {
+            static Scope ForType(const AZ::Data::AssetType& assetType);
+            static Scope ForExtension(AZStd::string_view extension);
+
+            AZ::Data::AssetType m_assetType = AZ::Data::AssetType::CreateNull();
+            AZStd::string m_extension; //!< Lower case, without the dot
+        };
+
+        static AssetCatalogIndex* GetInstance();
+
+        //! Returns the lower case extension of an asset path without the dot, or an empty string if it has none.
+        static AZStd::string GetExtension(AZStd::string_view assetPath);
+
+        //! Fills the index from the asset catalog and starts following catalog changes.
+        void Activate();
+        void Deactivate();
+
+        //! Adds an asset or updates an asset that is already in the index.
+        void AddAsset(const AZ::Data::AssetInfo& assetInfo);
+        void RemoveAsset(const AZ::Data::AssetId& assetId);
+        void Clear();
+
+        //! Appends the assets in the scope that pass the filter to the list, sorted by path.
+        void GetAssets(const Scope& scope, const AssetFilterCallback& shouldInclude, AZStd::vector<Utils::AssetEntry>& assets) const;
+
+        //! Returns a number that changes whenever an asset is added to or removed from the scope.
+        uint64_t GetVersion(const Scope& scope) const;
+
+        size_t GetAssetCount() const { return m_assetInfos.size(); }
+
+    private:
+        struct PathLess
+        {
+            bool operator()(const AZ::Data::AssetInfo* lhs, const AZ::Data::AssetInfo* rhs) const;
+        };
+
+        struct Bucket
+        {
+            AZStd::set<const AZ::Data::AssetInfo*, PathLess> m_assets;
+            uint64_t m_version = 0;
+        };
+
+        // AzFramework::AssetCatalogEventBus::Handler overrides...
+        void OnCatalogLoaded(const char* catalogFile) override;
+        void OnCatalogAssetChanged(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo) override;
+
+        void Rebuild();
+        void UpdateAssetFromCatalog(const AZ::Data::AssetId& assetId);
+        const Bucket* FindBucket(const Scope& scope) const;
+
+        //! The asset infos, which the buckets point to. Nodes don't move when the map grows.
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::AssetInfo> m_assetInfos;
+
+        Bucket m_allAssets;
+        AZStd::unordered_map<AZ::Data::AssetType, Bucket> m_assetsByType;
+        AZStd::unordered_map<AZStd::string, Bucket> m_assetsByExtension;
+
+        //! Bumped on every change so that versions of buckets that are created later never repeat an earlier version
+        uint64_t m_lastVersion = 0;
+    };
+} // namespace AtomSampleViewer
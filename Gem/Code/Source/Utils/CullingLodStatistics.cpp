@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/CullingLodStatistics.h>
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    float CullingLodStatistics::EstimateScreenCoverage(const AZ::Vector3& center, float radius, const AZ::Vector3& viewPosition, float yScale)
+    {
+        const float distance = center.GetDistance(viewPosition);
+        if (distance <= radius)
+        {
+            return 1.0f;
+        }
+        return AZ::GetMin(1.0f, yScale * radius / distance);
+    }
+
+    uint32_t CullingLodStatistics::SelectLod(float screenCoverage, uint32_t lodCount, float qualityDecayRate, float minimumScreenCoverage)
+    {
+        if (lodCount == 0 || screenCoverage < minimumScreenCoverage)
+        {
+            return lodCount;
+        }
+
+        // LOD 0 covers the screen down to the decay rate, every following LOD down to the decay rate of the previous one,
+        // and the last LOD everything down to the minimum coverage
+        uint32_t lod = 0;
+        float lodCoverageMin = qualityDecayRate;
+        while (lod + 1 < lodCount && screenCoverage < lodCoverageMin)
+        {
+            ++lod;
+            lodCoverageMin *= qualityDecayRate;
+        }
+        return lod;
+    }
+
+    void CullingLodStatistics::Activate(AZ::RPI::Scene* scene)
+    {
+        m_scene = scene;
+        if (m_scene)
+        {
+            AZ::RPI::CullingDebugContext& debugContext = m_scene->GetCullingScene()->GetDebugContext();
+            m_previousEnableStats = debugContext.m_enableStats;
+            debugContext.m_enableStats = true;
+        }
+        m_frameStats = FrameStats();
+    }
+
+    void CullingLodStatistics::Deactivate()
+    {
+        if (m_scene)
+        {
+            m_scene->GetCullingScene()->GetDebugContext().m_enableStats = m_previousEnableStats;
+            m_scene = nullptr;
+        }
+        m_objects.clear();
+    }
+
+    void CullingLodStatistics::SetObjects(AZStd::vector<Object> objects)
+    {
+        m_objects = AZStd::move(objects);
+    }
+
+    void CullingLodStatistics::Update()
+    {
+        m_frameStats.m_views.clear();
+        m_frameStats.m_objectCount = aznumeric_cast<uint32_t>(m_objects.size());
+        m_frameStats.m_objectsInFrustumCount = 0;
+        m_frameStats.m_lodHistogram = {};
+
+        if (!m_scene)
+        {
+            return;
+        }
+
+        // The culling of the previous frame is complete at this point, and the next one resets the counts when it begins
+        AZ::RPI::CullingScene* cullingScene = m_scene->GetCullingScene();
+        m_frameStats.m_cullableCount = cullingScene->GetNumCullables();
+        {
+            AZ::RPI::CullingDebugContext& debugContext = cullingScene->GetDebugContext();
+            AZStd::lock_guard<AZStd::mutex> lock(debugContext.m_perViewCullStatsMutex);
+            for (const auto& [view, cullStats] : debugContext.m_perViewCullStats)
+            {
+                ViewStats viewStats;
+                viewStats.m_name = cullStats->m_name.GetStringView();
+                viewStats.m_visibleObjectCount = cullStats->m_numVisibleCullables;
+                viewStats.m_visibleDrawPacketCount = cullStats->m_numVisibleDrawPackets;
+                viewStats.m_cullJobCount = cullStats->m_numJobs;
+                viewStats.m_culledObjectCount = m_frameStats.m_cullableCount - AZ::GetMin(m_frameStats.m_cullableCount, viewStats.m_visibleObjectCount);
+                m_frameStats.m_views.push_back(AZStd::move(viewStats));
+            }
+        }
+        AZStd::sort(m_frameStats.m_views.begin(), m_frameStats.m_views.end(), [](const ViewStats& lhs, const ViewStats& rhs)
+            {
+                return lhs.m_name < rhs.m_name;
+            });
+
+        AZ::RPI::RenderPipelinePtr renderPipeline = m_scene->GetDefaultRenderPipeline();
+        AZ::RPI::ViewPtr view = renderPipeline ? renderPipeline->GetDefaultView() : nullptr;
+        if (!view)
+        {
+            return;
+        }
+
+        const AZ::Frustum frustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+        const AZ::Vector3 viewPosition = view->GetCameraTransform().GetTranslation();
+        const float yScale = view->GetViewToClipMatrix().GetElement(1, 1);
+
+        for (const Object& object : m_objects)
+        {
+            if (!AZ::ShapeIntersection::Overlaps(frustum, AZ::Sphere(object.m_center, object.m_radius)))
+            {
+                continue;
+            }
+            ++m_frameStats.m_objectsInFrustumCount;
+
+            const uint32_t lodCount = AZ::GetMin(object.m_lodCount, MaxLodCount);
+            const float screenCoverage = EstimateScreenCoverage(object.m_center, object.m_radius, viewPosition, yScale);
+            const uint32_t lod = SelectLod(screenCoverage, lodCount);
+            ++m_frameStats.m_lodHistogram[lod < lodCount ? lod : MaxLodCount];
+        }
+    }
+
+    void CullingLodStatistics::DrawImGui() const
+    {
+        ImGui::Text("Cullables: %u", m_frameStats.m_cullableCount);
+
+        ImGui::Columns(4);
+        const char* columnNames[] = { "View", "Visible", "Culled", "Jobs" };
+        for (const char* columnName : columnNames)
+        {
+            ImGui::Text("%s", columnName);
+            ImGui::NextColumn();
+        }
+        for (const ViewStats& viewStats : m_frameStats.m_views)
+        {
+            ImGui::Text("%s", viewStats.m_name.c_str());
+            ImGui::NextColumn();
+            ImGui::Text("%u", viewStats.m_visibleObjectCount);
+            ImGui::NextColumn();
+            ImGui::Text("%u", viewStats.m_culledObjectCount);
+            ImGui::NextColumn();
+            ImGui::Text("%u", viewStats.m_cullJobCount);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+
+        ImGui::Spacing();
+        ImGui::Text("Objects in main view: %u / %u", m_frameStats.m_objectsInFrustumCount, m_frameStats.m_objectCount);
+        ImGui::Text("Estimated LODs:");
+        for (uint32_t lod = 0; lod < MaxLodCount; ++lod)
+        {
+            if (m_frameStats.m_lodHistogram[lod] > 0)
+            {
+                ImGui::Text("  LOD %u: %u", lod, m_frameStats.m_lodHistogram[lod]);
+            }
+        }
+        ImGui::Text("  Too small: %u", m_frameStats.m_lodHistogram[MaxLodCount]);
+    }
+} // namespace AtomSampleViewer
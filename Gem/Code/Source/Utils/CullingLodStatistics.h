@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::RPI
+{
+    class Scene;
+}
+
+namespace AtomSampleViewer
+{
+    //! Gathers culling and LOD statistics of a scene once per frame.
+    //! The visible and culled object counts of every view come from the debug context of the scene's culling. The engine
+    //! doesn't report which LOD it picks, so for the objects a sample registers, the LOD is estimated from the main view
+    //! with the default screen coverage scheme, where each LOD is used for half the screen coverage of the previous one.
+    //! The renderer's culling CPU time isn't reported: the culling scene doesn't expose it, and timing the estimate would
+    //! measure the sample rather than the engine.
+    class CullingLodStatistics
+    {
+    public:
+        static constexpr uint32_t MaxLodCount = 8;
+
+        //! Object counts per estimated LOD, the last bucket counts objects in the frustum that are below the minimum coverage
+        using LodHistogram = AZStd::array<uint32_t, MaxLodCount + 1>;
+
+        struct Object
+        {
+            AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+            float m_radius = 0.0f;
+            uint32_t m_lodCount = 1;
+        };
+
+        struct ViewStats
+        {
+            AZStd::string m_name;
+            uint32_t m_visibleObjectCount = 0;
+            uint32_t m_culledObjectCount = 0;
+            uint32_t m_visibleDrawPacketCount = 0;
+            uint32_t m_cullJobCount = 0;
+        };
+
+        struct FrameStats
+        {
+            uint32_t m_cullableCount = 0;           //!< Objects in the culling scene
+            AZStd::vector<ViewStats> m_views;       //!< Sorted by name
+            uint32_t m_objectCount = 0;             //!< Registered objects
+            uint32_t m_objectsInFrustumCount = 0;   //!< Registered objects in the main view's frustum
+            LodHistogram m_lodHistogram = {};
+        };
+
+        //! Default LOD configuration of the mesh feature processor
+        static constexpr float DefaultQualityDecayRate = 0.5f;
+        static constexpr float DefaultMinimumScreenCoverage = 1.0f / 1080.0f;
+
+        //! Returns the fraction of the screen height a sphere covers, 1 if the view is inside it.
+        //! @param yScale the y scale of the view to clip matrix
+        static float EstimateScreenCoverage(const AZ::Vector3& center, float radius, const AZ::Vector3& viewPosition, float yScale);
+
+        //! Returns the LOD used for the screen coverage, or lodCount if the coverage is below the minimum and nothing is drawn.
+        static uint32_t SelectLod(float screenCoverage, uint32_t lodCount,
+            float qualityDecayRate = DefaultQualityDecayRate, float minimumScreenCoverage = DefaultMinimumScreenCoverage);
+
+        //! Turns on the culling statistics of the scene, restoring the previous setting on Deactivate().
+        void Activate(AZ::RPI::Scene* scene);
+        void Deactivate();
+
+        void SetObjects(AZStd::vector<Object> objects);
+
+        //! Gathers the statistics of the most recent frame. Call once per frame.
+        void Update();
+
+        const FrameStats& GetFrameStats() const { return m_frameStats; }
+
+        void DrawImGui() const;
+
+    private:
+        AZ::RPI::Scene* m_scene = nullptr;
+        bool m_previousEnableStats = false;
+        AZStd::vector<Object> m_objects;
+        FrameStats m_frameStats;
+    };
+} // namespace AtomSampleViewer
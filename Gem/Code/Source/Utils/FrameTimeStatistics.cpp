@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/FrameTimeStatistics.h>
+#include <AzCore/std/algorithm.h>
+#include <math.h>
+
+namespace AtomSampleViewer
+{
+    FrameTimeStatistics::QuantileEstimator::QuantileEstimator(double probability)
+        : m_probability(probability)
+    {
+        Reset();
+    }
+
+    void FrameTimeStatistics::QuantileEstimator::Reset()
+    {
+        const double p = m_probability;
+
+        m_count = 0;
+        m_heights = {};
+        m_positions = { 0.0, 1.0, 2.0, 3.0, 4.0 };
+        m_desiredPositions = { 0.0, 2.0 * p, 4.0 * p, 2.0 + 2.0 * p, 4.0 };
+        m_desiredIncrements = { 0.0, p / 2.0, p, (1.0 + p) / 2.0, 1.0 };
+    }
+
+    void FrameTimeStatistics::QuantileEstimator::PushValue(double value)
+    {
+        // The first values initialize the markers directly
+        if (m_count < MarkerCount)
+        {
+            m_heights[m_count++] = value;
+            if (m_count == MarkerCount)
+            {
+                AZStd::sort(m_heights.begin(), m_heights.end());
+            }
+            return;
+        }
+
+        ++m_count;
+
+        // Find the cell that contains the value, extending the outer markers if needed
+        int cell = 0;
+        if (value < m_heights[0])
+        {
+            m_heights[0] = value;
+            cell = 0;
+        }
+        else if (value >= m_heights[MarkerCount - 1])
+        {
+            m_heights[MarkerCount - 1] = value;
+            cell = MarkerCount - 2;
+        }
+        else
+        {
+            cell = 0;
+            while (value >= m_heights[cell + 1])
+            {
+                ++cell;
+            }
+        }
+
+        for (int i = cell + 1; i < MarkerCount; ++i)
+        {
+            m_positions[i] += 1.0;
+        }
+        for (int i = 0; i < MarkerCount; ++i)
+        {
+            m_desiredPositions[i] += m_desiredIncrements[i];
+        }
+
+        // Move the middle markers toward their desired positions, adjusting their heights with a piecewise parabolic fit
+        for (int i = 1; i < MarkerCount - 1; ++i)
+        {
+            const double offset = m_desiredPositions[i] - m_positions[i];
+            if ((offset >= 1.0 && m_positions[i + 1] - m_positions[i] > 1.0) ||
+                (offset <= -1.0 && m_positions[i - 1] - m_positions[i] < -1.0))
+            {
+                const int direction = offset >= 0.0 ? 1 : -1;
+                const double height = Parabolic(i, direction);
+                if (m_heights[i - 1] < height && height < m_heights[i + 1])
+                {
+                    m_heights[i] = height;
+                }
+                else
+                {
+                    m_heights[i] = Linear(i, direction);
+                }
+                m_positions[i] += direction;
+            }
+        }
+    }
+
+    double FrameTimeStatistics::QuantileEstimator::Parabolic(int marker, double direction) const
+    {
+        const double* n = m_positions.data();
+        const double* q = m_heights.data();
+        const int i = marker;
+
+        return q[i] + direction / (n[i + 1] - n[i - 1]) *
+            ((n[i] - n[i - 1] + direction) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+             (n[i + 1] - n[i] - direction) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+    }
+
+    double FrameTimeStatistics::QuantileEstimator::Linear(int marker, int direction) const
+    {
+        return m_heights[marker] + direction * (m_heights[marker + direction] - m_heights[marker]) / (m_positions[marker + direction] - m_positions[marker]);
+    }
+
+    double FrameTimeStatistics::QuantileEstimator::GetEstimate() const
+    {
+        if (m_count == 0)
+        {
+            return 0.0;
+        }
+
+        if (m_count < MarkerCount)
+        {
+            // Not enough values for the markers yet, use the nearest rank of the values seen so far
+            AZStd::array<double, MarkerCount> sorted = m_heights;
+            AZStd::sort(sorted.begin(), sorted.begin() + m_count);
+            const size_t rank = static_cast<size_t>(ceil(m_probability * m_count));
+            return sorted[AZStd::clamp<size_t>(rank, 1, m_count) - 1];
+        }
+
+        return m_heights[2];
+    }
+
+    FrameTimeStatistics::FrameTimeStatistics(float stutterThreshold)
+        : m_quantiles{ QuantileEstimator(0.5), QuantileEstimator(0.9), QuantileEstimator(0.99), QuantileEstimator(0.999) }
+        , m_stutterThreshold(stutterThreshold)
+    {
+    }
+
+    void FrameTimeStatistics::PushValue(float value)
+    {
+        ++m_count;
+
+        if (m_count == 1)
+        {
+            m_minimum = m_maximum = value;
+        }
+        else
+        {
+            m_minimum = AZStd::min(m_minimum, value);
+            m_maximum = AZStd::max(m_maximum, value);
+        }
+
+        const double delta = value - m_mean;
+        m_mean += delta / m_count;
+        m_sumOfSquaredDeviations += delta * (value - m_mean);
+
+        for (QuantileEstimator& quantile : m_quantiles)
+        {
+            quantile.PushValue(value);
+        }
+
+        if (value > m_stutterThreshold)
+        {
+            ++m_stutterCount;
+        }
+    }
+
+    void FrameTimeStatistics::Reset()
+    {
+        for (QuantileEstimator& quantile : m_quantiles)
+        {
+            quantile.Reset();
+        }
+
+        m_count = 0;
+        m_minimum = 0.0f;
+        m_maximum = 0.0f;
+        m_mean = 0.0;
+        m_sumOfSquaredDeviations = 0.0;
+        m_stutterCount = 0;
+    }
+
+    void FrameTimeStatistics::SetStutterThreshold(float stutterThreshold)
+    {
+        if (m_stutterThreshold != stutterThreshold)
+        {
+            m_stutterThreshold = stutterThreshold;
+            m_stutterCount = 0;
+        }
+    }
+
+    double FrameTimeStatistics::GetVariance() const
+    {
+        return m_count > 1 ? m_sumOfSquaredDeviations / (m_count - 1) : 0.0;
+    }
+
+    double FrameTimeStatistics::GetStandardDeviation() const
+    {
+        return sqrt(GetVariance());
+    }
+
+    float FrameTimeStatistics::GetQuantile(Quantile quantile) const
+    {
+        return static_cast<float>(m_quantiles[static_cast<size_t>(quantile)].GetEstimate());
+    }
+} // namespace AtomSampleViewer
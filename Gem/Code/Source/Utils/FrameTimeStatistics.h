@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+
+namespace AtomSampleViewer
+{
+    //! Streaming summary statistics for a series of frame times (or any other per-frame value).
+    //! Every statistic is updated in constant time and memory as values are pushed, so it can summarize runs of millions of frames
+    //! without keeping the values around or sorting them.
+    //! Quantiles are estimated with the P-square algorithm (Jain & Chlamtac, 1985), which tracks five markers per quantile.
+    //! The estimates are exact for fewer than five values and converge as more values are pushed; the extreme quantiles need
+    //! proportionally more values, p99.9 is only meaningful after several thousand frames.
+    class FrameTimeStatistics
+    {
+    public:
+        //! Frame time in milliseconds above which the samples count a frame as a stutter (under 30 fps).
+        static constexpr float DefaultStutterThresholdMs = 1000.0f / 30.0f;
+
+        enum class Quantile
+        {
+            P50,
+            P90,
+            P99,
+            P999,
+            Count
+        };
+
+        //! @param stutterThreshold values above this threshold are counted as stutters
+        explicit FrameTimeStatistics(float stutterThreshold = AZStd::numeric_limits<float>::max());
+
+        void PushValue(float value);
+        void Reset();
+
+        //! Changing the threshold restarts the stutter count, since earlier values can't be re-evaluated.
+        void SetStutterThreshold(float stutterThreshold);
+        float GetStutterThreshold() const { return m_stutterThreshold; }
+
+        uint64_t GetCount() const { return m_count; }
+        float GetMinimum() const { return m_count > 0 ? m_minimum : 0.0f; }
+        float GetMaximum() const { return m_count > 0 ? m_maximum : 0.0f; }
+        double GetMean() const { return m_mean; }
+        double GetVariance() const;
+        double GetStandardDeviation() const;
+
+        float GetQuantile(Quantile quantile) const;
+        float GetMedian() const { return GetQuantile(Quantile::P50); }
+
+        //! Returns the number of values above the stutter threshold.
+        uint64_t GetStutterCount() const { return m_stutterCount; }
+
+    private:
+        //! P-square estimator for a single quantile.
+        class QuantileEstimator
+        {
+        public:
+            explicit QuantileEstimator(double probability);
+
+            void PushValue(double value);
+            void Reset();
+            double GetEstimate() const;
+
+        private:
+            static constexpr int MarkerCount = 5;
+
+            double Parabolic(int marker, double direction) const;
+            double Linear(int marker, int direction) const;
+
+            double m_probability = 0.5;
+            uint64_t m_count = 0;
+            AZStd::array<double, MarkerCount> m_heights = {};
+            AZStd::array<double, MarkerCount> m_positions = {};
+            AZStd::array<double, MarkerCount> m_desiredPositions = {};
+            AZStd::array<double, MarkerCount> m_desiredIncrements = {};
+        };
+
+        AZStd::array<QuantileEstimator, static_cast<size_t>(Quantile::Count)> m_quantiles;
+
+        uint64_t m_count = 0;
+        float m_minimum = 0.0f;
+        float m_maximum = 0.0f;
+        double m_mean = 0.0;
+        double m_sumOfSquaredDeviations = 0.0; //!< Welford's running sum, for a numerically stable variance
+
+        float m_stutterThreshold = AZStd::numeric_limits<float>::max();
+        uint64_t m_stutterCount = 0;
+    };
+} // namespace AtomSampleViewer
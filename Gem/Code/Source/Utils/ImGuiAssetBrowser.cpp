@@ -8,7 +8,6 @@
 
 #include <Utils/ImGuiAssetBrowser.h>
 #include <AzCore/IO/SystemFile.h>
-#include <AzCore/std/sort.h>
 #include <AzCore/Serialization/Utils.h>
 #include <Automation/ScriptableImGui.h>
 
@@ -45,8 +44,6 @@ namespace AtomSampleViewer
         char configFileFullPath[AZ_MAX_PATH_LEN] = {0};
         AZ::IO::FileIOBase::GetInstance()->ResolvePath(m_configFilePath.c_str(), configFileFullPath, AZ_MAX_PATH_LEN);
         m_configFilePath = configFileFullPath;
-
-        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
     }
 
     void ImGuiAssetBrowser::Deactivate()
@@ -59,37 +56,15 @@ namespace AtomSampleViewer
 
             SaveConfigFile();
         }
-
-        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
-    }
-
-    void ImGuiAssetBrowser::OnCatalogAssetAdded(const AZ::Data::AssetId& assetId)
-    {
-        OnCatalogChanged(assetId);
-    }
-        
-    void ImGuiAssetBrowser::OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo&)
-    {
-        OnCatalogChanged(assetId);
     }
 
-    void ImGuiAssetBrowser::OnCatalogChanged(const AZ::Data::AssetId& assetId)
-    {
-        AZ::Data::AssetInfo assetInfo;
-        AZ::Data::AssetCatalogRequestBus::BroadcastResult(assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
-
-        if (m_includedAssetFilter && m_includedAssetFilter(assetInfo))
-        {
-            m_needsRefresh = true;
-        }
-    }
-
-    void ImGuiAssetBrowser::SetFilter(AssetFilterCallback shouldInclude)
+    void ImGuiAssetBrowser::SetFilter(AssetFilterCallback shouldInclude, AssetCatalogIndex::Scope scope)
     {
         m_includedAssetFilter = shouldInclude;
+        m_includedAssetScope = AZStd::move(scope);
     }
 
-    void ImGuiAssetBrowser::PopulateAssets(AZStd::function<bool(const AZ::Data::AssetInfo& assetInfo)> shouldInclude)
+    void ImGuiAssetBrowser::PopulateAssets()
     {
         m_assets.clear();
         m_pinnedAssets.clear();
@@ -98,30 +73,61 @@ namespace AtomSampleViewer
         m_selectedAssetIndex = -1;
         m_selectedPinnedAssetIndex = -1;
 
-        auto startCB = []() {};
+        // The index keeps the assets sorted by path
+        if (AssetCatalogIndex* assetCatalogIndex = AssetCatalogIndex::GetInstance())
+        {
+            assetCatalogIndex->GetAssets(m_includedAssetScope, m_includedAssetFilter, m_assets);
+            m_assetIndexVersion = assetCatalogIndex->GetVersion(m_includedAssetScope);
+        }
+    }
 
-        auto enumerateCB = [this,shouldInclude](const AZ::Data::AssetId id, const AZ::Data::AssetInfo& assetInfo)
+    void ImGuiAssetBrowser::UpdateAssets()
+    {
+        AssetCatalogIndex* assetCatalogIndex = AssetCatalogIndex::GetInstance();
+        if (!assetCatalogIndex)
         {
-            if (shouldInclude(assetInfo))
-            {
-                Utils::AssetEntry entry;
-                entry.m_path = assetInfo.m_relativePath;
-                entry.m_assetId = id;
-                entry.m_name = assetInfo.m_relativePath;
+            return;
+        }
 
-                m_assets.push_back(entry);
-            }
-        };
+        const AZ::Data::AssetId selectedAssetId = GetSelectedAssetId();
+        const AZ::Data::AssetId prevSelectedAssetId = GetPrevSelectedAssetId();
 
-        auto endCB = []() {};
+        m_assets.clear();
+        assetCatalogIndex->GetAssets(m_includedAssetScope, m_includedAssetFilter, m_assets);
+        m_assetIndexVersion = assetCatalogIndex->GetVersion(m_includedAssetScope);
 
-        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::EnumerateAssets, startCB, enumerateCB, endCB);
+        m_selectedAssetIndex = FindAssetIndex(selectedAssetId);
+        m_prevSelectedAssetIndex = FindAssetIndex(prevSelectedAssetId);
 
-        // Sort the assets that we've found alphabetically
+        // Pinned assets that were missing may have been added
+        for (Utils::AssetEntry& entry : m_pinnedAssets)
+        {
+            if (!entry.m_assetId.IsValid())
+            {
+                AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                    entry.m_assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath,
+                    entry.m_path.c_str(), AZ::Data::AssetType(), false);
+                if (entry.m_assetId.IsValid())
+                {
+                    entry.m_name = entry.m_path;
+                }
+            }
+        }
+    }
 
-        AZStd::sort(m_assets.begin(), m_assets.end(), [](const Utils::AssetEntry& lhs, const Utils::AssetEntry& rhs) {
-            return lhs.m_path < rhs.m_path;
-        });
+    int32_t ImGuiAssetBrowser::FindAssetIndex(const AZ::Data::AssetId& assetId) const
+    {
+        if (assetId.IsValid())
+        {
+            for (int32_t i = 0; i < m_assets.size(); ++i)
+            {
+                if (m_assets[i].m_assetId == assetId)
+                {
+                    return i;
+                }
+            }
+        }
+        return -1;
     }
 
     const ImGuiAssetBrowser::AssetList& ImGuiAssetBrowser::GetAssets() const
@@ -285,7 +291,7 @@ namespace AtomSampleViewer
             // Save currently pinned assets so they can be restored if the config file fails to load.
             auto savedPinnedAssets = m_configFile.m_pinnedAssetPaths;
 
-            PopulateAssets(m_includedAssetFilter);
+            PopulateAssets();
 
             if (!LoadConfigFile())
             {
@@ -295,6 +301,11 @@ namespace AtomSampleViewer
 
             m_needsRefresh = false;
         }
+        else if (AssetCatalogIndex* assetCatalogIndex = AssetCatalogIndex::GetInstance();
+            assetCatalogIndex && assetCatalogIndex->GetVersion(m_includedAssetScope) != m_assetIndexVersion)
+        {
+            UpdateAssets();
+        }
 
         bool selectionChanged = false;
 
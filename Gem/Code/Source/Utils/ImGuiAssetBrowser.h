@@ -9,8 +9,8 @@
 #pragma once
 
 #include <Utils/Utils.h>
+#include <Utils/AssetCatalogIndex.h>
 #include <Utils/ImGuiMessageBox.h>
-#include <AzFramework/Asset/AssetCatalogBus.h>
 
 namespace AtomSampleViewer
 {
@@ -23,10 +23,12 @@ namespace AtomSampleViewer
     //! The state of the UI is stored in a local cache file so the layout
     //! and pinned asset list will be preserved between runs.
     //! 
+    //! The available assets come from the shared AssetCatalogIndex, and the list is updated when
+    //! the index reports changes to the assets in the browser's scope.
+    //! 
     //! Note, this has nothing to do with the AzToolsFramework::AssetBrowser;
     //! it's just a very simple way to expose a pick from a list of assets in ImGui.
     class ImGuiAssetBrowser 
-        : public AzFramework::AssetCatalogEventBus::Handler
     {
     public:
         using AssetList = AZStd::vector<Utils::AssetEntry>;
@@ -43,7 +45,7 @@ namespace AtomSampleViewer
             } m_labels;
         };
 
-        using AssetFilterCallback = AZStd::function<bool(const AZ::Data::AssetInfo& assetInfo)>;
+        using AssetFilterCallback = AssetCatalogIndex::AssetFilterCallback;
 
         static void Reflect(AZ::ReflectContext* context);
 
@@ -55,7 +57,8 @@ namespace AtomSampleViewer
 
         //! Set a callback function that will be used to filter which assets should be included in the displayed list.
         //! @param shouldInclude - return true for any asset that should be included in the list
-        void SetFilter(AssetFilterCallback shouldInclude);
+        //! @param scope - the asset type or extension all included assets have, so the filter only visits that part of the catalog
+        void SetFilter(AssetFilterCallback shouldInclude, AssetCatalogIndex::Scope scope = {});
         
         //! Returns whether a config file was loaded. See LoadConfigFile()
         bool IsConfigFileLoaded() const;
@@ -131,13 +134,12 @@ namespace AtomSampleViewer
         //! @return true if successfully loaded
         bool LoadConfigFile();
 
-        void PopulateAssets(AZStd::function<bool(const AZ::Data::AssetInfo& assetInfo)> shouldInclude);
+        void PopulateAssets();
 
-        // AzFramework::AssetCatalogEventBus::Handler overrides...
-        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
-        void OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo) override;
+        //! Queries the available assets again after catalog changes, keeping the selection and resolving missing pins.
+        void UpdateAssets();
 
-        void OnCatalogChanged(const AZ::Data::AssetId& assetId);
+        int32_t FindAssetIndex(const AZ::Data::AssetId& assetId) const;
 
         void UpdateConfigFilePins();
         void SaveConfigFile();
@@ -147,6 +149,8 @@ namespace AtomSampleViewer
         bool m_isConfigFileLoaded = false;
 
         AssetFilterCallback m_includedAssetFilter;
+        AssetCatalogIndex::Scope m_includedAssetScope;
+        uint64_t m_assetIndexVersion = 0;
         bool m_needsRefresh = true;
 
         AZStd::vector<AZStd::string> m_defaultPinnedAssetPaths;
@@ -22,63 +22,103 @@ namespace AtomSampleViewer
         , m_numericDisplayDelay(numericDisplayUpdateDelay)
     {
         AZ_Assert(m_maxSamples >= m_runningAverageSamples, "maxSamples must be larger");
+        AZ_Assert(m_maxSamples > 0, "maxSamples must be at least 1");
 
-        m_valueLog.reserve(m_maxSamples);
-        m_averageLog.reserve(m_maxSamples);
+        m_valueLog.resize(m_maxSamples, 0.0f);
+        m_averageLog.resize(m_maxSamples, 0.0f);
     }
 
-    float ImGuiHistogramQueue::UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue)
+    float ImGuiHistogramQueue::GetRunningAverage() const
     {
-        size_t sampleCount = AZStd::min<size_t>(maxSampleCount, m_valueLog.size());
-        float average = 0.f;
-        if (sampleCount > 0)
+        const size_t sampleCount = AZStd::min<size_t>(m_runningAverageSamples, m_sampleCount);
+        return sampleCount > 0 ? static_cast<float>(m_runningAverageSum / sampleCount) : 0.0f;
+    }
+
+    void ImGuiHistogramQueue::UpdateDisplayedValues()
+    {
+        if (m_sampleCount > 0)
         {
-            average = m_valueLog.at(0);
-            minValue = maxValue = average;
-            for (size_t i = 1; i < sampleCount; ++i)
-            {
-                float curValue = m_valueLog.at(i);
-                average += curValue;
-                minValue = minValue > curValue ? curValue : minValue;
-                maxValue = maxValue < curValue ? curValue : maxValue;
-            }
-            average /= sampleCount;
+            m_displayedAverage = static_cast<float>(m_windowSum / m_sampleCount);
+            m_displayedMinimum = m_windowMinimums.front().m_value;
+            m_displayedMaximum = m_windowMaximums.front().m_value;
         }
-        return average;
     }
 
     void ImGuiHistogramQueue::PushValue(float value)
     {
         m_samplesSinceLastDisplayUpdate++;
 
-        // Update the log of all values
-        if (m_valueLog.size() == m_maxSamples)
+        m_statistics.PushValue(value);
+
+        // Take the values leaving the windows out of the sums before the ring slot is overwritten
+        if (m_sampleCount == m_maxSamples)
+        {
+            m_windowSum -= m_valueLog[m_nextIndex];
+        }
+        if (m_runningAverageSamples > 0 && m_pushCount >= m_runningAverageSamples)
         {
-            m_valueLog.pop_back();
+            const size_t leavingIndex = (m_nextIndex + m_maxSamples - m_runningAverageSamples) % m_maxSamples;
+            m_runningAverageSum -= m_valueLog[leavingIndex];
         }
-        m_valueLog.insert(m_valueLog.begin(), value);
 
-        // Calculate running average for line graph
-        if (m_averageLog.size() == m_maxSamples)
+        const uint64_t pushIndex = m_pushCount++;
+        m_valueLog[m_nextIndex] = value;
+        m_windowSum += value;
+        if (m_runningAverageSamples > 0)
         {
-            m_averageLog.pop_back();
+            m_runningAverageSum += value;
         }
-        [[maybe_unused]] float minValue, maxValue; // unused required call parameters
-        m_averageLog.insert(m_averageLog.begin(), UpdateDisplayedValues(m_runningAverageSamples, minValue, maxValue));
+        m_sampleCount = AZStd::min(m_sampleCount + 1, m_maxSamples);
+
+        // Values that can't be the minimum or maximum anymore while the new value is in the window are dropped from the back,
+        // values that left the window from the front
+        while (!m_windowMinimums.empty() && m_windowMinimums.back().m_value >= value)
+        {
+            m_windowMinimums.pop_back();
+        }
+        m_windowMinimums.push_back({ pushIndex, value });
+        while (!m_windowMaximums.empty() && m_windowMaximums.back().m_value <= value)
+        {
+            m_windowMaximums.pop_back();
+        }
+        m_windowMaximums.push_back({ pushIndex, value });
+        if (pushIndex >= m_maxSamples)
+        {
+            const uint64_t oldestPushIndex = pushIndex - m_maxSamples + 1;
+            if (m_windowMinimums.front().m_pushIndex < oldestPushIndex)
+            {
+                m_windowMinimums.pop_front();
+            }
+            if (m_windowMaximums.front().m_pushIndex < oldestPushIndex)
+            {
+                m_windowMaximums.pop_front();
+            }
+        }
+
+        // Calculate running average for line graph
+        m_averageLog[m_nextIndex] = GetRunningAverage();
+
+        m_nextIndex = (m_nextIndex + 1) % m_maxSamples;
 
         // Calculate average for numeric display
         if (m_timeSinceLastDisplayUpdate >= m_numericDisplayDelay || m_samplesSinceLastDisplayUpdate >= m_maxSamples)
         {
-            m_displayedAverage = UpdateDisplayedValues(m_maxSamples, m_displayedMinimum, m_displayedMaximum);
+            UpdateDisplayedValues();
 
             m_timeSinceLastDisplayUpdate = 0.0f;
             m_samplesSinceLastDisplayUpdate = 0;
         }
     }
 
+    float ImGuiHistogramQueue::GetLoggedValue(void* ring, int index)
+    {
+        const Ring& loggedValues = *static_cast<const Ring*>(ring);
+        return loggedValues.m_values[(loggedValues.m_newest + loggedValues.m_capacity - index) % loggedValues.m_capacity];
+    }
+
     void ImGuiHistogramQueue::Tick(float deltaTime, WidgetSettings settings)
     {
-        if (m_averageLog.empty() || m_valueLog.empty())
+        if (m_sampleCount == 0)
         {
             return;
         }
@@ -97,16 +137,41 @@ namespace AtomSampleViewer
             valueString = AZStd::string::format("avg:%4.2f %s | min:%4.2f %s | max:%4.2f %s ", m_displayedAverage, settings.m_units, m_displayedMinimum, settings.m_units, m_displayedMaximum, settings.m_units);
         }
 
+        const size_t newestIndex = (m_nextIndex + m_maxSamples - 1) % m_maxSamples;
+        Ring averageRing{ m_averageLog.data(), m_maxSamples, newestIndex };
+        Ring valueRing{ m_valueLog.data(), m_maxSamples, newestIndex };
+
         // Draw moving average of values first
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.6, 0.8, 0.9, 1.0));
-        ImGui::PlotLines("##Average", &m_averageLog[0], int32_t(m_averageLog.size()), 0, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotLines("##Average", &GetLoggedValue, &averageRing, int32_t(m_sampleCount), 0, nullptr, 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
         ImGui::PopStyleColor();
 
         // Draw individual value bars on top of it (with no background).
         ImGui::SetCursorPos(pos);
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0, 0, 0, 0));
-        ImGui::PlotHistogram("##Value", &m_valueLog[0], int32_t(m_valueLog.size()), 0, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
+        ImGui::PlotHistogram("##Value", &GetLoggedValue, &valueRing, int32_t(m_sampleCount), 0, valueString.c_str(), 0.0f, m_displayedAverage * 2.0f, ImVec2(400, 50));
         ImGui::PopStyleColor();
+
+        if (settings.m_showStatistics)
+        {
+            DrawStatistics(m_statistics, settings.m_units);
+        }
+    }
+
+    void ImGuiHistogramQueue::DrawStatistics(const FrameTimeStatistics& statistics, const char* units)
+    {
+        using Quantile = FrameTimeStatistics::Quantile;
+
+        ImGui::Text("samples:%llu | mean:%4.2f %s | stddev:%4.2f %s", static_cast<unsigned long long>(statistics.GetCount()),
+            statistics.GetMean(), units, statistics.GetStandardDeviation(), units);
+        ImGui::Text("p50:%4.2f | p90:%4.2f | p99:%4.2f | p99.9:%4.2f %s",
+            statistics.GetQuantile(Quantile::P50), statistics.GetQuantile(Quantile::P90),
+            statistics.GetQuantile(Quantile::P99), statistics.GetQuantile(Quantile::P999), units);
+        if (statistics.GetStutterThreshold() != AZStd::numeric_limits<float>::max())
+        {
+            ImGui::Text("stutters (over %4.2f %s): %llu", statistics.GetStutterThreshold(), units,
+                static_cast<unsigned long long>(statistics.GetStutterCount()));
+        }
     }
 
 } // namespace AtomSampleViewer
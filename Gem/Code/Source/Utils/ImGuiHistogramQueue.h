@@ -8,11 +8,15 @@
 
 #pragma once
 
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/vector.h>
+#include <Utils/FrameTimeStatistics.h>
 
 namespace AtomSampleViewer
 {
     //! Tracks time values over multiple frames, computes the average, and draws a historgram.
+    //! Values are kept in a fixed ring buffer and the window sums, minimum and maximum are updated as values enter and
+    //! leave the window, so pushing a value costs the same no matter how many samples the queue holds.
     class ImGuiHistogramQueue 
     {
     public:
@@ -27,6 +31,7 @@ namespace AtomSampleViewer
         struct WidgetSettings
         {
             bool m_reportInverse = false; //!< Use 1/average instead of average for displaying the numeric value
+            bool m_showStatistics = false; //!< Show quantiles and stutter count for every value pushed since the statistics were reset
             const char* m_units = "";
         };
 
@@ -37,12 +42,56 @@ namespace AtomSampleViewer
         float GetDisplayedMinimum() const { return m_displayedMinimum; }
         float GetDisplayedMaximum() const { return m_displayedMaximum; }
 
+        //! Returns the number of values in the histogram, at most maxSamples.
+        AZStd::size_t GetSampleCount() const { return m_sampleCount; }
+
+        //! Returns the average of the last runningAverageSamples values, as drawn by the running average line.
+        float GetRunningAverage() const;
+
+        //! Returns statistics for all values pushed since the last ResetStatistics(), not just the values in the histogram.
+        const FrameTimeStatistics& GetStatistics() const { return m_statistics; }
+        void ResetStatistics() { m_statistics.Reset(); }
+        void SetStutterThreshold(float stutterThreshold) { m_statistics.SetStutterThreshold(stutterThreshold); }
+
+        //! Draws a summary of the statistics as ImGui text.
+        static void DrawStatistics(const FrameTimeStatistics& statistics, const char* units);
+
     private:
+        //! A value that can still become the minimum or maximum of the window, with the index it was pushed at
+        struct WindowExtreme
+        {
+            uint64_t m_pushIndex = 0;
+            float m_value = 0.0f;
+        };
+
+        //! One of the ring buffers, passed to the ImGui plot getter
+        struct Ring
+        {
+            const float* m_values = nullptr;
+            AZStd::size_t m_capacity = 0;
+            AZStd::size_t m_newest = 0;
+        };
+
+        void UpdateDisplayedValues();
+
+        //! ImGui plot getter that returns the newest value at index 0, like the histogram has always been drawn
+        static float GetLoggedValue(void* ring, int index);
+
+        AZStd::vector<float> m_valueLog;    //!< Ring buffer of the last maxSamples values
+        AZStd::vector<float> m_averageLog;  //!< Ring buffer of the running average at each of those values
+        AZStd::size_t m_nextIndex = 0;      //!< Where the next value goes in both ring buffers
+        AZStd::size_t m_sampleCount = 0;
+        uint64_t m_pushCount = 0;
+
+        // Sums are kept in double so that adding and removing float values doesn't drift over long sessions
+        double m_windowSum = 0.0;           //!< Sum of the values in the ring buffer
+        double m_runningAverageSum = 0.0;   //!< Sum of the last runningAverageSamples values
 
-        float UpdateDisplayedValues(AZStd::size_t maxSampleCount, float& minValue, float& maxValue);
+        // Monotonic queues of the values in the ring buffer, the front is the minimum and maximum respectively
+        AZStd::deque<WindowExtreme> m_windowMinimums;
+        AZStd::deque<WindowExtreme> m_windowMaximums;
 
-        AZStd::vector<float> m_valueLog;
-        AZStd::vector<float> m_averageLog;
+        FrameTimeStatistics m_statistics;
 
         const AZStd::size_t m_maxSamples;
         const AZStd::size_t m_runningAverageSamples;
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/JsonFile.h>
+
+#include <AzCore/IO/SystemFile.h>
+
+namespace AtomSampleViewer
+{
+    namespace Utils
+    {
+        bool WriteFile(const AZStd::string& filePath, const void* data, size_t size)
+        {
+            AZ::IO::SystemFile file;
+            const int openMode = AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH;
+            return file.Open(filePath.c_str(), openMode) && file.Write(data, size) == size;
+        }
+
+        bool WriteJsonFile(const AZStd::string& filePath, const AZStd::function<void(JsonWriter&)>& writeContents)
+        {
+            rapidjson::StringBuffer buffer;
+            JsonWriter writer(buffer);
+            writeContents(writer);
+            return WriteFile(filePath, buffer.GetString(), buffer.GetSize());
+        }
+    } // namespace Utils
+} // namespace AtomSampleViewer
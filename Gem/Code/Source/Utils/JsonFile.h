@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/prettywriter.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    namespace Utils
+    {
+        using JsonWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+
+        //! Writes the data to a file, replacing it if it exists and creating its folder if needed.
+        //! Returns false if the file couldn't be written completely.
+        bool WriteFile(const AZStd::string& filePath, const void* data, size_t size);
+
+        //! Writes the pretty-printed JSON that writeContents produces to a file, see WriteFile().
+        bool WriteJsonFile(const AZStd::string& filePath, const AZStd::function<void(JsonWriter&)>& writeContents);
+    } // namespace Utils
+} // namespace AtomSampleViewer
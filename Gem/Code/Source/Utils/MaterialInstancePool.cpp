@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/MaterialInstancePool.h>
+#include <SampleComponentManagerBus.h>
+
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    MaterialInstancePool* MaterialInstancePool::GetInstance()
+    {
+        static MaterialInstancePool* s_instance = nullptr;
+        if (!s_instance)
+        {
+            AtomSampleViewer::SampleComponentSingletonRequestBus::BroadcastResult(s_instance, &AtomSampleViewer::SampleComponentSingletonRequestBus::Events::GetMaterialInstancePoolInstance);
+        }
+        return s_instance;
+    }
+
+    MaterialInstancePool::~MaterialInstancePool()
+    {
+        AZ_Warning("MaterialInstancePool", m_sharedInstances.GetInstanceCount() == 0 && m_uniqueInstances.empty(),
+            "%zu shared and %zu unique material instances were never released", m_sharedInstances.GetInstanceCount(), m_uniqueInstances.size());
+    }
+
+    AZ::Data::Instance<AZ::RPI::Material> MaterialInstancePool::Acquire(
+        const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides)
+    {
+        PropertyOverrides sortedOverrides = propertyOverrides;
+        SharedInstanceMap::SortOverrides(sortedOverrides);
+
+        if (AZ::Data::Instance<AZ::RPI::Material> material = m_sharedInstances.Acquire(materialAsset.GetId(), sortedOverrides))
+        {
+            ++m_reusedInstanceCount;
+            return material;
+        }
+
+        AZ::Data::Instance<AZ::RPI::Material> material = CreateInstance(materialAsset, sortedOverrides, false);
+        if (!material)
+        {
+            return nullptr;
+        }
+
+        m_sharedInstances.Add(materialAsset.GetId(), AZStd::move(sortedOverrides), material);
+        return material;
+    }
+
+    AZ::Data::Instance<AZ::RPI::Material> MaterialInstancePool::AcquireUnique(
+        const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides)
+    {
+        AZ::Data::Instance<AZ::RPI::Material> material = CreateInstance(materialAsset, propertyOverrides, true);
+        if (material)
+        {
+            m_uniqueInstances[material.get()] = material;
+        }
+        return material;
+    }
+
+    AZ::Data::Instance<AZ::RPI::Material> MaterialInstancePool::CreateInstance(
+        const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides, bool isUnique)
+    {
+        // A shared instance without overrides is the one Material::FindOrCreate() returns, so it's shared with code outside
+        // the pool as well. Overrides are always applied to a new instance.
+        AZ::Data::Instance<AZ::RPI::Material> material = (isUnique || !propertyOverrides.empty())
+            ? AZ::RPI::Material::Create(materialAsset)
+            : AZ::RPI::Material::FindOrCreate(materialAsset);
+        if (!material)
+        {
+            return nullptr;
+        }
+        ++m_createdInstanceCount;
+
+        for (const auto& [propertyName, propertyValue] : propertyOverrides)
+        {
+            AZ::RPI::MaterialPropertyIndex propertyIndex = material->FindPropertyIndex(propertyName);
+            if (propertyIndex.IsValid())
+            {
+                material->SetPropertyValue(propertyIndex, propertyValue);
+            }
+            else
+            {
+                AZ_Error("MaterialInstancePool", false, "Material '%s' has no property '%s'", materialAsset.GetHint().c_str(), propertyName.GetCStr());
+            }
+        }
+
+        if (!propertyOverrides.empty())
+        {
+            Compile(material);
+        }
+
+        return material;
+    }
+
+    void MaterialInstancePool::Release(const AZ::Data::Instance<AZ::RPI::Material>& material)
+    {
+        if (!material)
+        {
+            return;
+        }
+
+        if (m_sharedInstances.Release(material))
+        {
+            return;
+        }
+
+        const size_t erasedCount = m_uniqueInstances.erase(material.get());
+        AZ_Error("MaterialInstancePool", erasedCount == 1, "Released a material instance that didn't come from the pool");
+    }
+
+    bool MaterialInstancePool::IsShared(const AZ::Data::Instance<AZ::RPI::Material>& material) const
+    {
+        return m_sharedInstances.Contains(material);
+    }
+
+    bool MaterialInstancePool::Compile(const AZ::Data::Instance<AZ::RPI::Material>& material)
+    {
+        if (material && material->Compile())
+        {
+            ++m_compilesThisFrame;
+            return true;
+        }
+        return false;
+    }
+
+    void MaterialInstancePool::EndFrame()
+    {
+        m_compilesLastFrame = m_compilesThisFrame;
+        m_compilesThisFrame = 0;
+    }
+
+    size_t MaterialInstancePool::GetApproximateBytes(const AZ::RPI::Material& material)
+    {
+        return sizeof(AZ::RPI::Material) + material.GetPropertyValues().size() * sizeof(AZ::RPI::MaterialPropertyValue);
+    }
+
+    MaterialInstancePool::Stats MaterialInstancePool::GetStats() const
+    {
+        Stats stats;
+        stats.m_sharedInstanceCount = static_cast<uint32_t>(m_sharedInstances.GetInstanceCount());
+        stats.m_uniqueInstanceCount = static_cast<uint32_t>(m_uniqueInstances.size());
+        m_sharedInstances.ForEach([&stats](const AZ::Data::Instance<AZ::RPI::Material>& material, uint32_t referenceCount)
+            {
+                stats.m_sharedReferenceCount += referenceCount;
+                stats.m_approximateBytes += GetApproximateBytes(*material);
+            });
+        for (const auto& [materialPtr, material] : m_uniqueInstances)
+        {
+            stats.m_approximateBytes += GetApproximateBytes(*materialPtr);
+        }
+        stats.m_compilesLastFrame = m_compilesLastFrame;
+        stats.m_createdInstanceCount = m_createdInstanceCount;
+        stats.m_reusedInstanceCount = m_reusedInstanceCount;
+        return stats;
+    }
+
+    void MaterialInstancePool::DrawImGuiStats() const
+    {
+        const Stats stats = GetStats();
+        ImGui::Text("Material Instance Pool");
+        ImGui::Text("Shared: %u instances, %u references", stats.m_sharedInstanceCount, stats.m_sharedReferenceCount);
+        ImGui::Text("Unique: %u instances", stats.m_uniqueInstanceCount);
+        ImGui::Text("Memory: %.1f KiB", stats.m_approximateBytes / 1024.0f);
+        ImGui::Text("Compiles last frame: %u", stats.m_compilesLastFrame);
+        ImGui::Text("Created: %llu, reused: %llu",
+            static_cast<unsigned long long>(stats.m_createdInstanceCount), static_cast<unsigned long long>(stats.m_reusedInstanceCount));
+    }
+} // namespace AtomSampleViewer
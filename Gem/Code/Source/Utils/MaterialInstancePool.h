@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Reflect/Material/MaterialAsset.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertyValue.h>
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/utils.h>
+
+namespace AtomSampleViewer
+{
+    //! Maps a material asset and a set of property overrides to one refcounted instance. This is the bookkeeping of
+    //! MaterialInstancePool, kept apart from the RPI material type so it can be tested without a renderer.
+    template<typename InstanceType>
+    class SharedMaterialInstanceMap
+    {
+    public:
+        using PropertyOverrides = AZStd::vector<AZStd::pair<AZ::Name, AZ::RPI::MaterialPropertyValue>>;
+
+        //! Sorts the overrides by name, so the order they were given in doesn't matter.
+        static void SortOverrides(PropertyOverrides& propertyOverrides)
+        {
+            AZStd::sort(propertyOverrides.begin(), propertyOverrides.end(), [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first.GetStringView() < rhs.first.GetStringView();
+                });
+        }
+
+        //! Returns the instance of the asset with these sorted overrides and adds a reference to it, or null if there is none.
+        InstanceType Acquire(const AZ::Data::AssetId& assetId, const PropertyOverrides& sortedOverrides)
+        {
+            auto keyIter = m_instanceByKey.find(Key{ assetId, sortedOverrides });
+            if (keyIter == m_instanceByKey.end())
+            {
+                return {};
+            }
+
+            Entry& entry = m_entries[keyIter->second];
+            ++entry.m_referenceCount;
+            return entry.m_instance;
+        }
+
+        //! Adds the instance of the asset with these sorted overrides, with one reference.
+        void Add(const AZ::Data::AssetId& assetId, PropertyOverrides sortedOverrides, const InstanceType& instance)
+        {
+            Entry& entry = m_entries[instance.get()];
+            entry.m_key = Key{ assetId, AZStd::move(sortedOverrides) };
+            entry.m_instance = instance;
+            entry.m_referenceCount = 1;
+            m_instanceByKey[entry.m_key] = instance.get();
+        }
+
+        //! Removes a reference, and the instance with its last reference. Returns false if the instance isn't in the map.
+        bool Release(const InstanceType& instance)
+        {
+            auto entryIter = m_entries.find(instance.get());
+            if (entryIter == m_entries.end())
+            {
+                return false;
+            }
+
+            AZ_Assert(entryIter->second.m_referenceCount > 0, "Shared material instance has no references");
+            if (--entryIter->second.m_referenceCount == 0)
+            {
+                m_instanceByKey.erase(entryIter->second.m_key);
+                m_entries.erase(entryIter);
+            }
+            return true;
+        }
+
+        bool Contains(const InstanceType& instance) const
+        {
+            return instance && m_entries.find(instance.get()) != m_entries.end();
+        }
+
+        size_t GetInstanceCount() const { return m_entries.size(); }
+
+        //! Calls visitor(instance, referenceCount) for every instance
+        template<typename Visitor>
+        void ForEach(const Visitor& visitor) const
+        {
+            for (const auto& [instancePtr, entry] : m_entries)
+            {
+                visitor(entry.m_instance, entry.m_referenceCount);
+            }
+        }
+
+    private:
+        using InstancePtr = decltype(AZStd::declval<const InstanceType&>().get());
+
+        struct Key
+        {
+            AZ::Data::AssetId m_assetId;
+            PropertyOverrides m_propertyOverrides;   //!< Sorted by name
+
+            bool operator==(const Key& other) const
+            {
+                return m_assetId == other.m_assetId && m_propertyOverrides == other.m_propertyOverrides;
+            }
+        };
+
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const
+            {
+                // Only the property names are hashed, values are compared when the names match
+                size_t hash = AZStd::hash<AZ::Data::AssetId>()(key.m_assetId);
+                for (const auto& propertyOverride : key.m_propertyOverrides)
+                {
+                    AZStd::hash_combine(hash, propertyOverride.first.GetHash());
+                }
+                return hash;
+            }
+        };
+
+        struct Entry
+        {
+            Key m_key;
+            InstanceType m_instance;
+            uint32_t m_referenceCount = 0;
+        };
+
+        AZStd::unordered_map<Key, InstancePtr, KeyHasher> m_instanceByKey;
+        AZStd::unordered_map<InstancePtr, Entry> m_entries;
+    };
+
+    //! Shares material instances between samples so that entities using the same material asset with the same property
+    //! overrides use one instance, instead of each sample creating and compiling its own copies.
+    //! Shared instances are refcounted by the pool: every Acquire() adds a reference that has to be given back with
+    //! Release(), and the pool drops an instance when its last reference is released. Samples that change material
+    //! properties per entity opt in to instances of their own with AcquireUnique(), which are tracked the same way so
+    //! they show up in the statistics.
+    //! The pool is owned by the SampleComponentManager and is only used from the main thread.
+    class MaterialInstancePool
+    {
+    public:
+        using SharedInstanceMap = SharedMaterialInstanceMap<AZ::Data::Instance<AZ::RPI::Material>>;
+        using PropertyOverrides = SharedInstanceMap::PropertyOverrides;
+
+        struct Stats
+        {
+            uint32_t m_sharedInstanceCount = 0;     //!< Live instances returned by Acquire()
+            uint32_t m_sharedReferenceCount = 0;    //!< Unreleased Acquire() calls across all shared instances
+            uint32_t m_uniqueInstanceCount = 0;     //!< Live instances returned by AcquireUnique()
+            size_t m_approximateBytes = 0;          //!< CPU memory of the live instances and their property values
+            uint32_t m_compilesLastFrame = 0;       //!< Compile() calls that applied changes during the previous frame
+            uint64_t m_createdInstanceCount = 0;    //!< Instances the pool has created or looked up from Material::FindOrCreate()
+            uint64_t m_reusedInstanceCount = 0;     //!< Acquire() calls that returned an existing instance
+        };
+
+        static MaterialInstancePool* GetInstance();
+
+        ~MaterialInstancePool();
+
+        //! Returns the instance shared by everything that uses the material asset with these property overrides, creating it
+        //! on first use. The order of the overrides doesn't matter.
+        AZ::Data::Instance<AZ::RPI::Material> Acquire(
+            const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides = {});
+
+        //! Creates an instance that isn't shared with anything else, for callers that change its properties.
+        AZ::Data::Instance<AZ::RPI::Material> AcquireUnique(
+            const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides = {});
+
+        //! Gives back a reference from Acquire() or AcquireUnique(). Null instances are ignored.
+        void Release(const AZ::Data::Instance<AZ::RPI::Material>& material);
+
+        //! Returns true if the material came from Acquire(), so changing its properties affects every entity that uses it.
+        bool IsShared(const AZ::Data::Instance<AZ::RPI::Material>& material) const;
+
+        //! Compiles the material, counting the compile in the statistics when it applied any changes.
+        bool Compile(const AZ::Data::Instance<AZ::RPI::Material>& material);
+
+        //! Closes the compile count of the current frame. Called once per frame by the SampleComponentManager.
+        void EndFrame();
+
+        Stats GetStats() const;
+
+        void DrawImGuiStats() const;
+
+    private:
+        AZ::Data::Instance<AZ::RPI::Material> CreateInstance(
+            const AZ::Data::Asset<AZ::RPI::MaterialAsset>& materialAsset, const PropertyOverrides& propertyOverrides, bool isUnique);
+
+        static size_t GetApproximateBytes(const AZ::RPI::Material& material);
+
+        SharedInstanceMap m_sharedInstances;
+        AZStd::unordered_map<const AZ::RPI::Material*, AZ::Data::Instance<AZ::RPI::Material>> m_uniqueInstances;
+
+        uint32_t m_compilesThisFrame = 0;
+        uint32_t m_compilesLastFrame = 0;
+        uint64_t m_createdInstanceCount = 0;
+        uint64_t m_reusedInstanceCount = 0;
+    };
+} // namespace AtomSampleViewer
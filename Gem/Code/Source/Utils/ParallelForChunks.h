@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AtomSampleViewer
+{
+    namespace Utils
+    {
+        //! Returns the number of chunks ParallelForChunks() splits count items into.
+        constexpr size_t GetChunkCount(size_t count, size_t chunkSize)
+        {
+            return (count + chunkSize - 1) / chunkSize;
+        }
+
+        //! Calls function(chunkIndex, first, chunkCount) for consecutive chunks of chunkSize items, the last of which may be
+        //! smaller, and returns when all of them are done. The chunks run on jobs when there is more than one, otherwise on the
+        //! calling thread. Nothing is called when count is 0.
+        template<typename Function>
+        void ParallelForChunks(size_t count, size_t chunkSize, const Function& function)
+        {
+            const size_t chunkCount = GetChunkCount(count, chunkSize);
+            if (chunkCount == 0)
+            {
+                return;
+            }
+            if (chunkCount == 1)
+            {
+                function(size_t{ 0 }, size_t{ 0 }, count);
+                return;
+            }
+
+            AZ::JobCompletion completion;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                AZ::Job* chunkJob = AZ::CreateJobFunction([&function, chunk, count, chunkSize]()
+                    {
+                        const size_t first = chunk * chunkSize;
+                        function(chunk, first, AZStd::min(chunkSize, count - first));
+                    }, true);
+                chunkJob->SetDependent(&completion);
+                chunkJob->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+    } // namespace Utils
+} // namespace AtomSampleViewer
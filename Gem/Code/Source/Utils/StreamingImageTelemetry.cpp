@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Utils/StreamingImageTelemetry.h>
+#include <Utils/JsonFile.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+#include <imgui/imgui.h>
+
+namespace AtomSampleViewer
+{
+    namespace
+    {
+        constexpr double BytesPerMB = 1024.0 * 1024.0;
+
+        struct LatencySummary
+        {
+            uint32_t m_count = 0;
+            double m_meanMs = 0.0;
+            double m_maxMs = 0.0;
+        };
+
+        // Summarizes the time from queuing each image to the event, skipping images that didn't get there yet
+        template<typename GetEventMs>
+        LatencySummary SummarizeLatency(const AZStd::vector<StreamingImageTelemetry::ImageTimings>& images, GetEventMs getEventMs)
+        {
+            LatencySummary summary;
+            for (const StreamingImageTelemetry::ImageTimings& image : images)
+            {
+                const double eventMs = getEventMs(image);
+                if (eventMs >= 0.0)
+                {
+                    const double latencyMs = eventMs - image.m_queuedMs;
+                    ++summary.m_count;
+                    summary.m_meanMs += latencyMs;
+                    summary.m_maxMs = AZStd::max(summary.m_maxMs, latencyMs);
+                }
+            }
+            if (summary.m_count > 0)
+            {
+                summary.m_meanMs /= summary.m_count;
+            }
+            return summary;
+        }
+    }
+
+    float StreamingImageTelemetry::GetMipTexelRatio(uint32_t mipLevel)
+    {
+        // Each mip has a quarter of the texels of the one above it
+        return powf(0.25f, static_cast<float>(mipLevel));
+    }
+
+    void StreamingImageTelemetry::Start(double memorySampleIntervalMs)
+    {
+        m_images.clear();
+        m_memorySamples.clear();
+        m_residencyPoints.clear();
+        m_memorySampleIntervalMs = memorySampleIntervalMs;
+    }
+
+    uint32_t StreamingImageTelemetry::AddImage(AZStd::string_view name, double nowMs, float priority)
+    {
+        ImageTimings& image = m_images.emplace_back();
+        image.m_name = name;
+        image.m_queuedMs = nowMs;
+        image.m_priority = priority;
+        return static_cast<uint32_t>(m_images.size() - 1);
+    }
+
+    void StreamingImageTelemetry::OnFirstMipResident(uint32_t imageIndex, double nowMs)
+    {
+        if (imageIndex < m_images.size() && m_images[imageIndex].m_firstMipMs < 0.0)
+        {
+            m_images[imageIndex].m_firstMipMs = nowMs;
+        }
+    }
+
+    void StreamingImageTelemetry::OnFullyResident(uint32_t imageIndex, double nowMs, uint64_t assetBytes)
+    {
+        if (imageIndex < m_images.size() && m_images[imageIndex].m_fullyResidentMs < 0.0)
+        {
+            m_images[imageIndex].m_fullyResidentMs = nowMs;
+            m_images[imageIndex].m_assetBytes = assetBytes;
+        }
+    }
+
+    bool StreamingImageTelemetry::IsFullyResident(uint32_t imageIndex) const
+    {
+        return imageIndex < m_images.size() && m_images[imageIndex].m_fullyResidentMs >= 0.0;
+    }
+
+    void StreamingImageTelemetry::SampleMemory(double nowMs, uint64_t usedBytes, uint64_t allocatedBytes)
+    {
+        if (m_memorySamples.size() >= MaxMemorySampleCount)
+        {
+            return;
+        }
+        if (!m_memorySamples.empty() && nowMs - m_memorySamples.back().m_timeMs < m_memorySampleIntervalMs)
+        {
+            return;
+        }
+        m_memorySamples.push_back({ nowMs, usedBytes, allocatedBytes });
+    }
+
+    void StreamingImageTelemetry::AddResidencyPoint(const ResidencyPoint& point)
+    {
+        m_residencyPoints.push_back(point);
+    }
+
+    double StreamingImageTelemetry::GetStreamingDurationMs() const
+    {
+        double durationMs = 0.0;
+        for (const ImageTimings& image : m_images)
+        {
+            durationMs = AZStd::max(durationMs, image.m_fullyResidentMs);
+        }
+        return durationMs;
+    }
+
+    double StreamingImageTelemetry::GetThroughputMBps() const
+    {
+        uint64_t streamedBytes = 0;
+        for (const ImageTimings& image : m_images)
+        {
+            streamedBytes += image.m_assetBytes;
+        }
+
+        const double durationMs = GetStreamingDurationMs();
+        return durationMs > 0.0 ? (streamedBytes / BytesPerMB) / (durationMs / 1000.0) : 0.0;
+    }
+
+    double StreamingImageTelemetry::GetTimeToUsefulFrameMs(float priorityFraction) const
+    {
+        AZStd::vector<const ImageTimings*> visibleImages;
+        double totalPriority = 0.0;
+        for (const ImageTimings& image : m_images)
+        {
+            totalPriority += image.m_priority;
+            if (image.m_firstMipMs >= 0.0)
+            {
+                visibleImages.push_back(&image);
+            }
+        }
+
+        AZStd::sort(visibleImages.begin(), visibleImages.end(), [](const ImageTimings* lhs, const ImageTimings* rhs)
+            {
+                return lhs->m_firstMipMs < rhs->m_firstMipMs;
+            });
+
+        const double usefulPriority = totalPriority * priorityFraction;
+        double visiblePriority = 0.0;
+        for (const ImageTimings* image : visibleImages)
+        {
+            visiblePriority += image->m_priority;
+            if (visiblePriority >= usefulPriority)
+            {
+                return image->m_firstMipMs;
+            }
+        }
+        return -1.0;
+    }
+
+    bool StreamingImageTelemetry::WriteJson(const AZStd::string& filePath) const
+    {
+        return Utils::WriteJsonFile(filePath, [&](Utils::JsonWriter& writer)
+            {
+                writer.StartObject();
+                writer.Key("streamingDurationMs");
+                writer.Double(GetStreamingDurationMs());
+                writer.Key("throughputMBps");
+                writer.Double(GetThroughputMBps());
+                writer.Key("timeToUsefulFrameMs");
+                writer.Double(GetTimeToUsefulFrameMs());
+
+                writer.Key("images");
+                writer.StartArray();
+                for (const ImageTimings& image : m_images)
+                {
+                    writer.StartObject();
+                    writer.Key("name");
+                    writer.String(image.m_name.c_str());
+                    writer.Key("queuedMs");
+                    writer.Double(image.m_queuedMs);
+                    writer.Key("priority");
+                    writer.Double(image.m_priority);
+                    // Images that didn't get there are written as null
+                    for (const auto& [key, eventMs] : { AZStd::pair{ "timeToFirstMipMs", image.m_firstMipMs }, AZStd::pair{ "timeToFullyResidentMs", image.m_fullyResidentMs } })
+                    {
+                        writer.Key(key);
+                        if (eventMs >= 0.0)
+                        {
+                            writer.Double(eventMs - image.m_queuedMs);
+                        }
+                        else
+                        {
+                            writer.Null();
+                        }
+                    }
+                    writer.Key("assetBytes");
+                    writer.Uint64(image.m_assetBytes);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+
+                writer.Key("poolMemory");
+                writer.StartArray();
+                for (const MemorySample& sample : m_memorySamples)
+                {
+                    writer.StartObject();
+                    writer.Key("timeMs");
+                    writer.Double(sample.m_timeMs);
+                    writer.Key("usedBytes");
+                    writer.Uint64(sample.m_usedBytes);
+                    writer.Key("allocatedBytes");
+                    writer.Uint64(sample.m_allocatedBytes);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+
+                writer.Key("residencyCurve");
+                writer.StartArray();
+                for (const ResidencyPoint& point : m_residencyPoints)
+                {
+                    writer.StartObject();
+                    writer.Key("mipBias");
+                    writer.Int(point.m_mipBias);
+                    writer.Key("images");
+                    writer.Uint(point.m_imageCount);
+                    writer.Key("streamedImages");
+                    writer.Uint(point.m_streamedImageCount);
+                    writer.Key("meanResidentMip");
+                    writer.Double(point.m_meanResidentMip);
+                    writer.Key("residentTexelRatio");
+                    writer.Double(point.m_residentTexelRatio);
+                    writer.Key("usedBytes");
+                    writer.Uint64(point.m_usedBytes);
+                    writer.Key("allocatedBytes");
+                    writer.Uint64(point.m_allocatedBytes);
+                    writer.EndObject();
+                }
+                writer.EndArray();
+                writer.EndObject();
+            });
+    }
+
+    void StreamingImageTelemetry::DrawImGui() const
+    {
+        const LatencySummary firstMip = SummarizeLatency(m_images, [](const ImageTimings& image) { return image.m_firstMipMs; });
+        const LatencySummary fullyResident = SummarizeLatency(m_images, [](const ImageTimings& image) { return image.m_fullyResidentMs; });
+
+        ImGui::Text("Streaming Telemetry");
+        ImGui::Indent();
+        ImGui::Text("First mip: %u/%zu, mean %.1f ms, max %.1f ms", firstMip.m_count, m_images.size(), firstMip.m_meanMs, firstMip.m_maxMs);
+        ImGui::Text("Fully resident: %u/%zu, mean %.1f ms, max %.1f ms", fullyResident.m_count, m_images.size(), fullyResident.m_meanMs, fullyResident.m_maxMs);
+        ImGui::Text("Throughput: %.2f MB/s", GetThroughputMBps());
+        const double timeToUsefulFrameMs = GetTimeToUsefulFrameMs();
+        if (timeToUsefulFrameMs >= 0.0)
+        {
+            ImGui::Text("Time to useful frame: %.1f ms", timeToUsefulFrameMs);
+        }
+        else
+        {
+            ImGui::Text("Time to useful frame: loading");
+        }
+
+        if (!m_memorySamples.empty())
+        {
+            ImGui::Text("Used pool memory: %.1f MB", m_memorySamples.back().m_usedBytes / BytesPerMB);
+            ImGui::PlotLines("##PoolMemory",
+                [](void* data, int index)
+                {
+                    const MemorySample* samples = static_cast<const MemorySample*>(data);
+                    return static_cast<float>(samples[index].m_usedBytes / BytesPerMB);
+                },
+                const_cast<MemorySample*>(m_memorySamples.data()), static_cast<int>(m_memorySamples.size()), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+        }
+
+        if (!m_residencyPoints.empty())
+        {
+            ImGui::Text("Residency curve");
+            for (const ResidencyPoint& point : m_residencyPoints)
+            {
+                ImGui::Text("Bias %d: %.1f%% texels, %.1f MB", point.m_mipBias, point.m_residentTexelRatio * 100.0f, point.m_usedBytes / BytesPerMB);
+            }
+        }
+        ImGui::Unindent();
+    }
+} // namespace AtomSampleViewer
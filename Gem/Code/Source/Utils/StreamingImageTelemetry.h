@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AtomSampleViewer
+{
+    //! Records how streaming images become resident: when each image got its first mips and when it was fully streamed,
+    //! the memory of the streaming pool over time and the resulting throughput. It also collects residency points, the
+    //! residency and pool memory at a given mip bias, which a sweep over mip biases turns into a residency-vs-memory curve.
+    //! Times are in milliseconds since Start() and are supplied by the caller.
+    class StreamingImageTelemetry
+    {
+    public:
+        static constexpr double DefaultMemorySampleIntervalMs = 100.0;
+        static constexpr size_t MaxMemorySampleCount = 6000;
+        //! Share of the total image priority that has to be visible for a frame to count as useful
+        static constexpr float UsefulFramePriorityFraction = 0.8f;
+
+        struct ImageTimings
+        {
+            AZStd::string m_name;
+            double m_queuedMs = 0.0;
+            float m_priority = 1.0f;            //!< How much the image matters to the frame, relative to the other images
+            double m_firstMipMs = -1.0;         //!< The image was created with its tail mips resident, negative until then
+            double m_fullyResidentMs = -1.0;    //!< The image reached its target mip for the first time, negative until then
+            uint64_t m_assetBytes = 0;          //!< The image asset and its mip chain assets, known once fully resident
+        };
+
+        struct MemorySample
+        {
+            double m_timeMs = 0.0;
+            uint64_t m_usedBytes = 0;
+            uint64_t m_allocatedBytes = 0;
+        };
+
+        struct ResidencyPoint
+        {
+            int32_t m_mipBias = 0;
+            uint32_t m_imageCount = 0;
+            uint32_t m_streamedImageCount = 0;  //!< Images at their target mip
+            float m_meanResidentMip = 0.0f;
+            float m_residentTexelRatio = 0.0f;  //!< Resident texels over the texels of every mip 0
+            uint64_t m_usedBytes = 0;
+            uint64_t m_allocatedBytes = 0;
+        };
+
+        //! Returns the texels of a mip relative to the texels of mip 0 of a 2D image.
+        static float GetMipTexelRatio(uint32_t mipLevel);
+
+        //! Clears everything that was recorded.
+        void Start(double memorySampleIntervalMs = DefaultMemorySampleIntervalMs);
+
+        //! Returns the index used to report the other events of the image.
+        uint32_t AddImage(AZStd::string_view name, double nowMs, float priority = 1.0f);
+        void OnFirstMipResident(uint32_t imageIndex, double nowMs);
+        //! Only the first call for each image is recorded, later calls after a mip bias change are ignored.
+        void OnFullyResident(uint32_t imageIndex, double nowMs, uint64_t assetBytes);
+        bool IsFullyResident(uint32_t imageIndex) const;
+
+        //! Records the pool memory if the sample interval has passed since the last sample, up to MaxMemorySampleCount samples.
+        void SampleMemory(double nowMs, uint64_t usedBytes, uint64_t allocatedBytes);
+
+        void AddResidencyPoint(const ResidencyPoint& point);
+
+        const AZStd::vector<ImageTimings>& GetImages() const { return m_images; }
+        const AZStd::vector<MemorySample>& GetMemorySamples() const { return m_memorySamples; }
+        const AZStd::vector<ResidencyPoint>& GetResidencyPoints() const { return m_residencyPoints; }
+
+        //! Returns the time from Start() until the last image that is fully resident became resident.
+        double GetStreamingDurationMs() const;
+        //! Returns the asset bytes of the fully resident images over the streaming duration, in MB per second.
+        double GetThroughputMBps() const;
+        //! Returns the time at which the images with their first mip resident first held the given fraction of the total
+        //! priority, the first frame that shows most of what matters. Returns a negative value if that didn't happen yet.
+        double GetTimeToUsefulFrameMs(float priorityFraction = UsefulFramePriorityFraction) const;
+
+        //! Writes the image timings, memory samples, throughput and residency points to a JSON file.
+        bool WriteJson(const AZStd::string& filePath) const;
+
+        void DrawImGui() const;
+
+    private:
+        AZStd::vector<ImageTimings> m_images;
+        AZStd::vector<MemorySample> m_memorySamples;
+        AZStd::vector<ResidencyPoint> m_residencyPoints;
+        double m_memorySampleIntervalMs = DefaultMemorySampleIntervalMs;
+    };
+} // namespace AtomSampleViewer
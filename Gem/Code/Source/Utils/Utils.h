@@ -74,6 +74,9 @@ namespace AtomSampleViewer
         AZStd::string GetDefaultDiffToolPath_Impl();
         bool RunDiffTool_Impl(const AZStd::string& diffToolPath, const AZStd::string& filePathA, const AZStd::string& filePathB);
 
+        //! Returns the resident memory of this process in bytes, or 0 where the platform doesn't report it. Customized per platform.
+        uint64_t GetProcessResidentMemoryBytes();
+
         AZ::Data::Instance<AZ::RPI::StreamingImage> GetSolidColorCubemap(uint32_t color);
 
         //! Provides a more convenient way to call AZ::IO::FileIOBase::GetInstance()->ResolvePath()
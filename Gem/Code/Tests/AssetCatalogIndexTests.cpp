@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/AssetCatalogIndex.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    static const AZ::Data::AssetType MaterialType("{522C7BE0-501D-463E-92C6-15184A2B7AD8}");
+    static const AZ::Data::AssetType ModelType("{2C7477B6-69C5-45BE-8163-BCD6A275B6D8}");
+
+    static AZ::Data::AssetInfo CreateAssetInfo(const char* path, const AZ::Data::AssetType& assetType, AZ::u32 subId = 0)
+    {
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateName(path), subId);
+        assetInfo.m_assetType = assetType;
+        assetInfo.m_relativePath = path;
+        return assetInfo;
+    }
+
+    static AZStd::vector<AZStd::string> GetPaths(const AssetCatalogIndex& index, const AssetCatalogIndex::Scope& scope,
+        const AssetCatalogIndex::AssetFilterCallback& shouldInclude = {})
+    {
+        AZStd::vector<Utils::AssetEntry> assets;
+        index.GetAssets(scope, shouldInclude, assets);
+        AZStd::vector<AZStd::string> paths;
+        for (const Utils::AssetEntry& entry : assets)
+        {
+            paths.push_back(entry.m_path);
+        }
+        return paths;
+    }
+
+    TEST(AssetCatalogIndexTest, GetExtension_ReturnsLowerCaseExtension)
+    {
+        EXPECT_EQ("azmaterial", AssetCatalogIndex::GetExtension("materials/DefaultPBR.AzMaterial"));
+        EXPECT_EQ("luac", AssetCatalogIndex::GetExtension("scripts/mesh.bv.luac"));
+        EXPECT_EQ("", AssetCatalogIndex::GetExtension("folder.name/file"));
+        EXPECT_EQ("", AssetCatalogIndex::GetExtension("file"));
+    }
+
+    TEST(AssetCatalogIndexTest, AddAsset_KeepsScopesSortedByPath)
+    {
+        AssetCatalogIndex index;
+        index.AddAsset(CreateAssetInfo("objects/sphere.fbx.azmodel", ModelType));
+        index.AddAsset(CreateAssetInfo("materials/b.azmaterial", MaterialType));
+        index.AddAsset(CreateAssetInfo("materials/a.azmaterial", MaterialType));
+        index.AddAsset(CreateAssetInfo("objects/cube.fbx.azmodel", ModelType));
+
+        EXPECT_EQ(4u, index.GetAssetCount());
+        const AZStd::vector<AZStd::string> all = GetPaths(index, {});
+        ASSERT_EQ(4u, all.size());
+        EXPECT_EQ("materials/a.azmaterial", all[0]);
+        EXPECT_EQ("objects/sphere.fbx.azmodel", all[3]);
+
+        const AZStd::vector<AZStd::string> models = GetPaths(index, AssetCatalogIndex::Scope::ForType(ModelType));
+        ASSERT_EQ(2u, models.size());
+        EXPECT_EQ("objects/cube.fbx.azmodel", models[0]);
+        EXPECT_EQ("objects/sphere.fbx.azmodel", models[1]);
+
+        const AZStd::vector<AZStd::string> materials = GetPaths(index, AssetCatalogIndex::Scope::ForExtension("AZMATERIAL"));
+        ASSERT_EQ(2u, materials.size());
+        EXPECT_EQ("materials/a.azmaterial", materials[0]);
+
+        const AZStd::vector<AZStd::string> filtered = GetPaths(index, AssetCatalogIndex::Scope::ForType(MaterialType),
+            [](const AZ::Data::AssetInfo& assetInfo) { return assetInfo.m_relativePath != "materials/a.azmaterial"; });
+        ASSERT_EQ(1u, filtered.size());
+        EXPECT_EQ("materials/b.azmaterial", filtered[0]);
+
+        EXPECT_TRUE(GetPaths(index, AssetCatalogIndex::Scope::ForExtension("streamingimage")).empty());
+    }
+
+    TEST(AssetCatalogIndexTest, RemoveAsset_OnlyChangesVersionOfItsScopes)
+    {
+        AssetCatalogIndex index;
+        const AZ::Data::AssetInfo material = CreateAssetInfo("materials/a.azmaterial", MaterialType);
+        index.AddAsset(material);
+        index.AddAsset(CreateAssetInfo("objects/cube.fbx.azmodel", ModelType));
+
+        const AssetCatalogIndex::Scope materialScope = AssetCatalogIndex::Scope::ForType(MaterialType);
+        const AssetCatalogIndex::Scope modelScope = AssetCatalogIndex::Scope::ForType(ModelType);
+        const uint64_t materialVersion = index.GetVersion(materialScope);
+        const uint64_t modelVersion = index.GetVersion(modelScope);
+        const uint64_t allVersion = index.GetVersion({});
+
+        index.RemoveAsset(material.m_assetId);
+        EXPECT_NE(materialVersion, index.GetVersion(materialScope));
+        EXPECT_NE(allVersion, index.GetVersion({}));
+        EXPECT_EQ(modelVersion, index.GetVersion(modelScope));
+        EXPECT_TRUE(GetPaths(index, materialScope).empty());
+        EXPECT_EQ(1u, index.GetAssetCount());
+
+        // Removing an unknown asset changes nothing
+        const uint64_t versionAfterRemove = index.GetVersion({});
+        index.RemoveAsset(material.m_assetId);
+        EXPECT_EQ(versionAfterRemove, index.GetVersion({}));
+    }
+
+    TEST(AssetCatalogIndexTest, AddAsset_ChangedPath_MovesEntry)
+    {
+        AssetCatalogIndex index;
+        AZ::Data::AssetInfo asset = CreateAssetInfo("textures/a.png.streamingimage", AZ::Data::AssetType::CreateNull());
+        index.AddAsset(asset);
+        index.AddAsset(CreateAssetInfo("textures/m.png.streamingimage", AZ::Data::AssetType::CreateNull()));
+
+        asset.m_relativePath = "textures/z.png.streamingimage";
+        index.AddAsset(asset);
+
+        const AZStd::vector<AZStd::string> paths = GetPaths(index, AssetCatalogIndex::Scope::ForExtension("streamingimage"));
+        ASSERT_EQ(2u, paths.size());
+        EXPECT_EQ("textures/m.png.streamingimage", paths[0]);
+        EXPECT_EQ("textures/z.png.streamingimage", paths[1]);
+        EXPECT_EQ(2u, index.GetAssetCount());
+    }
+} // namespace UnitTest
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Performance/AssetSwapScheduler.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(AssetSwapSchedulerTest, Update_AllAtOnce_SwapsEveryItemInOneFrame)
+    {
+        AZStd::vector<size_t> swappedItems;
+        AssetSwapScheduler scheduler;
+        scheduler.SetStrategy(AssetSwapScheduler::Strategy::AllAtOnce);
+        scheduler.Begin(5);
+
+        EXPECT_TRUE(scheduler.Update([&](size_t itemIndex) { swappedItems.push_back(itemIndex); }));
+        EXPECT_FALSE(scheduler.IsSwitching());
+        ASSERT_EQ(5u, swappedItems.size());
+        for (size_t i = 0; i < swappedItems.size(); ++i)
+        {
+            EXPECT_EQ(i, swappedItems[i]);
+        }
+
+        const AssetSwapScheduler::Statistics& statistics = scheduler.GetStatistics(AssetSwapScheduler::Strategy::AllAtOnce);
+        EXPECT_EQ(1u, statistics.m_completedSwitchCount);
+        EXPECT_EQ(1u, statistics.m_lastSwitchFrameCount);
+        EXPECT_EQ(1u, statistics.m_frameCostMs.GetCount());
+        EXPECT_EQ(0u, scheduler.GetStatistics(AssetSwapScheduler::Strategy::Amortized).m_completedSwitchCount);
+    }
+
+    TEST(AssetSwapSchedulerTest, Update_AmortizedWithoutBudget_SwapsOneItemPerFrame)
+    {
+        size_t swapCount = 0;
+        AssetSwapScheduler scheduler;
+        scheduler.SetStrategy(AssetSwapScheduler::Strategy::Amortized);
+        scheduler.SetFrameBudgetMs(0.0f);
+        scheduler.Begin(3);
+
+        EXPECT_FALSE(scheduler.Update([&](size_t) { ++swapCount; }));
+        EXPECT_EQ(1u, swapCount);
+        EXPECT_EQ(2u, scheduler.GetPendingCount());
+        EXPECT_FALSE(scheduler.Update([&](size_t) { ++swapCount; }));
+        EXPECT_TRUE(scheduler.Update([&](size_t) { ++swapCount; }));
+        EXPECT_EQ(3u, swapCount);
+
+        // Nothing is left to swap, so further frames don't do any work or add statistics
+        EXPECT_FALSE(scheduler.Update([&](size_t) { ++swapCount; }));
+        EXPECT_EQ(3u, swapCount);
+
+        const AssetSwapScheduler::Statistics& statistics = scheduler.GetStatistics(AssetSwapScheduler::Strategy::Amortized);
+        EXPECT_EQ(1u, statistics.m_completedSwitchCount);
+        EXPECT_EQ(3u, statistics.m_lastSwitchFrameCount);
+        EXPECT_EQ(3u, statistics.m_frameCostMs.GetCount());
+    }
+
+    TEST(AssetSwapSchedulerTest, Begin_DuringSwitch_RestartsFromFirstItem)
+    {
+        AZStd::vector<size_t> swappedItems;
+        AssetSwapScheduler scheduler;
+        scheduler.SetFrameBudgetMs(0.0f);
+        scheduler.Begin(4);
+        scheduler.Update([&](size_t itemIndex) { swappedItems.push_back(itemIndex); });
+
+        scheduler.Begin(2);
+        EXPECT_EQ(2u, scheduler.GetPendingCount());
+        scheduler.Update([&](size_t itemIndex) { swappedItems.push_back(itemIndex); });
+        ASSERT_EQ(2u, swappedItems.size());
+        EXPECT_EQ(0u, swappedItems[1]);
+    }
+
+    TEST(AssetSwapSchedulerTest, Cancel_DropsPendingItems)
+    {
+        size_t swapCount = 0;
+        AssetSwapScheduler scheduler;
+        scheduler.SetFrameBudgetMs(0.0f);
+        scheduler.Begin(4);
+        scheduler.Update([&](size_t) { ++swapCount; });
+
+        scheduler.Cancel();
+        EXPECT_FALSE(scheduler.IsSwitching());
+        EXPECT_EQ(0u, scheduler.GetPendingCount());
+        EXPECT_FALSE(scheduler.Update([&](size_t) { ++swapCount; }));
+        EXPECT_EQ(1u, swapCount);
+        EXPECT_EQ(0u, scheduler.GetStatistics(AssetSwapScheduler::Strategy::Amortized).m_completedSwitchCount);
+
+        scheduler.ResetStatistics();
+        EXPECT_EQ(0u, scheduler.GetStatistics(AssetSwapScheduler::Strategy::Amortized).m_frameCostMs.GetCount());
+    }
+} // namespace UnitTest
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Automation/BenchmarkComparison.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    namespace
+    {
+        // Deterministic, noisy frame times around the given median
+        AZStd::vector<double> MakeFrameTimes(double median, size_t count, uint32_t seed)
+        {
+            AZStd::vector<double> values;
+            values.reserve(count);
+            uint32_t state = seed;
+            for (size_t i = 0; i < count; ++i)
+            {
+                state = state * 1664525u + 1013904223u;
+                const double noise = ((state >> 8) / double(1 << 24)) - 0.5;
+                values.push_back(median * (1.0 + noise * 0.04));
+            }
+            return values;
+        }
+    } // namespace
+
+    TEST(BenchmarkComparisonTest, MannWhitney_SeparatedSamplesAreSignificant)
+    {
+        const double baseline[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        const double candidate[] = { 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+
+        const BenchmarkComparison::MannWhitneyResult result = BenchmarkComparison::MannWhitneyUTest(baseline, candidate);
+        EXPECT_DOUBLE_EQ(result.m_u, 0.0);
+        EXPECT_LT(result.m_z, -3.7);
+        EXPECT_NEAR(result.m_pValue, 1.83e-4, 1e-5);
+    }
+
+    TEST(BenchmarkComparisonTest, MannWhitney_IdenticalSamplesAreNotSignificant)
+    {
+        const double values[] = { 4, 4, 4, 5, 5, 6 };
+
+        EXPECT_DOUBLE_EQ(BenchmarkComparison::MannWhitneyUTest(values, values).m_pValue, 1.0);
+    }
+
+    TEST(BenchmarkComparisonTest, CompareSeries_DetectsRegressionAndImprovement)
+    {
+        const BenchmarkComparison::Settings settings;
+        const AZStd::vector<double> baseline = MakeFrameTimes(10.0, 100, 1);
+
+        const auto same = BenchmarkComparison::CompareSeries("Same", baseline, MakeFrameTimes(10.0, 100, 2), settings);
+        EXPECT_EQ(same.m_verdict, BenchmarkComparison::Verdict::Unchanged);
+        EXPECT_LT(same.m_medianRatio.m_lower, 1.0);
+        EXPECT_GT(same.m_medianRatio.m_upper, 1.0);
+
+        const auto slower = BenchmarkComparison::CompareSeries("Slower", baseline, MakeFrameTimes(11.0, 100, 3), settings);
+        EXPECT_EQ(slower.m_verdict, BenchmarkComparison::Verdict::Regressed);
+        EXPECT_NEAR(slower.m_medianRatio.m_estimate, 1.1, 0.01);
+
+        const auto faster = BenchmarkComparison::CompareSeries("Faster", baseline, MakeFrameTimes(9.0, 100, 4), settings);
+        EXPECT_EQ(faster.m_verdict, BenchmarkComparison::Verdict::Improved);
+
+        // Significant but smaller than the minimum relative change
+        const auto slightlySlower = BenchmarkComparison::CompareSeries("SlightlySlower", baseline, MakeFrameTimes(10.2, 100, 5), settings);
+        EXPECT_EQ(slightlySlower.m_verdict, BenchmarkComparison::Verdict::Unchanged);
+
+        const auto tooFew = BenchmarkComparison::CompareSeries("TooFew", baseline, MakeFrameTimes(20.0, 5, 6), settings);
+        EXPECT_EQ(tooFew.m_verdict, BenchmarkComparison::Verdict::InsufficientData);
+    }
+} // namespace UnitTest
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/CullingLodStatistics.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(CullingLodStatisticsTest, EstimateScreenCoverage_ViewInsideSphere_IsFullScreen)
+    {
+        const AZ::Vector3 center(1.0f, 2.0f, 3.0f);
+        EXPECT_FLOAT_EQ(1.0f, CullingLodStatistics::EstimateScreenCoverage(center, 2.0f, center + AZ::Vector3(1.0f, 0.0f, 0.0f), 1.0f));
+    }
+
+    TEST(CullingLodStatisticsTest, EstimateScreenCoverage_FallsOffWithDistance)
+    {
+        const AZ::Vector3 center = AZ::Vector3::CreateZero();
+        const float nearCoverage = CullingLodStatistics::EstimateScreenCoverage(center, 1.0f, AZ::Vector3(0.0f, -10.0f, 0.0f), 2.0f);
+        const float farCoverage = CullingLodStatistics::EstimateScreenCoverage(center, 1.0f, AZ::Vector3(0.0f, -20.0f, 0.0f), 2.0f);
+        EXPECT_FLOAT_EQ(0.2f, nearCoverage);
+        EXPECT_FLOAT_EQ(0.1f, farCoverage);
+    }
+
+    TEST(CullingLodStatisticsTest, SelectLod_EachLodHalvesCoverage)
+    {
+        EXPECT_EQ(0u, CullingLodStatistics::SelectLod(1.0f, 5));
+        EXPECT_EQ(0u, CullingLodStatistics::SelectLod(0.5f, 5));
+        EXPECT_EQ(1u, CullingLodStatistics::SelectLod(0.4f, 5));
+        EXPECT_EQ(2u, CullingLodStatistics::SelectLod(0.2f, 5));
+        EXPECT_EQ(3u, CullingLodStatistics::SelectLod(0.1f, 5));
+        // The last LOD is used for everything down to the minimum coverage
+        EXPECT_EQ(4u, CullingLodStatistics::SelectLod(0.01f, 5));
+    }
+
+    TEST(CullingLodStatisticsTest, SelectLod_BelowMinimumCoverage_ReturnsLodCount)
+    {
+        EXPECT_EQ(5u, CullingLodStatistics::SelectLod(0.5f / 1080.0f, 5));
+        EXPECT_EQ(1u, CullingLodStatistics::SelectLod(0.05f, 1, 0.5f, 0.1f));
+        EXPECT_EQ(0u, CullingLodStatistics::SelectLod(0.05f, 1));
+    }
+} // namespace UnitTest
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/FrameTimeStatistics.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+    using Quantile = FrameTimeStatistics::Quantile;
+
+    TEST(FrameTimeStatisticsTest, FewValues_QuantilesAreExact)
+    {
+        FrameTimeStatistics statistics;
+        statistics.PushValue(3.0f);
+        statistics.PushValue(1.0f);
+        statistics.PushValue(2.0f);
+
+        EXPECT_EQ(statistics.GetCount(), 3);
+        EXPECT_FLOAT_EQ(statistics.GetMinimum(), 1.0f);
+        EXPECT_FLOAT_EQ(statistics.GetMaximum(), 3.0f);
+        EXPECT_DOUBLE_EQ(statistics.GetMean(), 2.0);
+        EXPECT_DOUBLE_EQ(statistics.GetVariance(), 1.0);
+        EXPECT_FLOAT_EQ(statistics.GetMedian(), 2.0f);
+        EXPECT_FLOAT_EQ(statistics.GetQuantile(Quantile::P99), 3.0f);
+    }
+
+    TEST(FrameTimeStatisticsTest, ManyValues_QuantilesConverge)
+    {
+        FrameTimeStatistics statistics;
+
+        // Every value from 0 to 9999 once, in a scrambled but deterministic order
+        const uint32_t valueCount = 10000;
+        for (uint32_t i = 0; i < valueCount; ++i)
+        {
+            statistics.PushValue(static_cast<float>((i * 7919) % valueCount));
+        }
+
+        EXPECT_NEAR(statistics.GetMean(), 4999.5, 1e-6);
+        EXPECT_NEAR(statistics.GetQuantile(Quantile::P50), 5000.0f, 100.0f);
+        EXPECT_NEAR(statistics.GetQuantile(Quantile::P90), 9000.0f, 100.0f);
+        EXPECT_NEAR(statistics.GetQuantile(Quantile::P99), 9900.0f, 50.0f);
+        EXPECT_NEAR(statistics.GetQuantile(Quantile::P999), 9990.0f, 20.0f);
+    }
+
+    TEST(FrameTimeStatisticsTest, Stutters_CountedAboveThreshold)
+    {
+        FrameTimeStatistics statistics(FrameTimeStatistics::DefaultStutterThresholdMs);
+        for (int i = 0; i < 100; ++i)
+        {
+            statistics.PushValue(i % 10 == 0 ? 50.0f : 16.0f);
+        }
+        EXPECT_EQ(statistics.GetStutterCount(), 10);
+
+        statistics.Reset();
+        EXPECT_EQ(statistics.GetCount(), 0);
+        EXPECT_EQ(statistics.GetStutterCount(), 0);
+        EXPECT_FLOAT_EQ(statistics.GetMedian(), 0.0f);
+    }
+} // namespace UnitTest
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/ImGuiHistogramQueue.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(ImGuiHistogramQueueTest, PushValue_BeforeFull_UsesAllValues)
+    {
+        // No display delay so the displayed values update on every push
+        ImGuiHistogramQueue queue(8, 2, 0.0f);
+        queue.PushValue(4.0f);
+        queue.PushValue(1.0f);
+        queue.PushValue(7.0f);
+
+        EXPECT_EQ(3u, queue.GetSampleCount());
+        EXPECT_FLOAT_EQ(4.0f, queue.GetDisplayedAverage());
+        EXPECT_FLOAT_EQ(1.0f, queue.GetDisplayedMinimum());
+        EXPECT_FLOAT_EQ(7.0f, queue.GetDisplayedMaximum());
+        EXPECT_FLOAT_EQ(4.0f, queue.GetRunningAverage());
+    }
+
+    TEST(ImGuiHistogramQueueTest, PushValue_AfterWrapping_MatchesLastValues)
+    {
+        const size_t maxSamples = 16;
+        const size_t runningAverageSamples = 5;
+        ImGuiHistogramQueue queue(maxSamples, runningAverageSamples, 0.0f);
+
+        // A deterministic sequence with rising and falling runs, checked against a rescan of the last values
+        AZStd::vector<float> values;
+        for (uint32_t i = 0; i < 200; ++i)
+        {
+            const float value = static_cast<float>((i * 37) % 23) + ((i / 40) % 2 ? 100.0f : 0.0f);
+            values.push_back(value);
+            queue.PushValue(value);
+
+            const size_t windowSize = AZStd::min(values.size(), maxSamples);
+            float expectedMinimum = values.back();
+            float expectedMaximum = values.back();
+            double expectedSum = 0.0;
+            for (size_t j = values.size() - windowSize; j < values.size(); ++j)
+            {
+                expectedMinimum = AZStd::min(expectedMinimum, values[j]);
+                expectedMaximum = AZStd::max(expectedMaximum, values[j]);
+                expectedSum += values[j];
+            }
+
+            const size_t runningSize = AZStd::min(values.size(), runningAverageSamples);
+            double expectedRunningSum = 0.0;
+            for (size_t j = values.size() - runningSize; j < values.size(); ++j)
+            {
+                expectedRunningSum += values[j];
+            }
+
+            ASSERT_EQ(windowSize, queue.GetSampleCount());
+            EXPECT_FLOAT_EQ(expectedMinimum, queue.GetDisplayedMinimum());
+            EXPECT_FLOAT_EQ(expectedMaximum, queue.GetDisplayedMaximum());
+            EXPECT_NEAR(expectedSum / windowSize, queue.GetDisplayedAverage(), 1e-4);
+            EXPECT_NEAR(expectedRunningSum / runningSize, queue.GetRunningAverage(), 1e-4);
+        }
+    }
+
+    TEST(ImGuiHistogramQueueTest, PushValue_RunningAverageOverWholeLog_DropsOldestValue)
+    {
+        ImGuiHistogramQueue queue(3, 3, 0.0f);
+        queue.PushValue(3.0f);
+        queue.PushValue(6.0f);
+        queue.PushValue(9.0f);
+        queue.PushValue(12.0f);
+
+        EXPECT_FLOAT_EQ(9.0f, queue.GetRunningAverage());
+        EXPECT_FLOAT_EQ(9.0f, queue.GetDisplayedAverage());
+        EXPECT_FLOAT_EQ(6.0f, queue.GetDisplayedMinimum());
+        EXPECT_FLOAT_EQ(12.0f, queue.GetDisplayedMaximum());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Cost of one push with the queue full, which should stay flat as the log grows. Items are pushed values.
+    static void BM_ImGuiHistogramQueue_PushValue(benchmark::State& state)
+    {
+        const size_t maxSamples = aznumeric_cast<size_t>(state.range(0));
+        ImGuiHistogramQueue queue(maxSamples, maxSamples, 0.25f);
+
+        uint32_t i = 0;
+        for (size_t j = 0; j < maxSamples; ++j)
+        {
+            queue.PushValue(static_cast<float>((i++ * 37) % 23));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            queue.PushValue(static_cast<float>((i++ * 37) % 23));
+        }
+
+        benchmark::DoNotOptimize(queue.GetRunningAverage());
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ImGuiHistogramQueue_PushValue)->Arg(1000)->Arg(100000)->Arg(1000000);
+#endif
+} // namespace UnitTest
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Automation/IncrementalTestCache.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    class IncrementalTestCacheTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        static constexpr uint64_t BuildIdentity = 0x1234;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::NameDictionary::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::NameDictionary::Destroy();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Records a passing script without screenshots or assets, and saves the cache
+        void RecordPassingScript(AZStd::string_view renderApiName, uint64_t buildIdentity)
+        {
+            IncrementalTestCache cache;
+            cache.SetCacheFolder(m_tempDirectory.GetDirectory());
+            cache.Load(renderApiName, buildIdentity);
+
+            ScriptReporter scriptReporter;
+            cache.BeginScript("scripts/test.lua", scriptReporter.GetScriptReport().size());
+            scriptReporter.PushScript("scripts/test.lua");
+            scriptReporter.PopScript();
+            cache.EndScript(scriptReporter);
+            EXPECT_EQ(cache.GetEntryCount(), 1);
+
+            cache.Save();
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(IncrementalTestCacheTest, Load_SameBuildAndRenderApi_ReusesPassedScript)
+    {
+        RecordPassingScript("dx12", BuildIdentity);
+
+        IncrementalTestCache cache;
+        cache.SetCacheFolder(m_tempDirectory.GetDirectory());
+        cache.Load("dx12", BuildIdentity);
+        EXPECT_EQ(cache.GetEntryCount(), 1);
+        EXPECT_NE(cache.FindUpToDateReports("scripts/test.lua"), nullptr);
+    }
+
+    TEST_F(IncrementalTestCacheTest, Load_DifferentBuild_DiscardsCache)
+    {
+        RecordPassingScript("dx12", BuildIdentity);
+
+        IncrementalTestCache cache;
+        cache.SetCacheFolder(m_tempDirectory.GetDirectory());
+        cache.Load("dx12", BuildIdentity + 1);
+        EXPECT_EQ(cache.GetEntryCount(), 0);
+        EXPECT_EQ(cache.FindUpToDateReports("scripts/test.lua"), nullptr);
+    }
+
+    TEST_F(IncrementalTestCacheTest, Load_DifferentRenderApi_DiscardsCache)
+    {
+        RecordPassingScript("dx12", BuildIdentity);
+
+        IncrementalTestCache cache;
+        cache.SetCacheFolder(m_tempDirectory.GetDirectory());
+        cache.Load("vulkan", BuildIdentity);
+        EXPECT_EQ(cache.GetEntryCount(), 0);
+    }
+
+    TEST_F(IncrementalTestCacheTest, GetBuildIdentity_IsStableWithinProcess)
+    {
+        EXPECT_EQ(IncrementalTestCache::GetBuildIdentity(), IncrementalTestCache::GetBuildIdentity());
+    }
+} // namespace UnitTest
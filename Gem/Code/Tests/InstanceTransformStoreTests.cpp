@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <Performance/InstanceTransformStore.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    static AZ::Transform CreateRandomTransform(AZ::SimpleLcgRandom& random)
+    {
+        const AZ::Vector3 position(random.GetRandomFloat() * 100.0f, random.GetRandomFloat() * 100.0f, random.GetRandomFloat() * 100.0f);
+        const AZ::Vector3 eulerRadians(random.GetRandomFloat() * 6.0f, random.GetRandomFloat() * 6.0f, random.GetRandomFloat() * 6.0f);
+        return AZ::Transform(position, AZ::Quaternion::CreateFromEulerRadiansXYZ(eulerRadians), 0.5f + random.GetRandomFloat());
+    }
+
+    static void FillStore(InstanceTransformStore& store, AZStd::vector<AZ::Transform>& transforms, size_t count)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        store.Reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            transforms.push_back(CreateRandomTransform(random));
+            store.Add(transforms.back());
+        }
+    }
+
+    TEST(InstanceTransformStoreTest, GetTransform_ReturnsAddedTransform)
+    {
+        InstanceTransformStore store;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(store, transforms, 10);
+
+        ASSERT_EQ(10u, store.GetCount());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            EXPECT_TRUE(store.GetTransform(i).IsClose(transforms[i]));
+        }
+    }
+
+    TEST(InstanceTransformStoreTest, AddRange_MatchesSingleAdds)
+    {
+        InstanceTransformStore singleStore;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(singleStore, transforms, 10);
+
+        InstanceTransformStore rangeStore;
+        rangeStore.Add(transforms.front());
+        rangeStore.Add(AZStd::span<const AZ::Transform>(transforms).subspan(1));
+
+        ASSERT_EQ(singleStore.GetCount(), rangeStore.GetCount());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            EXPECT_TRUE(rangeStore.GetTransform(i).IsClose(singleStore.GetTransform(i)));
+        }
+    }
+
+    TEST(InstanceTransformStoreTest, UpdateRotated_MatchesTransformProduct)
+    {
+        InstanceTransformStore store;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(store, transforms, 1000);
+
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(0.3f, 1.2f, -2.0f));
+        store.UpdateRotated(rotation);
+
+        const AZ::Transform rotationTransform = AZ::Transform::CreateFromQuaternion(rotation);
+        AZStd::span<const AZ::Transform> worldTransforms = store.GetWorldTransforms();
+        ASSERT_EQ(transforms.size(), worldTransforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            EXPECT_TRUE(worldTransforms[i].IsClose(transforms[i] * rotationTransform, 1e-4f));
+        }
+    }
+
+    TEST(InstanceTransformStoreTest, Clear_RemovesInstances)
+    {
+        InstanceTransformStore store;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(store, transforms, 10);
+        store.UpdateRotated(AZ::Quaternion::CreateIdentity());
+
+        store.Clear();
+        EXPECT_EQ(0u, store.GetCount());
+        EXPECT_TRUE(store.GetWorldTransforms().empty());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // The structure of arrays kernel, on the calling thread
+    static void BM_InstanceTransformStore_UpdateRotated(benchmark::State& state)
+    {
+        InstanceTransformStore store;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(store, transforms, aznumeric_cast<size_t>(state.range(0)));
+        store.UpdateRotated(AZ::Quaternion::CreateIdentity());
+
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(0.3f, 1.2f, -2.0f));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            store.UpdateRotatedRange(rotation, 0, store.GetCount());
+            benchmark::DoNotOptimize(store.GetWorldTransforms().data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_InstanceTransformStore_UpdateRotated)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+    // The per-instance AZ::Transform product the store replaces, kept as a point of comparison
+    static void BM_InstanceTransformStore_TransformProductLoop(benchmark::State& state)
+    {
+        InstanceTransformStore store;
+        AZStd::vector<AZ::Transform> transforms;
+        FillStore(store, transforms, aznumeric_cast<size_t>(state.range(0)));
+        AZStd::vector<AZ::Transform> worldTransforms(transforms.size());
+
+        const AZ::Transform rotationTransform =
+            AZ::Transform::CreateFromQuaternion(AZ::Quaternion::CreateFromEulerRadiansXYZ(AZ::Vector3(0.3f, 1.2f, -2.0f)));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < transforms.size(); ++i)
+            {
+                worldTransforms[i] = transforms[i] * rotationTransform;
+            }
+            benchmark::DoNotOptimize(worldTransforms.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_InstanceTransformStore_TransformProductLoop)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
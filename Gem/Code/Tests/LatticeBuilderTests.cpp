@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Performance/LatticeBuilder.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    static LatticeBuilder::Layout CreateLayout(uint32_t width, uint32_t depth, uint32_t height)
+    {
+        LatticeBuilder::Layout layout;
+        layout.m_width = width;
+        layout.m_depth = depth;
+        layout.m_height = height;
+        layout.m_spacing = AZ::Vector3(2.0f, 3.0f, 5.0f);
+        layout.m_entityScale = 0.5f;
+        return layout;
+    }
+
+    TEST(LatticeBuilderTest, Build_MatchesNestedLoops)
+    {
+        const LatticeBuilder::Layout layout = CreateLayout(7, 5, 3);
+        AZStd::vector<AZ::Transform> transforms;
+        LatticeBuilder::Build(layout, transforms);
+
+        ASSERT_EQ(7u * 5u * 3u, transforms.size());
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi);
+        size_t index = 0;
+        for (uint32_t x = 0; x < layout.m_width; ++x)
+        {
+            for (uint32_t y = 0; y < layout.m_depth; ++y)
+            {
+                for (uint32_t z = 0; z < layout.m_height; ++z)
+                {
+                    const AZ::Vector3 position(x * 2.0f, y * 3.0f, z * 5.0f);
+                    const AZ::Transform expected(position, rotation, 0.5f);
+                    EXPECT_TRUE(transforms[index].IsClose(expected)) << "cell " << index;
+                    ++index;
+                }
+            }
+        }
+    }
+
+    TEST(LatticeBuilderTest, Build_ReturnsBoundsOfPositions)
+    {
+        AZStd::vector<AZ::Transform> transforms;
+        const AZ::Aabb bounds = LatticeBuilder::Build(CreateLayout(4, 3, 2), transforms);
+
+        EXPECT_TRUE(bounds.GetMin().IsClose(AZ::Vector3::CreateZero()));
+        EXPECT_TRUE(bounds.GetMax().IsClose(AZ::Vector3(6.0f, 6.0f, 5.0f)));
+    }
+
+    TEST(LatticeBuilderTest, Build_EmptyLattice_HasNullBounds)
+    {
+        AZStd::vector<AZ::Transform> transforms(10);
+        const AZ::Aabb bounds = LatticeBuilder::Build(CreateLayout(0, 3, 2), transforms);
+
+        EXPECT_TRUE(transforms.empty());
+        EXPECT_FALSE(bounds.IsValid());
+    }
+
+    TEST(LatticeBuilderTest, BuildRange_ChunksMatchSingleRange)
+    {
+        // Chunks that start part way through a row and a slice, like the jobs of a large lattice do
+        const LatticeBuilder::Layout layout = CreateLayout(6, 5, 4);
+        const size_t count = 6 * 5 * 4;
+
+        AZStd::vector<AZ::Transform> expected(count);
+        const AZ::Aabb expectedBounds = LatticeBuilder::BuildRange(layout, 0, expected);
+
+        AZStd::vector<AZ::Transform> chunked(count);
+        AZ::Aabb chunkedBounds = AZ::Aabb::CreateNull();
+        const size_t chunkSize = 7;
+        for (size_t first = 0; first < count; first += chunkSize)
+        {
+            const size_t chunkCount = AZStd::min(chunkSize, count - first);
+            chunkedBounds.AddAabb(LatticeBuilder::BuildRange(layout, first, AZStd::span<AZ::Transform>(chunked.data() + first, chunkCount)));
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_TRUE(chunked[i].IsClose(expected[i])) << "cell " << i;
+        }
+        EXPECT_TRUE(chunkedBounds.GetMin().IsClose(expectedBounds.GetMin()));
+        EXPECT_TRUE(chunkedBounds.GetMax().IsClose(expectedBounds.GetMax()));
+    }
+} // namespace UnitTest
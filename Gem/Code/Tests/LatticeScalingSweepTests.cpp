@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Performance/LatticeScalingSweep.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(LatticeScalingSweepTest, FitLatticeDimensions_PerfectCube_IsExact)
+    {
+        uint32_t width = 0, depth = 0, height = 0;
+        LatticeScalingSweep::FitLatticeDimensions(97336, 100, width, depth, height);
+        EXPECT_EQ(46u, width);
+        EXPECT_EQ(46u, depth);
+        EXPECT_EQ(46u, height);
+    }
+
+    TEST(LatticeScalingSweepTest, FitLatticeDimensions_OtherCounts_AreClose)
+    {
+        for (uint32_t instanceCount : { 1u, 10u, 1000u, 10000u, 50000u, 100000u, 250000u })
+        {
+            uint32_t width = 0, depth = 0, height = 0;
+            LatticeScalingSweep::FitLatticeDimensions(instanceCount, 100, width, depth, height);
+            const double fittedCount = static_cast<double>(width) * depth * height;
+            EXPECT_NEAR(instanceCount, fittedCount, instanceCount * 0.01 + 1.0);
+        }
+    }
+
+    TEST(LatticeScalingSweepTest, FitLatticeDimensions_LargeCount_ClampsToMaxDimension)
+    {
+        uint32_t width = 0, depth = 0, height = 0;
+        LatticeScalingSweep::FitLatticeDimensions(5000000, 100, width, depth, height);
+        EXPECT_EQ(100u, width);
+        EXPECT_EQ(100u, depth);
+        EXPECT_EQ(100u, height);
+    }
+
+    TEST(LatticeScalingSweepTest, ParseInstanceCounts_ValidList_ReturnsCounts)
+    {
+        AZStd::vector<uint32_t> instanceCounts;
+        EXPECT_TRUE(LatticeScalingSweep::ParseInstanceCounts("1000, 8000,27000 ", instanceCounts));
+        ASSERT_EQ(3u, instanceCounts.size());
+        EXPECT_EQ(1000u, instanceCounts[0]);
+        EXPECT_EQ(8000u, instanceCounts[1]);
+        EXPECT_EQ(27000u, instanceCounts[2]);
+    }
+
+    TEST(LatticeScalingSweepTest, ParseInstanceCounts_InvalidEntries_Fail)
+    {
+        AZStd::vector<uint32_t> instanceCounts;
+        EXPECT_FALSE(LatticeScalingSweep::ParseInstanceCounts("", instanceCounts));
+        EXPECT_FALSE(LatticeScalingSweep::ParseInstanceCounts("1000,,8000", instanceCounts));
+        EXPECT_FALSE(LatticeScalingSweep::ParseInstanceCounts("1000,-5", instanceCounts));
+        EXPECT_FALSE(LatticeScalingSweep::ParseInstanceCounts("0", instanceCounts));
+        EXPECT_FALSE(LatticeScalingSweep::ParseInstanceCounts("99999999999", instanceCounts));
+    }
+
+    TEST(LatticeScalingSweepTest, ComputeScaling_QuadraticCost_HasExponentTwo)
+    {
+        AZStd::vector<LatticeScalingSweep::StepResult> results(3);
+        const uint32_t instanceCounts[] = { 1000, 2000, 4000 };
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const float scale = instanceCounts[i] / 1000.0f;
+            results[i].m_instanceCount = instanceCounts[i];
+            results[i].m_cpuFrameTimeMedianMs = scale * scale;
+            results[i].m_processMemoryBytes = instanceCounts[i] * 100;
+        }
+
+        LatticeScalingSweep::ComputeScaling(results);
+
+        EXPECT_DOUBLE_EQ(0.0, results[0].m_scalingExponent);
+        EXPECT_NEAR(2.0, results[1].m_scalingExponent, 1e-6);
+        EXPECT_NEAR(2.0, results[2].m_scalingExponent, 1e-6);
+        EXPECT_NEAR(100.0, results[2].m_memoryPerInstanceBytes, 1e-6);
+        // (16 ms - 4 ms) over 2000 added instances
+        EXPECT_NEAR(6.0, results[2].m_cpuFrameTimePerInstanceUs, 1e-4);
+    }
+
+    TEST(LatticeScalingSweepTest, Update_RunsEveryStepInOrder)
+    {
+        AZStd::vector<uint32_t> builtCounts;
+        bool isReady = false;
+        bool finished = false;
+
+        LatticeScalingSweep::Settings settings;
+        settings.m_instanceCounts = { 8000, 1000 };
+        settings.m_warmupFrames = 2;
+        settings.m_captureFrames = 3;
+
+        LatticeScalingSweep::Callbacks callbacks;
+        callbacks.m_buildLattice = [&](uint32_t width, uint32_t depth, uint32_t height)
+        {
+            builtCounts.push_back(width * depth * height);
+            isReady = false;
+        };
+        callbacks.m_isLatticeReady = [&]() { return isReady; };
+        callbacks.m_getProcessMemoryBytes = []() { return uint64_t{ 1024 }; };
+        callbacks.m_sweepFinished = [&]() { finished = true; };
+
+        LatticeScalingSweep sweep;
+        ASSERT_TRUE(sweep.Start(settings, callbacks));
+
+        // Frames while the lattice isn't ready don't count towards the warmup or the capture
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            sweep.Update(1.0f);
+        }
+        EXPECT_EQ(1u, builtCounts.size());
+
+        for (int frame = 0; frame < 100 && sweep.IsRunning(); ++frame)
+        {
+            isReady = true;
+            sweep.Update(builtCounts.size() == 1 ? 1.0f : 8.0f);
+        }
+
+        EXPECT_FALSE(sweep.IsRunning());
+        EXPECT_TRUE(finished);
+        ASSERT_EQ(2u, builtCounts.size());
+        EXPECT_EQ(1000u, builtCounts[0]);
+        EXPECT_EQ(8000u, builtCounts[1]);
+
+        AZStd::span<const LatticeScalingSweep::StepResult> results = sweep.GetResults();
+        ASSERT_EQ(2u, results.size());
+        EXPECT_FLOAT_EQ(1.0f, results[0].m_cpuFrameTimeMedianMs);
+        EXPECT_FLOAT_EQ(8.0f, results[1].m_cpuFrameTimeMedianMs);
+        EXPECT_EQ(1024u, results[1].m_processMemoryBytes);
+        EXPECT_NEAR(1.0, results[1].m_scalingExponent, 1e-6);
+    }
+
+    TEST(LatticeScalingSweepTest, Stop_DropsUnfinishedStep)
+    {
+        LatticeScalingSweep::Settings settings;
+        settings.m_instanceCounts = { 1000, 8000 };
+        settings.m_warmupFrames = 0;
+        settings.m_captureFrames = 1;
+
+        LatticeScalingSweep::Callbacks callbacks;
+        callbacks.m_buildLattice = [](uint32_t, uint32_t, uint32_t) {};
+        callbacks.m_isLatticeReady = []() { return true; };
+        callbacks.m_getProcessMemoryBytes = []() { return uint64_t{ 0 }; };
+
+        LatticeScalingSweep sweep;
+        ASSERT_TRUE(sweep.Start(settings, callbacks));
+        sweep.Update(1.0f); // ready
+        sweep.Update(1.0f); // warmup
+        sweep.Update(1.0f); // captured, starts the second step
+        ASSERT_TRUE(sweep.IsRunning());
+
+        sweep.Stop();
+        EXPECT_FALSE(sweep.IsRunning());
+        EXPECT_EQ(1u, sweep.GetResults().size());
+    }
+} // namespace UnitTest
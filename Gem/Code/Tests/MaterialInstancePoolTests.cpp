@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+#include <Utils/MaterialInstancePool.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    // RPI materials can't be created without a renderer, so the bookkeeping is tested with a stand-in instance type
+    using TestInstance = AZStd::shared_ptr<int>;
+    using TestInstanceMap = SharedMaterialInstanceMap<TestInstance>;
+
+    class MaterialInstancePoolTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::NameDictionary::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::NameDictionary::Destroy();
+            LeakDetectionFixture::TearDown();
+        }
+
+        static TestInstanceMap::PropertyOverrides MakeOverrides(AZStd::initializer_list<AZStd::pair<const char*, float>> values)
+        {
+            TestInstanceMap::PropertyOverrides propertyOverrides;
+            for (const auto& [name, value] : values)
+            {
+                propertyOverrides.emplace_back(AZ::Name(name), AZ::RPI::MaterialPropertyValue(value));
+            }
+            TestInstanceMap::SortOverrides(propertyOverrides);
+            return propertyOverrides;
+        }
+
+        static uint32_t GetReferenceCount(const TestInstanceMap& instanceMap)
+        {
+            uint32_t referenceCount = 0;
+            instanceMap.ForEach([&referenceCount](const TestInstance&, uint32_t instanceReferenceCount)
+                {
+                    referenceCount += instanceReferenceCount;
+                });
+            return referenceCount;
+        }
+
+        const AZ::Data::AssetId m_assetId{ AZ::Uuid::CreateName("material"), 0 };
+    };
+
+    TEST_F(MaterialInstancePoolTest, Acquire_SameAssetAndOverrides_ReturnsSameInstance)
+    {
+        TestInstanceMap instanceMap;
+        const TestInstance instance = AZStd::make_shared<int>(1);
+        instanceMap.Add(m_assetId, MakeOverrides({ { "baseColor.factor", 0.5f }, { "roughness.factor", 0.2f } }), instance);
+
+        // The order of the overrides doesn't matter
+        const TestInstance acquired = instanceMap.Acquire(m_assetId, MakeOverrides({ { "roughness.factor", 0.2f }, { "baseColor.factor", 0.5f } }));
+        EXPECT_EQ(acquired, instance);
+        EXPECT_EQ(instanceMap.GetInstanceCount(), 1);
+        EXPECT_EQ(GetReferenceCount(instanceMap), 2);
+    }
+
+    TEST_F(MaterialInstancePoolTest, Release_LastReference_EvictsInstance)
+    {
+        TestInstanceMap instanceMap;
+        const TestInstance instance = AZStd::make_shared<int>(1);
+        const auto propertyOverrides = MakeOverrides({ { "roughness.factor", 0.2f } });
+        instanceMap.Add(m_assetId, propertyOverrides, instance);
+        ASSERT_EQ(instanceMap.Acquire(m_assetId, propertyOverrides), instance);
+
+        EXPECT_TRUE(instanceMap.Release(instance));
+        EXPECT_TRUE(instanceMap.Contains(instance));
+        EXPECT_EQ(GetReferenceCount(instanceMap), 1);
+
+        EXPECT_TRUE(instanceMap.Release(instance));
+        EXPECT_FALSE(instanceMap.Contains(instance));
+        EXPECT_EQ(instanceMap.GetInstanceCount(), 0);
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, propertyOverrides), nullptr);
+
+        // Instances that aren't in the map are left to the caller
+        EXPECT_FALSE(instanceMap.Release(instance));
+    }
+
+    TEST_F(MaterialInstancePoolTest, Acquire_DifferentOverrides_DoNotCollide)
+    {
+        TestInstanceMap instanceMap;
+        const TestInstance noOverrides = AZStd::make_shared<int>(0);
+        const TestInstance roughness = AZStd::make_shared<int>(1);
+        instanceMap.Add(m_assetId, {}, noOverrides);
+        instanceMap.Add(m_assetId, MakeOverrides({ { "roughness.factor", 0.2f } }), roughness);
+
+        // The same names with different values hash the same, but are a different key
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, MakeOverrides({ { "roughness.factor", 0.8f } })), nullptr);
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, MakeOverrides({ { "metallic.factor", 0.2f } })), nullptr);
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, MakeOverrides({ { "roughness.factor", 0.2f }, { "metallic.factor", 0.2f } })), nullptr);
+
+        const AZ::Data::AssetId otherAssetId(AZ::Uuid::CreateName("otherMaterial"), 0);
+        EXPECT_EQ(instanceMap.Acquire(otherAssetId, MakeOverrides({ { "roughness.factor", 0.2f } })), nullptr);
+
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, {}), noOverrides);
+        EXPECT_EQ(instanceMap.Acquire(m_assetId, MakeOverrides({ { "roughness.factor", 0.2f } })), roughness);
+        EXPECT_EQ(instanceMap.GetInstanceCount(), 2);
+    }
+} // namespace UnitTest
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <ProceduralSkinnedMesh.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    static SkinnedMeshConfig CreateConfig(int segmentCount, int verticesPerSegment, int boneCount = 4)
+    {
+        SkinnedMeshConfig config;
+        config.m_segmentCount = segmentCount;
+        config.m_verticesPerSegment = verticesPerSegment;
+        config.m_boneCount = boneCount;
+        config.m_influencesPerVertex = 4;
+        return config;
+    }
+
+    TEST(ProceduralSkinnedMeshTest, Resize_GeneratesNormalizedInfluences)
+    {
+        SkinnedMeshConfig config = CreateConfig(8, 8);
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(config);
+
+        ASSERT_EQ(64u, mesh.GetVertexCount());
+        ASSERT_EQ(64u, mesh.m_uvs.size());
+        for (uint32_t vertexIndex = 0; vertexIndex < mesh.GetVertexCount(); ++vertexIndex)
+        {
+            float totalWeight = 0.0f;
+            for (uint32_t i = 0; i < mesh.GetInfluencesPerVertex(); ++i)
+            {
+                totalWeight += mesh.m_blendWeights[vertexIndex * mesh.GetInfluencesPerVertex() + i];
+            }
+            EXPECT_NEAR(1.0f, totalWeight, 1e-5f);
+        }
+    }
+
+    TEST(ProceduralSkinnedMeshTest, CalculateVertexRange_SplitRanges_MatchWholeMesh)
+    {
+        SkinnedMeshConfig config = CreateConfig(16, 10);
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(config);
+
+        const AZStd::vector<float> positions = mesh.m_positions;
+        const AZStd::vector<float> tangents = mesh.m_tangents;
+        const AZStd::vector<uint32_t> blendIndices = mesh.m_blendIndices;
+        const AZStd::vector<float> blendWeights = mesh.m_blendWeights;
+
+        AZStd::fill(mesh.m_positions.begin(), mesh.m_positions.end(), 0.0f);
+        AZStd::fill(mesh.m_tangents.begin(), mesh.m_tangents.end(), 0.0f);
+        AZStd::fill(mesh.m_blendIndices.begin(), mesh.m_blendIndices.end(), 0u);
+        AZStd::fill(mesh.m_blendWeights.begin(), mesh.m_blendWeights.end(), 0.0f);
+
+        // Split in the middle of a segment, like the jobs do
+        mesh.CalculateVertexRange(0, 64);
+        mesh.CalculateVertexRange(64, mesh.GetVertexCount() - 64);
+
+        EXPECT_EQ(positions, mesh.m_positions);
+        EXPECT_EQ(tangents, mesh.m_tangents);
+        EXPECT_EQ(blendIndices, mesh.m_blendIndices);
+        EXPECT_EQ(blendWeights, mesh.m_blendWeights);
+    }
+
+    TEST(ProceduralSkinnedMeshTest, Resize_SmallerMesh_ReusesBuffers)
+    {
+        SkinnedMeshConfig largeConfig = CreateConfig(64, 32);
+        SkinnedMeshConfig smallConfig = CreateConfig(16, 16);
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(largeConfig);
+        const float* positionData = mesh.m_positions.data();
+        const float* tangentData = mesh.m_tangents.data();
+
+        mesh.Resize(smallConfig);
+
+        EXPECT_EQ(256u, mesh.GetVertexCount());
+        EXPECT_EQ(positionData, mesh.m_positions.data());
+        EXPECT_EQ(tangentData, mesh.m_tangents.data());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Makes a job manager with the given number of worker threads the global job context while it exists, as the
+    // application does, so the jobified paths can run
+    class ScopedJobContext
+    {
+    public:
+        explicit ScopedJobContext(uint32_t workerThreadCount)
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            for (uint32_t i = 0; i < workerThreadCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        ~ScopedJobContext()
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    // Vertex generation of the whole mesh on the calling thread, the serial baseline of
+    // BM_ProceduralSkinnedMesh_ResizeJobs. Items are vertices, so the rate is verts/sec.
+    static void BM_ProceduralSkinnedMesh_CalculateVertexRange(benchmark::State& state)
+    {
+        SkinnedMeshConfig config = CreateConfig(aznumeric_cast<int>(state.range(0)), aznumeric_cast<int>(state.range(1)));
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(config);
+
+        const uint32_t vertexCount = mesh.GetVertexCount();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            mesh.CalculateVertexRange(0, vertexCount);
+            benchmark::DoNotOptimize(mesh.m_positions.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * vertexCount);
+    }
+    BENCHMARK(BM_ProceduralSkinnedMesh_CalculateVertexRange)
+        ->Args({ 8, 8 })
+        ->Args({ 32, 32 })
+        ->Args({ 64, 128 })
+        ->Args({ 256, 128 })
+        ->Args({ 512, 256 })
+        ->Unit(benchmark::kMicrosecond);
+
+    // Regenerating the mesh in place, which splits the vertices into ranges of VerticesPerJob for parallel jobs.
+    // The arguments are the segment count, vertices per segment and worker thread count. Items are vertices.
+    static void BM_ProceduralSkinnedMesh_ResizeJobs(benchmark::State& state)
+    {
+        ScopedJobContext jobContext(aznumeric_cast<uint32_t>(state.range(2)));
+
+        SkinnedMeshConfig config = CreateConfig(aznumeric_cast<int>(state.range(0)), aznumeric_cast<int>(state.range(1)));
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(config);
+
+        const uint32_t vertexCount = mesh.GetVertexCount();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            mesh.Resize(config);
+            benchmark::DoNotOptimize(mesh.m_positions.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * vertexCount);
+    }
+    BENCHMARK(BM_ProceduralSkinnedMesh_ResizeJobs)
+        ->Args({ 256, 128, 1 })
+        ->Args({ 256, 128, 4 })
+        ->Args({ 512, 256, 1 })
+        ->Args({ 512, 256, 4 })
+        ->Args({ 512, 256, 8 })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+
+    // Bone animation of one mesh. Items are bones.
+    static void BM_ProceduralSkinnedMesh_UpdateAnimation(benchmark::State& state)
+    {
+        SkinnedMeshConfig config = CreateConfig(8, 8, aznumeric_cast<int>(state.range(0)));
+        ProceduralSkinnedMesh mesh;
+        mesh.Resize(config);
+
+        float time = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            mesh.UpdateAnimation(time);
+            time += 1.0f / 60.0f;
+            benchmark::DoNotOptimize(mesh.m_boneMatrices.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ProceduralSkinnedMesh_UpdateAnimation)->Arg(4)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+    // Bone animation of many meshes of 64 bones, in jobs of MeshesPerAnimationJob meshes as the SkinnedMesh sample does.
+    // The arguments are the mesh count and worker thread count. Items are bones.
+    static void BM_ProceduralSkinnedMesh_UpdateAnimationsJobs(benchmark::State& state)
+    {
+        ScopedJobContext jobContext(aznumeric_cast<uint32_t>(state.range(1)));
+
+        constexpr int BoneCount = 64;
+        SkinnedMeshConfig config = CreateConfig(8, 8, BoneCount);
+        AZStd::vector<ProceduralSkinnedMesh> meshes(aznumeric_cast<size_t>(state.range(0)));
+        for (ProceduralSkinnedMesh& mesh : meshes)
+        {
+            mesh.Resize(config);
+        }
+
+        auto getMesh = [&meshes](uint32_t i) -> ProceduralSkinnedMesh&
+        {
+            return meshes[i];
+        };
+
+        float time = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ProceduralSkinnedMesh::UpdateAnimations(aznumeric_cast<uint32_t>(meshes.size()), getMesh, time);
+            time += 1.0f / 60.0f;
+            benchmark::DoNotOptimize(meshes.back().m_boneMatrices.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0) * BoneCount);
+    }
+    BENCHMARK(BM_ProceduralSkinnedMesh_UpdateAnimationsJobs)
+        ->Args({ 4, 1 })
+        ->Args({ 256, 1 })
+        ->Args({ 256, 4 })
+        ->Args({ 256, 8 })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+#endif
+} // namespace UnitTest
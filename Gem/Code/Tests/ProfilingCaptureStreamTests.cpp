@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Automation/ProfilingCaptureStream.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(ProfilingCaptureStreamTest, WriteThenRead_RoundTripsFramesAndPassNames)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string filePath = AZStd::string::format("%s/capture.asvpcap", tempDirectory.GetDirectory());
+
+        ProfilingCaptureStreamWriter writer;
+        ASSERT_TRUE(writer.Open(filePath, "TestCapture"));
+
+        const ProfilingCaptureStreamWriter::PassTimestamp frame0[] = { { "Root.Forward", 100 }, { "Root.Shadow", 200 } };
+        const ProfilingCaptureStreamWriter::PassTimestamp frame1[] = { { "Root.Forward", 110 }, { "Root.Shadow", 210 } };
+        // A pass is added and the order changes, which should add one pass name without duplicating the others
+        const ProfilingCaptureStreamWriter::PassTimestamp frame2[] = { { "Root.Shadow", 220 }, { "Root.Bloom", 5 }, { "Root.Forward", 120 } };
+        writer.AddFrame(0, 16.5, frame0);
+        writer.AddFrame(1, 16.6, frame1);
+        writer.AddFrame(2, 16.7, frame2);
+        EXPECT_EQ(writer.GetFrameCount(), 3);
+        ASSERT_TRUE(writer.Close());
+
+        ProfilingCaptureStreamReader reader;
+        ASSERT_TRUE(reader.Load(filePath)) << reader.GetError().c_str();
+        EXPECT_TRUE(reader.IsComplete());
+        EXPECT_EQ(reader.GetCaptureName(), "TestCapture");
+
+        const auto& passNames = reader.GetPassNames();
+        ASSERT_EQ(passNames.size(), 3);
+        EXPECT_EQ(passNames[0], "Root.Forward");
+        EXPECT_EQ(passNames[1], "Root.Shadow");
+        EXPECT_EQ(passNames[2], "Root.Bloom");
+
+        const auto& frames = reader.GetFrames();
+        ASSERT_EQ(frames.size(), 3);
+        EXPECT_EQ(frames[1].m_frameNumber, 1);
+        EXPECT_DOUBLE_EQ(frames[1].m_cpuFrameTime, 16.6);
+
+        ASSERT_EQ(frames[2].m_passTimestamps.size(), 3);
+        EXPECT_EQ(passNames[frames[2].m_passTimestamps[0].m_passIndex], "Root.Shadow");
+        EXPECT_EQ(frames[2].m_passTimestamps[0].m_durationInNanoseconds, 220);
+        EXPECT_EQ(passNames[frames[2].m_passTimestamps[1].m_passIndex], "Root.Bloom");
+        EXPECT_EQ(passNames[frames[2].m_passTimestamps[2].m_passIndex], "Root.Forward");
+        EXPECT_EQ(frames[2].m_passTimestamps[2].m_durationInNanoseconds, 120);
+    }
+
+    TEST(ProfilingCaptureStreamTest, TruncatedStream_KeepsCompleteFrames)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string filePath = AZStd::string::format("%s/capture.asvpcap", tempDirectory.GetDirectory());
+
+        ProfilingCaptureStreamWriter writer;
+        ASSERT_TRUE(writer.Open(filePath, "TestCapture"));
+        const ProfilingCaptureStreamWriter::PassTimestamp passes[] = { { "Root.Forward", 100 } };
+        writer.AddFrame(0, 16.0, passes);
+        writer.AddFrame(1, 17.0, passes);
+        ASSERT_TRUE(writer.Close());
+
+        const uint64_t fileSize = AZ::IO::SystemFile::Length(filePath.c_str());
+        AZStd::vector<uint8_t> data(fileSize);
+        ASSERT_EQ(AZ::IO::SystemFile::Read(filePath.c_str(), data.data(), fileSize), fileSize);
+
+        // Drop the End chunk and half of the last frame, as if the application stopped while writing
+        const size_t endChunkSize = sizeof(ProfilingCaptureStream::ChunkHeader) + sizeof(ProfilingCaptureStream::EndRecord);
+        data.resize(data.size() - endChunkSize - sizeof(ProfilingCaptureStream::PassTimestampRecord) / 2);
+
+        ProfilingCaptureStreamReader reader;
+        ASSERT_TRUE(reader.Parse(AZStd::move(data))) << reader.GetError().c_str();
+        EXPECT_FALSE(reader.IsComplete());
+        ASSERT_EQ(reader.GetFrames().size(), 1);
+        EXPECT_EQ(reader.GetFrames()[0].m_frameNumber, 0);
+    }
+
+    TEST(ProfilingCaptureStreamTest, FrameRing_KeepsNewestFramesInOrder)
+    {
+        ProfilingCaptureFrameRing ring;
+        ring.Reset(3, 2);
+
+        const ProfilingCaptureStreamWriter::PassTimestamp passes[] = { { "Root.Forward", 100 }, { "Root.Shadow", 200 }, { "Root.Bloom", 300 } };
+        for (uint64_t frame = 0; frame < 5; ++frame)
+        {
+            ring.PushFrame(frame, double(frame), passes);
+        }
+
+        EXPECT_EQ(ring.GetFrameCount(), 3);
+        // Each frame had one more pass than the ring has room for
+        EXPECT_EQ(ring.GetDroppedPassCount(), 5);
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string filePath = AZStd::string::format("%s/series.asvpcap", tempDirectory.GetDirectory());
+
+        ProfilingCaptureStreamWriter writer;
+        ASSERT_TRUE(writer.Open(filePath, "Series"));
+        ring.WriteTo(writer);
+        ASSERT_TRUE(writer.Close());
+
+        ProfilingCaptureStreamReader reader;
+        ASSERT_TRUE(reader.Load(filePath)) << reader.GetError().c_str();
+        const auto& frames = reader.GetFrames();
+        ASSERT_EQ(frames.size(), 3);
+        EXPECT_EQ(frames[0].m_frameNumber, 2);
+        EXPECT_EQ(frames[2].m_frameNumber, 4);
+        ASSERT_EQ(frames[2].m_passTimestamps.size(), 2);
+        EXPECT_EQ(reader.GetPassNames()[frames[2].m_passTimestamps[1].m_passIndex], "Root.Shadow");
+    }
+
+    TEST(ProfilingCaptureStreamTest, Parse_RejectsOtherFiles)
+    {
+        AZStd::vector<uint8_t> data(256, uint8_t('x'));
+
+        ProfilingCaptureStreamReader reader;
+        EXPECT_FALSE(reader.Parse(AZStd::move(data)));
+        EXPECT_FALSE(reader.GetError().empty());
+    }
+} // namespace UnitTest
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Performance/SampleSwitchProfiler.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    using Phase = SampleSwitchProfiler::Phase;
+
+    TEST(SampleSwitchProfilerTest, Switch_RecordsEveryPhase)
+    {
+        double nowMs = 0.0;
+        SampleSwitchProfiler profiler([&nowMs]() { return nowMs; });
+
+        profiler.BeginSwitch("RPI/Mesh");
+        nowMs += 1.0;
+        profiler.BeginPhase(Phase::SceneTeardown);
+        nowMs += 2.0;
+        profiler.BeginPhase(Phase::PipelineCreation);
+        nowMs += 4.0;
+        profiler.BeginPhase(Phase::AssetPreload);
+        nowMs += 8.0;
+        profiler.EndSwitchSetup();
+        EXPECT_TRUE(profiler.IsSwitching());
+        nowMs += 16.0;
+        profiler.OnFrameBegin();
+
+        EXPECT_FALSE(profiler.IsSwitching());
+        ASSERT_EQ(1u, profiler.GetRecords().size());
+        const SampleSwitchProfiler::SwitchRecord& record = profiler.GetRecords()[0];
+        EXPECT_EQ("RPI/Mesh", record.m_sampleName);
+        EXPECT_FALSE(record.m_isWarmStart);
+        EXPECT_DOUBLE_EQ(1.0, record.m_phaseMs[static_cast<uint32_t>(Phase::Shutdown)]);
+        EXPECT_DOUBLE_EQ(2.0, record.m_phaseMs[static_cast<uint32_t>(Phase::SceneTeardown)]);
+        EXPECT_DOUBLE_EQ(4.0, record.m_phaseMs[static_cast<uint32_t>(Phase::PipelineCreation)]);
+        EXPECT_DOUBLE_EQ(8.0, record.m_phaseMs[static_cast<uint32_t>(Phase::AssetPreload)]);
+        EXPECT_DOUBLE_EQ(16.0, record.m_phaseMs[static_cast<uint32_t>(Phase::FirstFrame)]);
+        EXPECT_DOUBLE_EQ(31.0, record.m_totalMs);
+    }
+
+    TEST(SampleSwitchProfilerTest, OnFrameBegin_BeforeSetupEnds_KeepsSwitching)
+    {
+        double nowMs = 0.0;
+        SampleSwitchProfiler profiler([&nowMs]() { return nowMs; });
+
+        profiler.OnFrameBegin();
+        EXPECT_TRUE(profiler.GetRecords().empty());
+
+        profiler.BeginSwitch("RPI/Mesh");
+        profiler.SetWarmStart(true);
+        profiler.OnFrameBegin();
+        EXPECT_TRUE(profiler.IsSwitching());
+        EXPECT_TRUE(profiler.GetRecords().empty());
+
+        profiler.EndSwitchSetup();
+        profiler.OnFrameBegin();
+        ASSERT_EQ(1u, profiler.GetRecords().size());
+        EXPECT_TRUE(profiler.GetRecords()[0].m_isWarmStart);
+    }
+
+    TEST(SampleSwitchProfilerTest, BeginSwitch_WhileSwitching_CompletesPreviousSwitch)
+    {
+        double nowMs = 0.0;
+        SampleSwitchProfiler profiler([&nowMs]() { return nowMs; });
+
+        profiler.BeginSwitch("RPI/Mesh");
+        profiler.BeginPhase(Phase::AssetPreload);
+        nowMs += 5.0;
+        profiler.BeginSwitch("Features/Bloom");
+        profiler.SetWarmStart(true);
+        profiler.EndSwitchSetup();
+        nowMs += 3.0;
+        profiler.OnFrameBegin();
+
+        ASSERT_EQ(2u, profiler.GetRecords().size());
+        EXPECT_EQ("RPI/Mesh", profiler.GetRecords()[0].m_sampleName);
+        EXPECT_FALSE(profiler.GetRecords()[0].m_isWarmStart);
+        EXPECT_DOUBLE_EQ(5.0, profiler.GetRecords()[0].m_phaseMs[static_cast<uint32_t>(Phase::AssetPreload)]);
+        EXPECT_DOUBLE_EQ(3.0, profiler.GetRecords()[1].m_totalMs);
+
+        profiler.Reset();
+        EXPECT_TRUE(profiler.GetRecords().empty());
+    }
+} // namespace UnitTest
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Atom/Utils/ImageComparison.h>
+#include <Automation/ScreenshotComparisonEngine.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/vector.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    // Fills two RGBA8 images that mostly match, with small differences on some pixels and large differences on a few.
+    static void GenerateImagePair(uint32_t width, uint32_t height, AZStd::vector<uint8_t>& imageA, AZStd::vector<uint8_t>& imageB)
+    {
+        const size_t size = size_t(width) * height * ImageDiff::BytesPerPixel;
+        imageA.resize(size);
+        imageB.resize(size);
+
+        uint32_t seed = 12345;
+        auto nextRandom = [&seed]()
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 16;
+        };
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            imageA[i] = aznumeric_cast<uint8_t>(nextRandom());
+
+            const uint32_t roll = nextRandom() % 100;
+            if (roll < 80)
+            {
+                imageB[i] = imageA[i];
+            }
+            else if (roll < 98)
+            {
+                imageB[i] = aznumeric_cast<uint8_t>(AZ::GetClamp(int32_t(imageA[i]) + int32_t(nextRandom() % 7) - 3, 0, 255));
+            }
+            else
+            {
+                imageB[i] = aznumeric_cast<uint8_t>(nextRandom());
+            }
+        }
+    }
+
+    TEST(ScreenshotComparisonEngineTest, AccumulateRow_MatchesMaxChannelDifference)
+    {
+        // Odd width so the vectorized kernel also exercises its scalar tail
+        const uint32_t width = 1023;
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, 1, imageA, imageB);
+
+        const uint32_t minPerceptibleDiff = ImageDiff::CalcMinPerceptibleDiff(0.01f);
+
+        uint64_t expectedSumSquares = 0;
+        uint64_t expectedFilteredSumSquares = 0;
+        for (size_t i = 0; i < imageA.size(); i += ImageDiff::BytesPerPixel)
+        {
+            const int16_t maxDiff = AZ::Utils::CalcMaxChannelDifference(imageA, imageB, i);
+            expectedSumSquares += maxDiff * maxDiff;
+            if (maxDiff / 255.0f > 0.01f)
+            {
+                expectedFilteredSumSquares += maxDiff * maxDiff;
+            }
+        }
+
+        ImageDiff::Accumulator vectorized;
+        ImageDiff::AccumulateRow(imageA.data(), imageB.data(), width, minPerceptibleDiff, vectorized);
+
+        ImageDiff::Accumulator scalar;
+        ImageDiff::AccumulateRowScalar(imageA.data(), imageB.data(), width, minPerceptibleDiff, scalar);
+
+        EXPECT_EQ(expectedSumSquares, vectorized.m_sumSquares);
+        EXPECT_EQ(expectedFilteredSumSquares, vectorized.m_filteredSumSquares);
+        EXPECT_EQ(width, vectorized.m_pixelCount);
+
+        EXPECT_EQ(scalar.m_sumSquares, vectorized.m_sumSquares);
+        EXPECT_EQ(scalar.m_filteredSumSquares, vectorized.m_filteredSumSquares);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_IdenticalImages_ScoreZero)
+    {
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(64, 64, imageA, imageB);
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(imageA, imageA, 64, 64, 0.01f);
+        EXPECT_EQ(0.0f, scores.m_diffScore);
+        EXPECT_EQ(0.0f, scores.m_filteredDiffScore);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_OppositeImages_ScoreOne)
+    {
+        const AZStd::vector<uint8_t> black(16 * 16 * ImageDiff::BytesPerPixel, uint8_t(0));
+        const AZStd::vector<uint8_t> white(16 * 16 * ImageDiff::BytesPerPixel, uint8_t(255));
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(black, white, 16, 16, 0.01f);
+        EXPECT_FLOAT_EQ(1.0f, scores.m_diffScore);
+        EXPECT_FLOAT_EQ(1.0f, scores.m_filteredDiffScore);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_ImperceptibleDiffs_Filtered)
+    {
+        AZStd::vector<uint8_t> imageA(8 * 8 * ImageDiff::BytesPerPixel, uint8_t(100));
+        AZStd::vector<uint8_t> imageB = imageA;
+        imageB[0] = 101;
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(imageA, imageB, 8, 8, 0.01f);
+        EXPECT_GT(scores.m_diffScore, 0.0f);
+        EXPECT_EQ(0.0f, scores.m_filteredDiffScore);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_Tiled_MatchesRowByRowScores)
+    {
+        // Neither dimension is a multiple of the tile size, so partial tiles are covered as well
+        const uint32_t width = 203;
+        const uint32_t height = 77;
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, height, imageA, imageB);
+
+        const uint32_t minPerceptibleDiff = ImageDiff::CalcMinPerceptibleDiff(0.01f);
+        ImageDiff::Accumulator expected;
+        for (uint32_t row = 0; row < height; ++row)
+        {
+            const size_t offset = size_t(row) * width * ImageDiff::BytesPerPixel;
+            ImageDiff::AccumulateRowScalar(imageA.data() + offset, imageB.data() + offset, width, minPerceptibleDiff, expected);
+        }
+        const ImageDiff::Scores expectedScores = expected.Resolve();
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(imageA, imageB, width, height, 0.01f);
+        EXPECT_EQ(expectedScores.m_diffScore, scores.m_diffScore);
+        EXPECT_EQ(expectedScores.m_filteredDiffScore, scores.m_filteredDiffScore);
+        EXPECT_EQ(7u * 3u, scores.m_tileCount);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_SingleDifferentPixel_OnlyThatTileDiffers)
+    {
+        AZStd::vector<uint8_t> imageA(100 * 100 * ImageDiff::BytesPerPixel, uint8_t(100));
+        AZStd::vector<uint8_t> imageB = imageA;
+        imageB[(50 * 100 + 70) * ImageDiff::BytesPerPixel] = 200;
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(imageA, imageB, 100, 100, 0.01f, true);
+        EXPECT_EQ(16u, scores.m_tileCount);
+        EXPECT_EQ(1u, scores.m_differingTileCount);
+        EXPECT_GT(scores.m_diffScore, 0.0f);
+        EXPECT_GT(scores.m_perceptualScore, 0.0f);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_Perceptual_IdenticalImagesScoreZero)
+    {
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(64, 64, imageA, imageB);
+
+        const ImageDiff::Scores scores = ImageDiff::CalcScores(imageA, imageA, 64, 64, 0.01f, true);
+        EXPECT_EQ(0.0f, scores.m_perceptualScore);
+        EXPECT_EQ(0u, scores.m_differingTileCount);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcScores_Perceptual_StructuralChangeScoresHigherThanNoise)
+    {
+        // A flat gray image, the same image with faint noise, and the same image with a checkerboard of the same average brightness
+        const uint32_t size = 32;
+        AZStd::vector<uint8_t> flat(size * size * ImageDiff::BytesPerPixel, uint8_t(128));
+        AZStd::vector<uint8_t> noisy = flat;
+        AZStd::vector<uint8_t> checkerboard = flat;
+        for (uint32_t y = 0; y < size; ++y)
+        {
+            for (uint32_t x = 0; x < size; ++x)
+            {
+                const size_t offset = (size_t(y) * size + x) * ImageDiff::BytesPerPixel;
+                for (size_t channel = 0; channel < 3; ++channel)
+                {
+                    noisy[offset + channel] = aznumeric_cast<uint8_t>(128 + ((x * 7 + y * 3 + channel) % 3) - 1);
+                    checkerboard[offset + channel] = ((x + y) % 2) ? 64 : 192;
+                }
+            }
+        }
+
+        const ImageDiff::Scores noiseScores = ImageDiff::CalcScores(flat, noisy, size, size, 0.01f, true);
+        const ImageDiff::Scores structureScores = ImageDiff::CalcScores(flat, checkerboard, size, size, 0.01f, true);
+        EXPECT_LT(noiseScores.m_perceptualScore, 0.01f);
+        EXPECT_GT(structureScores.m_perceptualScore, 10.0f * noiseScores.m_perceptualScore);
+        EXPECT_LE(structureScores.m_perceptualScore, 1.0f);
+    }
+
+    TEST(ScreenshotComparisonEngineTest, CalcMaxChannelDiffs_MatchesMaxChannelDifference)
+    {
+        // Not a multiple of the vector width, so the scalar tail is covered as well
+        const uint32_t width = 1021;
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, 1, imageA, imageB);
+
+        AZStd::vector<uint8_t> maxDiffs(width);
+        ImageDiff::CalcMaxChannelDiffs(imageA.data(), imageB.data(), width, maxDiffs.data());
+
+        for (uint32_t pixel = 0; pixel < width; ++pixel)
+        {
+            EXPECT_EQ(AZ::Utils::CalcMaxChannelDifference(imageA, imageB, pixel * ImageDiff::BytesPerPixel), maxDiffs[pixel]);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Identical screenshots are the common case, and only cost a memcmp of each tile
+    static void BM_ScreenshotComparison_CalcScores_Identical(benchmark::State& state)
+    {
+        const uint32_t width = aznumeric_cast<uint32_t>(state.range(0));
+        const uint32_t height = aznumeric_cast<uint32_t>(state.range(1));
+
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, height, imageA, imageB);
+        imageB = imageA;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(ImageDiff::CalcScores(imageA, imageB, width, height, 0.01f));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * int64_t(imageA.size() + imageB.size()));
+    }
+    BENCHMARK(BM_ScreenshotComparison_CalcScores_Identical)->Args({ 1280, 720 })->Args({ 1920, 1080 })->Unit(benchmark::kMicrosecond);
+
+    // Measures screenshot comparisons per second on the CPU, for the image sizes typically captured by the test suite.
+    static void BM_ScreenshotComparison_CalcScores(benchmark::State& state)
+    {
+        const uint32_t width = aznumeric_cast<uint32_t>(state.range(0));
+        const uint32_t height = aznumeric_cast<uint32_t>(state.range(1));
+
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, height, imageA, imageB);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(ImageDiff::CalcScores(imageA, imageB, width, height, 0.01f));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * int64_t(imageA.size() + imageB.size()));
+    }
+    BENCHMARK(BM_ScreenshotComparison_CalcScores)->Args({ 1280, 720 })->Args({ 1920, 1080 })->Args({ 3840, 2160 })->Unit(benchmark::kMicrosecond);
+
+    // The per-pixel path this engine replaces, kept as a point of comparison.
+    static void BM_ScreenshotComparison_MaxChannelDifferenceLoop(benchmark::State& state)
+    {
+        const uint32_t width = aznumeric_cast<uint32_t>(state.range(0));
+        const uint32_t height = aznumeric_cast<uint32_t>(state.range(1));
+
+        AZStd::vector<uint8_t> imageA;
+        AZStd::vector<uint8_t> imageB;
+        GenerateImagePair(width, height, imageA, imageB);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            float sumSquares = 0.0f;
+            for (size_t i = 0; i < imageA.size(); i += ImageDiff::BytesPerPixel)
+            {
+                const float diff = AZ::Utils::CalcMaxChannelDifference(imageA, imageB, i) / 255.0f;
+                sumSquares += diff * diff;
+            }
+            benchmark::DoNotOptimize(sumSquares);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * int64_t(imageA.size() + imageB.size()));
+    }
+    BENCHMARK(BM_ScreenshotComparison_MaxChannelDifferenceLoop)->Args({ 1280, 720 })->Args({ 1920, 1080 })->Args({ 3840, 2160 })->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Utils/StreamingImageTelemetry.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    TEST(StreamingImageTelemetryTest, GetMipTexelRatio_QuartersPerMip)
+    {
+        EXPECT_FLOAT_EQ(1.0f, StreamingImageTelemetry::GetMipTexelRatio(0));
+        EXPECT_FLOAT_EQ(0.25f, StreamingImageTelemetry::GetMipTexelRatio(1));
+        EXPECT_FLOAT_EQ(1.0f / 64.0f, StreamingImageTelemetry::GetMipTexelRatio(3));
+    }
+
+    TEST(StreamingImageTelemetryTest, ImageEvents_RecordFirstTimeOnly)
+    {
+        StreamingImageTelemetry telemetry;
+        telemetry.Start();
+
+        const uint32_t first = telemetry.AddImage("streaming0.dds.streamingimage", 0.0);
+        const uint32_t second = telemetry.AddImage("streaming1.dds.streamingimage", 10.0);
+
+        telemetry.OnFirstMipResident(first, 5.0);
+        telemetry.OnFirstMipResident(first, 50.0);
+        telemetry.OnFullyResident(first, 100.0, 1024);
+        telemetry.OnFullyResident(first, 200.0, 2048);
+        EXPECT_TRUE(telemetry.IsFullyResident(first));
+        EXPECT_FALSE(telemetry.IsFullyResident(second));
+        EXPECT_FALSE(telemetry.IsFullyResident(7));
+
+        const StreamingImageTelemetry::ImageTimings& image = telemetry.GetImages()[first];
+        EXPECT_DOUBLE_EQ(5.0, image.m_firstMipMs);
+        EXPECT_DOUBLE_EQ(100.0, image.m_fullyResidentMs);
+        EXPECT_EQ(1024u, image.m_assetBytes);
+        EXPECT_LT(telemetry.GetImages()[second].m_firstMipMs, 0.0);
+    }
+
+    TEST(StreamingImageTelemetryTest, GetThroughputMBps_UsesLastFullyResidentImage)
+    {
+        StreamingImageTelemetry telemetry;
+        telemetry.Start();
+        EXPECT_DOUBLE_EQ(0.0, telemetry.GetThroughputMBps());
+
+        const uint32_t first = telemetry.AddImage("a", 0.0);
+        const uint32_t second = telemetry.AddImage("b", 0.0);
+        telemetry.AddImage("c", 0.0);
+        telemetry.OnFullyResident(first, 500.0, 1024 * 1024);
+        telemetry.OnFullyResident(second, 2000.0, 3 * 1024 * 1024);
+
+        EXPECT_DOUBLE_EQ(2000.0, telemetry.GetStreamingDurationMs());
+        EXPECT_DOUBLE_EQ(2.0, telemetry.GetThroughputMBps());
+    }
+
+    TEST(StreamingImageTelemetryTest, GetTimeToUsefulFrameMs_WaitsForPriorityFraction)
+    {
+        StreamingImageTelemetry telemetry;
+        telemetry.Start();
+
+        const uint32_t important = telemetry.AddImage("center", 0.0, 8.0f);
+        const uint32_t minor = telemetry.AddImage("corner", 0.0, 1.0f);
+        const uint32_t other = telemetry.AddImage("edge", 0.0, 1.0f);
+        EXPECT_LT(telemetry.GetTimeToUsefulFrameMs(0.8f), 0.0);
+
+        telemetry.OnFirstMipResident(minor, 10.0);
+        telemetry.OnFirstMipResident(other, 20.0);
+        EXPECT_LT(telemetry.GetTimeToUsefulFrameMs(0.8f), 0.0);
+
+        // 9 of the total 10 priority is visible once the center image shows up
+        telemetry.OnFirstMipResident(important, 50.0);
+        EXPECT_DOUBLE_EQ(50.0, telemetry.GetTimeToUsefulFrameMs(0.8f));
+        EXPECT_DOUBLE_EQ(10.0, telemetry.GetTimeToUsefulFrameMs(0.1f));
+    }
+
+    TEST(StreamingImageTelemetryTest, SampleMemory_RespectsInterval)
+    {
+        StreamingImageTelemetry telemetry;
+        telemetry.Start(100.0);
+
+        telemetry.SampleMemory(0.0, 1, 2);
+        telemetry.SampleMemory(50.0, 3, 4);
+        telemetry.SampleMemory(100.0, 5, 6);
+        telemetry.SampleMemory(150.0, 7, 8);
+
+        ASSERT_EQ(2u, telemetry.GetMemorySamples().size());
+        EXPECT_EQ(1u, telemetry.GetMemorySamples()[0].m_usedBytes);
+        EXPECT_EQ(5u, telemetry.GetMemorySamples()[1].m_usedBytes);
+        EXPECT_EQ(6u, telemetry.GetMemorySamples()[1].m_allocatedBytes);
+
+        telemetry.Start();
+        EXPECT_TRUE(telemetry.GetMemorySamples().empty());
+        EXPECT_TRUE(telemetry.GetImages().empty());
+    }
+} // namespace UnitTest
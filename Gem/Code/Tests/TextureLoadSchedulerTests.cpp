@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Performance/TextureLoadScheduler.h>
+
+namespace UnitTest
+{
+    using namespace AtomSampleViewer;
+
+    namespace
+    {
+        AZStd::vector<uint32_t> IssueAll(TextureLoadScheduler& scheduler)
+        {
+            AZStd::vector<uint32_t> issued;
+            while (!scheduler.IsIdle())
+            {
+                AZStd::vector<uint32_t> issuedThisFrame;
+                scheduler.Update([&issuedThisFrame](uint32_t requestId) { issuedThisFrame.push_back(requestId); });
+                for (uint32_t requestId : issuedThisFrame)
+                {
+                    scheduler.OnLoadFinished(requestId);
+                    issued.push_back(requestId);
+                }
+            }
+            return issued;
+        }
+    }
+
+    TEST(TextureLoadSchedulerTest, ComputePriority_PrefersLargeAndNearImages)
+    {
+        EXPECT_GT(TextureLoadScheduler::ComputePriority(2.0f, 1.0f), TextureLoadScheduler::ComputePriority(1.0f, 1.0f));
+        EXPECT_GT(TextureLoadScheduler::ComputePriority(1.0f, 1.0f), TextureLoadScheduler::ComputePriority(1.0f, 2.0f));
+        EXPECT_GT(TextureLoadScheduler::ComputePriority(1.0f, 0.0f), 0.0f);
+    }
+
+    TEST(TextureLoadSchedulerTest, Update_FifoKeepsQueueOrder)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetPolicy(TextureLoadScheduler::Policy::Fifo);
+        scheduler.Enqueue(0, 1.0f, 10);
+        scheduler.Enqueue(1, 5.0f, 10);
+        scheduler.Enqueue(2, 3.0f, 10);
+
+        const AZStd::vector<uint32_t> issued = IssueAll(scheduler);
+        ASSERT_EQ(3u, issued.size());
+        EXPECT_EQ(0u, issued[0]);
+        EXPECT_EQ(1u, issued[1]);
+        EXPECT_EQ(2u, issued[2]);
+    }
+
+    TEST(TextureLoadSchedulerTest, Update_PrioritizedIssuesHighestFirst)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetPolicy(TextureLoadScheduler::Policy::Prioritized);
+        scheduler.Enqueue(0, 1.0f, 10);
+        scheduler.Enqueue(1, 5.0f, 10);
+        scheduler.Enqueue(2, 3.0f, 10);
+        scheduler.Enqueue(3, 5.0f, 10);
+
+        const AZStd::vector<uint32_t> issued = IssueAll(scheduler);
+        ASSERT_EQ(4u, issued.size());
+        EXPECT_EQ(1u, issued[0]);
+        // Ties keep the queue order
+        EXPECT_EQ(3u, issued[1]);
+        EXPECT_EQ(2u, issued[2]);
+        EXPECT_EQ(0u, issued[3]);
+    }
+
+    TEST(TextureLoadSchedulerTest, SetPolicy_ReordersQueuedRequests)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetPolicy(TextureLoadScheduler::Policy::Fifo);
+        scheduler.Enqueue(0, 1.0f, 10);
+        scheduler.Enqueue(1, 5.0f, 10);
+        scheduler.SetPolicy(TextureLoadScheduler::Policy::Prioritized);
+
+        const AZStd::vector<uint32_t> issued = IssueAll(scheduler);
+        ASSERT_EQ(2u, issued.size());
+        EXPECT_EQ(1u, issued[0]);
+    }
+
+    TEST(TextureLoadSchedulerTest, Update_RespectsInFlightLimit)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetMaxInFlightLoads(2);
+        for (uint32_t requestId = 0; requestId < 5; ++requestId)
+        {
+            scheduler.Enqueue(requestId, 1.0f, 10);
+        }
+
+        AZStd::vector<uint32_t> issued;
+        const auto issue = [&issued](uint32_t requestId) { issued.push_back(requestId); };
+        EXPECT_EQ(2u, scheduler.Update(issue));
+        EXPECT_EQ(0u, scheduler.Update(issue));
+        EXPECT_EQ(2u, scheduler.GetInFlightCount());
+
+        scheduler.OnLoadFinished(issued[0]);
+        EXPECT_EQ(1u, scheduler.Update(issue));
+        EXPECT_EQ(2u, scheduler.GetQueuedCount());
+    }
+
+    TEST(TextureLoadSchedulerTest, Update_RespectsBytesPerFrame)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetMaxInFlightLoads(100);
+        scheduler.SetMaxBytesPerFrame(250);
+        for (uint32_t requestId = 0; requestId < 5; ++requestId)
+        {
+            scheduler.Enqueue(requestId, 1.0f, 100);
+        }
+
+        const auto issue = [](uint32_t) {};
+        EXPECT_EQ(2u, scheduler.Update(issue));
+        EXPECT_EQ(2u, scheduler.Update(issue));
+        EXPECT_EQ(1u, scheduler.Update(issue));
+    }
+
+    TEST(TextureLoadSchedulerTest, Update_IssuesOversizedLoadWhenNothingInFlight)
+    {
+        TextureLoadScheduler scheduler;
+        scheduler.SetMaxBytesPerFrame(100);
+        scheduler.Enqueue(0, 1.0f, 1000);
+        scheduler.Enqueue(1, 1.0f, 1000);
+
+        const auto issue = [](uint32_t) {};
+        EXPECT_EQ(1u, scheduler.Update(issue));
+        // The first load is still in flight, so the second one waits for it
+        EXPECT_EQ(0u, scheduler.Update(issue));
+        scheduler.OnLoadFinished(0);
+        EXPECT_EQ(1u, scheduler.Update(issue));
+        EXPECT_TRUE(scheduler.GetQueuedCount() == 0);
+
+        scheduler.Clear();
+        EXPECT_TRUE(scheduler.IsIdle());
+    }
+} // namespace UnitTest
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Compares two result folders written by _AutomatedPeriodicBenchmarkSuite_.bv.lua and reports the passes and samples that
+// got significantly slower. Runs offline on previously captured data, nothing here needs a GPU or the application.
+//
+// Each result folder holds one sub-folder per sample, with either a profiling_capture.asvpcap stream or the older
+// frameN_timestamps.json and cpu_frameN_time.json files. Passes are matched by name. When either run only has the older
+// files, which store pass names without their path, both runs are matched by pass name and same-named passes are summed per frame.
+//
+// Exit codes: 0 when nothing regressed, 1 for usage or load errors, 2 when at least one series regressed.
+
+#include <Automation/BenchmarkComparison.h>
+#include <Automation/ProfilingCaptureStream.h>
+#include <Utils/JsonFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace AtomSampleViewer
+{
+    namespace BenchmarkRegressionComparator
+    {
+        constexpr const char* ProfilingCaptureFileName = "profiling_capture.asvpcap";
+        constexpr const char* CpuFrameTimeSeriesName = "CPU frame time";
+
+        enum ExitCode
+        {
+            Success = 0,
+            Error = 1,
+            Regression = 2
+        };
+
+        //! Per-frame values of every series of one sample, in milliseconds
+        struct SampleCapture
+        {
+            AZStd::vector<double> m_cpuFrameTimes;
+            AZStd::map<AZStd::string, AZStd::vector<double>> m_passTimes;
+        };
+
+        void PrintUsage()
+        {
+            printf(
+                "Usage: BenchmarkRegressionComparator <baseline folder> <candidate folder> [options]\n"
+                "  --significance <p>       Largest p-value that counts as significant, defaults to 0.01\n"
+                "  --min-change <percent>   Smallest change of the median that is reported, defaults to 5\n"
+                "  --min-duration <ms>      Ignores passes whose baseline median is shorter, defaults to 0.05\n"
+                "  --iterations <count>     Bootstrap iterations, defaults to 2000\n"
+                "  --output <file>          Also writes the report to this file\n"
+                "  --verbose                Lists every series, not only the ones that changed\n");
+        }
+
+        AZStd::string GetLeafPassName(AZStd::string_view passPath)
+        {
+            const size_t separator = passPath.rfind('.');
+            return AZStd::string(separator == AZStd::string_view::npos ? passPath : passPath.substr(separator + 1));
+        }
+
+        bool ReadTextFile(const AZStd::string& filePath, AZStd::string& contents)
+        {
+            const uint64_t fileSize = AZ::IO::SystemFile::Length(filePath.c_str());
+            if (fileSize == 0)
+            {
+                return false;
+            }
+
+            contents.resize(fileSize);
+            return AZ::IO::SystemFile::Read(filePath.c_str(), contents.data(), fileSize) == fileSize;
+        }
+
+        bool HasProfilingCaptureStream(const AZStd::string& sampleFolder)
+        {
+            return AZ::IO::SystemFile::Exists(AZStd::string::format("%s/%s", sampleFolder.c_str(), ProfilingCaptureFileName).c_str());
+        }
+
+        // Same-named passes are summed so a frame contributes one value per name
+        void AppendFramePassTimes(SampleCapture& capture, const AZStd::map<AZStd::string, double>& framePassTimes)
+        {
+            for (const auto& [passName, milliseconds] : framePassTimes)
+            {
+                capture.m_passTimes[passName].push_back(milliseconds);
+            }
+        }
+
+        bool LoadProfilingCaptureStream(const AZStd::string& sampleFolder, bool useLeafPassNames, SampleCapture& capture)
+        {
+            const AZStd::string filePath = AZStd::string::format("%s/%s", sampleFolder.c_str(), ProfilingCaptureFileName);
+
+            ProfilingCaptureStreamReader reader;
+            if (!reader.Load(filePath))
+            {
+                fprintf(stderr, "%s\n", reader.GetError().c_str());
+                return false;
+            }
+
+            if (!reader.IsComplete())
+            {
+                fprintf(stderr, "Warning: '%s' was not closed properly, only its %zu complete frames are compared\n",
+                    filePath.c_str(), reader.GetFrames().size());
+            }
+
+            AZStd::vector<AZStd::string> passNames;
+            passNames.reserve(reader.GetPassNames().size());
+            for (const AZStd::string& passName : reader.GetPassNames())
+            {
+                passNames.push_back(useLeafPassNames ? GetLeafPassName(passName) : passName);
+            }
+
+            AZStd::map<AZStd::string, double> framePassTimes;
+            for (const ProfilingCaptureStreamReader::Frame& frame : reader.GetFrames())
+            {
+                capture.m_cpuFrameTimes.push_back(frame.m_cpuFrameTime);
+
+                framePassTimes.clear();
+                for (const auto& timestamp : frame.m_passTimestamps)
+                {
+                    framePassTimes[passNames[timestamp.m_passIndex]] += timestamp.m_durationInNanoseconds / 1000000.0;
+                }
+                AppendFramePassTimes(capture, framePassTimes);
+            }
+
+            return true;
+        }
+
+        bool LoadLegacyFrameFiles(const AZStd::string& sampleFolder, SampleCapture& capture)
+        {
+            AZStd::map<AZStd::string, double> framePassTimes;
+            AZStd::string contents;
+
+            // The suite numbers the files from 1 and stops at the first missing one
+            for (int fileNumber = 1;; ++fileNumber)
+            {
+                const AZStd::string timestampsPath = AZStd::string::format("%s/frame%d_timestamps.json", sampleFolder.c_str(), fileNumber);
+                const AZStd::string cpuFrameTimePath = AZStd::string::format("%s/cpu_frame%d_time.json", sampleFolder.c_str(), fileNumber);
+                const bool hasTimestamps = AZ::IO::SystemFile::Exists(timestampsPath.c_str());
+                const bool hasCpuFrameTime = AZ::IO::SystemFile::Exists(cpuFrameTimePath.c_str());
+                if (!hasTimestamps && !hasCpuFrameTime)
+                {
+                    break;
+                }
+
+                if (hasTimestamps && ReadTextFile(timestampsPath, contents))
+                {
+                    rapidjson::Document document;
+                    document.Parse(contents.c_str());
+                    if (document.HasParseError() || !document.IsObject() || !document.HasMember("ClassData"))
+                    {
+                        fprintf(stderr, "Failed to parse '%s'\n", timestampsPath.c_str());
+                        return false;
+                    }
+
+                    const rapidjson::Value& classData = document["ClassData"];
+                    if (classData.IsObject() && classData.HasMember("timestampEntries") && classData["timestampEntries"].IsArray())
+                    {
+                        framePassTimes.clear();
+                        for (const rapidjson::Value& entry : classData["timestampEntries"].GetArray())
+                        {
+                            if (entry.HasMember("passName") && entry["passName"].IsString() &&
+                                entry.HasMember("timestampResultInNanoseconds") && entry["timestampResultInNanoseconds"].IsNumber())
+                            {
+                                framePassTimes[entry["passName"].GetString()] += entry["timestampResultInNanoseconds"].GetDouble() / 1000000.0;
+                            }
+                        }
+                        AppendFramePassTimes(capture, framePassTimes);
+                    }
+                }
+
+                if (hasCpuFrameTime && ReadTextFile(cpuFrameTimePath, contents))
+                {
+                    rapidjson::Document document;
+                    document.Parse(contents.c_str());
+                    if (document.HasParseError() || !document.IsObject() || !document.HasMember("ClassData"))
+                    {
+                        fprintf(stderr, "Failed to parse '%s'\n", cpuFrameTimePath.c_str());
+                        return false;
+                    }
+
+                    const rapidjson::Value& classData = document["ClassData"];
+                    if (classData.IsObject() && classData.HasMember("frameTime") && classData["frameTime"].IsNumber())
+                    {
+                        capture.m_cpuFrameTimes.push_back(classData["frameTime"].GetDouble());
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        AZStd::vector<AZStd::string> FindSampleFolders(const AZStd::string& resultFolder)
+        {
+            AZStd::vector<AZStd::string> sampleNames;
+            AZ::IO::SystemFile::FindFiles(AZStd::string::format("%s/*", resultFolder.c_str()).c_str(),
+                [&sampleNames](const char* fileName, bool isFile)
+                {
+                    const AZStd::string_view name = fileName;
+                    if (!isFile && name != "." && name != "..")
+                    {
+                        sampleNames.push_back(fileName);
+                    }
+                    return true;
+                });
+            AZStd::sort(sampleNames.begin(), sampleNames.end());
+            return sampleNames;
+        }
+
+        class Report
+        {
+        public:
+            void Print(const char* format, ...)
+            {
+                va_list args;
+                va_start(args, format);
+                const AZStd::string text = AZStd::string::format_arg(format, args);
+                va_end(args);
+
+                fputs(text.c_str(), stdout);
+                m_text += text;
+            }
+
+            const AZStd::string& GetText() const { return m_text; }
+
+        private:
+            AZStd::string m_text;
+        };
+
+        void PrintComparison(Report& report, const BenchmarkComparison::SeriesComparison& comparison)
+        {
+            report.Print("    %-17s %-48s %9.3f -> %9.3f ms  %+7.2f%%  [%+.2f%%, %+.2f%%]  p=%.2g  (n=%zu/%zu)\n",
+                BenchmarkComparison::ToString(comparison.m_verdict), comparison.m_name.c_str(),
+                comparison.m_baselineMedian, comparison.m_candidateMedian,
+                (comparison.m_medianRatio.m_estimate - 1.0) * 100.0,
+                (comparison.m_medianRatio.m_lower - 1.0) * 100.0, (comparison.m_medianRatio.m_upper - 1.0) * 100.0,
+                comparison.m_mannWhitney.m_pValue, comparison.m_baselineCount, comparison.m_candidateCount);
+        }
+
+        int Run(int argc, char** argv)
+        {
+            AZStd::string baselineFolder;
+            AZStd::string candidateFolder;
+            AZStd::string outputPath;
+            double minimumDuration = 0.05;
+            bool verbose = false;
+            BenchmarkComparison::Settings settings;
+
+            for (int i = 1; i < argc; ++i)
+            {
+                const AZStd::string_view arg = argv[i];
+                if (arg == "--significance" && i + 1 < argc)
+                {
+                    settings.m_significanceLevel = AZStd::stod(AZStd::string(argv[++i]));
+                }
+                else if (arg == "--min-change" && i + 1 < argc)
+                {
+                    settings.m_minimumRelativeChange = AZStd::stod(AZStd::string(argv[++i])) / 100.0;
+                }
+                else if (arg == "--min-duration" && i + 1 < argc)
+                {
+                    minimumDuration = AZStd::stod(AZStd::string(argv[++i]));
+                }
+                else if (arg == "--iterations" && i + 1 < argc)
+                {
+                    settings.m_bootstrapIterations = static_cast<uint32_t>(AZStd::stoul(AZStd::string(argv[++i])));
+                }
+                else if (arg == "--output" && i + 1 < argc)
+                {
+                    outputPath = argv[++i];
+                }
+                else if (arg == "--verbose")
+                {
+                    verbose = true;
+                }
+                else if (baselineFolder.empty() && !arg.starts_with("--"))
+                {
+                    baselineFolder = arg;
+                }
+                else if (candidateFolder.empty() && !arg.starts_with("--"))
+                {
+                    candidateFolder = arg;
+                }
+                else
+                {
+                    PrintUsage();
+                    return Error;
+                }
+            }
+
+            if (baselineFolder.empty() || candidateFolder.empty())
+            {
+                PrintUsage();
+                return Error;
+            }
+
+            const AZStd::vector<AZStd::string> baselineSamples = FindSampleFolders(baselineFolder);
+            const AZStd::vector<AZStd::string> candidateSamples = FindSampleFolders(candidateFolder);
+
+            Report report;
+            report.Print("Baseline:  %s\nCandidate: %s\n", baselineFolder.c_str(), candidateFolder.c_str());
+            report.Print("Medians in ms, change of the median with its %.0f%% bootstrap interval, Mann-Whitney p-value\n\n",
+                settings.m_confidenceLevel * 100.0);
+
+            size_t comparedSampleCount = 0;
+            size_t regressedSeriesCount = 0;
+            size_t improvedSeriesCount = 0;
+            AZStd::vector<AZStd::string> regressedSamples;
+
+            for (const AZStd::string& sampleName : baselineSamples)
+            {
+                if (AZStd::find(candidateSamples.begin(), candidateSamples.end(), sampleName) == candidateSamples.end())
+                {
+                    report.Print("%s: missing from the candidate run\n\n", sampleName.c_str());
+                    continue;
+                }
+
+                const AZStd::string baselineSampleFolder = AZStd::string::format("%s/%s", baselineFolder.c_str(), sampleName.c_str());
+                const AZStd::string candidateSampleFolder = AZStd::string::format("%s/%s", candidateFolder.c_str(), sampleName.c_str());
+                const bool baselineHasStream = HasProfilingCaptureStream(baselineSampleFolder);
+                const bool candidateHasStream = HasProfilingCaptureStream(candidateSampleFolder);
+                const bool useLeafPassNames = !baselineHasStream || !candidateHasStream;
+
+                SampleCapture baseline;
+                SampleCapture candidate;
+                const bool loaded =
+                    (baselineHasStream ? LoadProfilingCaptureStream(baselineSampleFolder, useLeafPassNames, baseline) : LoadLegacyFrameFiles(baselineSampleFolder, baseline)) &&
+                    (candidateHasStream ? LoadProfilingCaptureStream(candidateSampleFolder, useLeafPassNames, candidate) : LoadLegacyFrameFiles(candidateSampleFolder, candidate));
+                if (!loaded)
+                {
+                    return Error;
+                }
+
+                if (baseline.m_cpuFrameTimes.empty() && baseline.m_passTimes.empty())
+                {
+                    // Not a sample folder
+                    continue;
+                }
+
+                ++comparedSampleCount;
+                report.Print("%s:\n", sampleName.c_str());
+
+                AZStd::vector<BenchmarkComparison::SeriesComparison> comparisons;
+                comparisons.push_back(BenchmarkComparison::CompareSeries(CpuFrameTimeSeriesName, baseline.m_cpuFrameTimes, candidate.m_cpuFrameTimes, settings));
+
+                for (const auto& [passName, baselineTimes] : baseline.m_passTimes)
+                {
+                    auto candidateTimes = candidate.m_passTimes.find(passName);
+                    if (candidateTimes == candidate.m_passTimes.end())
+                    {
+                        report.Print("    %-17s %s\n", "removed", passName.c_str());
+                        continue;
+                    }
+
+                    BenchmarkComparison::SeriesComparison comparison =
+                        BenchmarkComparison::CompareSeries(passName, baselineTimes, candidateTimes->second, settings);
+
+                    // Very short passes are dominated by timer resolution, a fraction of a microsecond looks like a large relative change
+                    if (comparison.m_baselineMedian >= minimumDuration)
+                    {
+                        comparisons.push_back(AZStd::move(comparison));
+                    }
+                }
+
+                for (const auto& [passName, candidateTimes] : candidate.m_passTimes)
+                {
+                    if (baseline.m_passTimes.find(passName) == baseline.m_passTimes.end())
+                    {
+                        report.Print("    %-17s %s\n", "added", passName.c_str());
+                    }
+                }
+
+                bool sampleRegressed = false;
+                for (const BenchmarkComparison::SeriesComparison& comparison : comparisons)
+                {
+                    switch (comparison.m_verdict)
+                    {
+                    case BenchmarkComparison::Verdict::Regressed:
+                        ++regressedSeriesCount;
+                        sampleRegressed = true;
+                        break;
+                    case BenchmarkComparison::Verdict::Improved:
+                        ++improvedSeriesCount;
+                        break;
+                    default:
+                        if (!verbose)
+                        {
+                            continue;
+                        }
+                        break;
+                    }
+                    PrintComparison(report, comparison);
+                }
+
+                if (sampleRegressed)
+                {
+                    regressedSamples.push_back(sampleName);
+                }
+                report.Print("\n");
+            }
+
+            for (const AZStd::string& sampleName : candidateSamples)
+            {
+                if (AZStd::find(baselineSamples.begin(), baselineSamples.end(), sampleName) == baselineSamples.end())
+                {
+                    report.Print("%s: missing from the baseline run\n\n", sampleName.c_str());
+                }
+            }
+
+            report.Print("Compared %zu samples: %zu series regressed, %zu improved\n", comparedSampleCount, regressedSeriesCount, improvedSeriesCount);
+            for (const AZStd::string& sampleName : regressedSamples)
+            {
+                report.Print("Regressed sample: %s\n", sampleName.c_str());
+            }
+
+            if (!outputPath.empty())
+            {
+                const AZStd::string& text = report.GetText();
+                if (!Utils::WriteFile(outputPath, text.data(), text.size()))
+                {
+                    fprintf(stderr, "Failed to write '%s'\n", outputPath.c_str());
+                    return Error;
+                }
+            }
+
+            if (comparedSampleCount == 0)
+            {
+                fprintf(stderr, "No sample results were found in both folders\n");
+                return Error;
+            }
+
+            return regressedSeriesCount > 0 ? Regression : Success;
+        }
+    } // namespace BenchmarkRegressionComparator
+} // namespace AtomSampleViewer
+
+int main(int argc, char** argv)
+{
+    return AtomSampleViewer::BenchmarkRegressionComparator::Run(argc, argv);
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// Converts a profiling capture stream written by ScriptManager's BeginProfilingCaptureStream() into text formats.
+//
+//   csv    - one row per pass per frame: frame,cpuFrameTime,pass,durationInNanoseconds
+//   json   - a single document with the pass names and every frame
+//   legacy - a folder with frameN_timestamps.json and cpu_frameN_time.json files, in the same layout as
+//            CapturePassTimestamp() and CaptureCpuFrameTime(), for tools that still read the per-frame files
+
+#include <Automation/ProfilingCaptureStream.h>
+#include <Utils/JsonFile.h>
+
+#include <stdio.h>
+
+namespace AtomSampleViewer
+{
+    namespace ProfilingCaptureConverter
+    {
+        void PrintUsage()
+        {
+            printf(
+                "Usage: ProfilingCaptureConverter <capture file> [--format csv|json|legacy] [--output <path>]\n"
+                "  --format  Output format, defaults to csv\n"
+                "  --output  Output file (csv, json) or folder (legacy). Defaults to the capture file path with a new extension,\n"
+                "            or the folder that contains the capture file for legacy. Use - to write csv or json to stdout.\n");
+        }
+
+        void AppendJsonString(AZStd::string& output, AZStd::string_view value)
+        {
+            output += '"';
+            for (char c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    output += '\\';
+                }
+                output += c;
+            }
+            output += '"';
+        }
+
+        // Atom writes the pass name rather than the full pass path in the per-frame timestamp files
+        AZStd::string_view GetLeafPassName(AZStd::string_view passPath)
+        {
+            const size_t separator = passPath.rfind('.');
+            return separator == AZStd::string_view::npos ? passPath : passPath.substr(separator + 1);
+        }
+
+        bool WriteFile(const AZStd::string& filePath, const AZStd::string& contents)
+        {
+            if (filePath == "-")
+            {
+                fwrite(contents.data(), 1, contents.size(), stdout);
+                return true;
+            }
+
+            if (!Utils::WriteFile(filePath, contents.data(), contents.size()))
+            {
+                fprintf(stderr, "Failed to write '%s'\n", filePath.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        AZStd::string ConvertToCsv(const ProfilingCaptureStreamReader& reader)
+        {
+            const auto& passNames = reader.GetPassNames();
+
+            AZStd::string output = "frame,cpuFrameTime,pass,durationInNanoseconds\n";
+            for (const ProfilingCaptureStreamReader::Frame& frame : reader.GetFrames())
+            {
+                for (const auto& timestamp : frame.m_passTimestamps)
+                {
+                    output += AZStd::string::format("%llu,%.6f,%s,%llu\n",
+                        static_cast<unsigned long long>(frame.m_frameNumber), frame.m_cpuFrameTime,
+                        passNames[timestamp.m_passIndex].c_str(), static_cast<unsigned long long>(timestamp.m_durationInNanoseconds));
+                }
+            }
+            return output;
+        }
+
+        AZStd::string ConvertToJson(const ProfilingCaptureStreamReader& reader)
+        {
+            const auto& passNames = reader.GetPassNames();
+
+            AZStd::string output = "{\n    \"captureName\": ";
+            AppendJsonString(output, reader.GetCaptureName());
+            output += AZStd::string::format(",\n    \"complete\": %s,\n    \"passNames\": [", reader.IsComplete() ? "true" : "false");
+            for (size_t i = 0; i < passNames.size(); ++i)
+            {
+                output += i == 0 ? "\n        " : ",\n        ";
+                AppendJsonString(output, passNames[i]);
+            }
+            output += "\n    ],\n    \"frames\": [";
+
+            bool firstFrame = true;
+            for (const ProfilingCaptureStreamReader::Frame& frame : reader.GetFrames())
+            {
+                output += firstFrame ? "\n        {" : ",\n        {";
+                firstFrame = false;
+
+                output += AZStd::string::format("\"frame\": %llu, \"cpuFrameTime\": %.6f, \"passIndices\": [",
+                    static_cast<unsigned long long>(frame.m_frameNumber), frame.m_cpuFrameTime);
+                for (size_t i = 0; i < frame.m_passTimestamps.size(); ++i)
+                {
+                    output += AZStd::string::format(i == 0 ? "%u" : ", %u", frame.m_passTimestamps[i].m_passIndex);
+                }
+                output += "], \"durationsInNanoseconds\": [";
+                for (size_t i = 0; i < frame.m_passTimestamps.size(); ++i)
+                {
+                    output += AZStd::string::format(i == 0 ? "%llu" : ", %llu", static_cast<unsigned long long>(frame.m_passTimestamps[i].m_durationInNanoseconds));
+                }
+                output += "]}";
+            }
+            output += "\n    ]\n}\n";
+            return output;
+        }
+
+        bool ConvertToLegacyFiles(const ProfilingCaptureStreamReader& reader, const AZStd::string& outputFolder)
+        {
+            const auto& passNames = reader.GetPassNames();
+
+            // Legacy files are numbered from 1, matching _AutomatedPeriodicBenchmarkSuite_.bv.lua
+            int fileNumber = 1;
+            for (const ProfilingCaptureStreamReader::Frame& frame : reader.GetFrames())
+            {
+                AZStd::string timestamps =
+                    "{\n"
+                    "    \"Type\": \"JsonSerialization\",\n"
+                    "    \"Version\": 1,\n"
+                    "    \"ClassName\": \"TimestampSerializer\",\n"
+                    "    \"ClassData\": {\n"
+                    "        \"timestampEntries\": [";
+                for (size_t i = 0; i < frame.m_passTimestamps.size(); ++i)
+                {
+                    const auto& timestamp = frame.m_passTimestamps[i];
+                    timestamps += i == 0 ? "\n            {\n                \"passName\": " : ",\n            {\n                \"passName\": ";
+                    AppendJsonString(timestamps, GetLeafPassName(passNames[timestamp.m_passIndex]));
+                    timestamps += AZStd::string::format(",\n                \"timestampResultInNanoseconds\": %llu\n            }",
+                        static_cast<unsigned long long>(timestamp.m_durationInNanoseconds));
+                }
+                timestamps += "\n        ]\n    }\n}\n";
+
+                const AZStd::string cpuFrameTime = AZStd::string::format(
+                    "{\n"
+                    "    \"Type\": \"JsonSerialization\",\n"
+                    "    \"Version\": 1,\n"
+                    "    \"ClassName\": \"CpuFrameTimeSerializer\",\n"
+                    "    \"ClassData\": {\n"
+                    "        \"frameTime\": %.17g\n"
+                    "    }\n"
+                    "}\n", frame.m_cpuFrameTime);
+
+                if (!WriteFile(AZStd::string::format("%s/frame%d_timestamps.json", outputFolder.c_str(), fileNumber), timestamps) ||
+                    !WriteFile(AZStd::string::format("%s/cpu_frame%d_time.json", outputFolder.c_str(), fileNumber), cpuFrameTime))
+                {
+                    return false;
+                }
+
+                ++fileNumber;
+            }
+
+            return true;
+        }
+
+        AZStd::string ReplaceExtension(const AZStd::string& filePath, const char* extension)
+        {
+            const size_t separator = filePath.find_last_of("/\\");
+            const size_t dot = filePath.rfind('.');
+            const bool hasExtension = dot != AZStd::string::npos && (separator == AZStd::string::npos || dot > separator);
+            return (hasExtension ? filePath.substr(0, dot) : filePath) + extension;
+        }
+
+        AZStd::string GetParentFolder(const AZStd::string& filePath)
+        {
+            const size_t separator = filePath.find_last_of("/\\");
+            return separator == AZStd::string::npos ? AZStd::string(".") : filePath.substr(0, separator);
+        }
+
+        int Run(int argc, char** argv)
+        {
+            AZStd::string inputPath;
+            AZStd::string outputPath;
+            AZStd::string format = "csv";
+
+            for (int i = 1; i < argc; ++i)
+            {
+                const AZStd::string_view arg = argv[i];
+                if (arg == "--format" && i + 1 < argc)
+                {
+                    format = argv[++i];
+                }
+                else if (arg == "--output" && i + 1 < argc)
+                {
+                    outputPath = argv[++i];
+                }
+                else if (inputPath.empty() && !arg.starts_with("--"))
+                {
+                    inputPath = arg;
+                }
+                else
+                {
+                    PrintUsage();
+                    return 1;
+                }
+            }
+
+            if (inputPath.empty() || (format != "csv" && format != "json" && format != "legacy"))
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            ProfilingCaptureStreamReader reader;
+            if (!reader.Load(inputPath))
+            {
+                fprintf(stderr, "%s\n", reader.GetError().c_str());
+                return 1;
+            }
+
+            if (!reader.IsComplete())
+            {
+                fprintf(stderr, "Warning: '%s' was not closed properly, only the %zu complete frames will be converted\n",
+                    inputPath.c_str(), reader.GetFrames().size());
+            }
+
+            if (format == "legacy")
+            {
+                return ConvertToLegacyFiles(reader, outputPath.empty() ? GetParentFolder(inputPath) : outputPath) ? 0 : 1;
+            }
+
+            if (outputPath.empty())
+            {
+                outputPath = ReplaceExtension(inputPath, format == "csv" ? ".csv" : ".json");
+            }
+
+            return WriteFile(outputPath, format == "csv" ? ConvertToCsv(reader) : ConvertToJson(reader)) ? 0 : 1;
+        }
+    } // namespace ProfilingCaptureConverter
+} // namespace AtomSampleViewer
+
+int main(int argc, char** argv)
+{
+    return AtomSampleViewer::ProfilingCaptureConverter::Run(argc, argv);
+}
@@ -0,0 +1,17 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+set(FILES
+    Source/Automation/BenchmarkComparison.cpp
+    Source/Automation/BenchmarkComparison.h
+    Source/Automation/ProfilingCaptureStream.cpp
+    Source/Automation/ProfilingCaptureStream.h
+    Source/Utils/JsonFile.cpp
+    Source/Utils/JsonFile.h
+    Tools/BenchmarkRegressionComparator/BenchmarkRegressionComparator.cpp
+)
@@ -0,0 +1,15 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+set(FILES
+    Source/Automation/ProfilingCaptureStream.cpp
+    Source/Automation/ProfilingCaptureStream.h
+    Source/Utils/JsonFile.cpp
+    Source/Utils/JsonFile.h
+    Tools/ProfilingCaptureConverter/ProfilingCaptureConverter.cpp
+)
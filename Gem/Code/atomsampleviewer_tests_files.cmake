@@ -7,5 +7,22 @@
 #
 
 set(FILES
+    Tests/AssetCatalogIndexTests.cpp
+    Tests/AssetSwapSchedulerTests.cpp
     Tests/AtomSampleViewerGemTests.cpp
+    Tests/BenchmarkComparisonTests.cpp
+    Tests/CullingLodStatisticsTests.cpp
+    Tests/FrameTimeStatisticsTests.cpp
+    Tests/ImGuiHistogramQueueTests.cpp
+    Tests/IncrementalTestCacheTests.cpp
+    Tests/InstanceTransformStoreTests.cpp
+    Tests/LatticeBuilderTests.cpp
+    Tests/LatticeScalingSweepTests.cpp
+    Tests/MaterialInstancePoolTests.cpp
+    Tests/ProceduralSkinnedMeshTests.cpp
+    Tests/ProfilingCaptureStreamTests.cpp
+    Tests/SampleSwitchProfilerTests.cpp
+    Tests/ScreenshotComparisonEngineTests.cpp
+    Tests/StreamingImageTelemetryTests.cpp
+    Tests/TextureLoadSchedulerTests.cpp
 )
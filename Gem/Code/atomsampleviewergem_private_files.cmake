@@ -20,9 +20,15 @@ set(FILES
     Source/SampleComponentConfig.h
     Source/Automation/AssetStatusTracker.cpp
     Source/Automation/AssetStatusTracker.h
+    Source/Automation/BenchmarkComparison.cpp
+    Source/Automation/BenchmarkComparison.h
     Source/Automation/ImageComparisonConfig.h
     Source/Automation/ImageComparisonConfig.cpp
+    Source/Automation/IncrementalTestCache.cpp
+    Source/Automation/IncrementalTestCache.h
     Source/Automation/PrecommitWizardSettings.h
+    Source/Automation/ProfilingCaptureStream.cpp
+    Source/Automation/ProfilingCaptureStream.h
     Source/Automation/ScriptableImGui.cpp
     Source/Automation/ScriptableImGui.h
     Source/Automation/ScriptManager.cpp
@@ -31,6 +37,8 @@ set(FILES
     Source/Automation/ScriptRunnerBus.h
     Source/Automation/ScriptReporter.cpp
     Source/Automation/ScriptReporter.h
+    Source/Automation/ScreenshotComparisonEngine.cpp
+    Source/Automation/ScreenshotComparisonEngine.h
     Source/RHI/AlphaToCoverageExampleComponent.cpp
     Source/RHI/AlphaToCoverageExampleComponent.h
     Source/RHI/AsyncComputeExampleComponent.h
@@ -93,12 +101,25 @@ set(FILES
     Source/RHI/VariableRateShadingExampleComponent.h
     Source/Performance/HighInstanceExampleComponent.cpp
     Source/Performance/HighInstanceExampleComponent.h
+    Source/Performance/AssetSwapScheduler.cpp
+    Source/Performance/AssetSwapScheduler.h
+    Source/Performance/InstanceTransformStore.cpp
+    Source/Performance/InstanceTransformStore.h
+    Source/Performance/LatticeBuilder.cpp
+    Source/Performance/LatticeBuilder.h
+    Source/Performance/LatticeScalingSweep.cpp
+    Source/Performance/LatticeScalingSweep.h
+    Source/Performance/SampleSwitchProfiler.cpp
+    Source/Performance/SampleSwitchProfiler.h
+    Source/Performance/TextureLoadScheduler.cpp
+    Source/Performance/TextureLoadScheduler.h
     Source/Performance/100KDrawable_SingleView_ExampleComponent.cpp
     Source/Performance/100KDrawable_SingleView_ExampleComponent.h
     Source/Performance/100KDraw_10KDrawable_MultiView_ExampleComponent.cpp
     Source/Performance/100KDraw_10KDrawable_MultiView_ExampleComponent.h
     Source/AreaLightExampleComponent.cpp
     Source/AreaLightExampleComponent.h
+    Source/AssetLoadTestBus.h
     Source/AssetLoadTestComponent.cpp
     Source/AssetLoadTestComponent.h
     Source/AuxGeomExampleComponent.cpp
@@ -115,6 +136,7 @@ set(FILES
     Source/CheckerboardExampleComponent.cpp
     Source/CommonSampleComponentBase.cpp
     Source/CommonSampleComponentBase.h
+    Source/CullingAndLodExampleBus.h
     Source/CullingAndLodExampleComponent.cpp
     Source/CullingAndLodExampleComponent.h
     Source/DecalExampleComponent.cpp
@@ -129,6 +151,7 @@ set(FILES
     Source/DynamicDrawExampleComponent.cpp
     Source/DynamicMaterialTestComponent.cpp
     Source/DynamicMaterialTestComponent.h
+    Source/EntityLatticeTestBus.h
     Source/EntityLatticeTestComponent.cpp
     Source/EntityLatticeTestComponent.h
     Source/EntityUtilityFunctions.cpp
@@ -178,6 +201,7 @@ set(FILES
     Source/ShadowedSponzaExampleComponent.h
     Source/SkinnedMeshContainer.cpp
     Source/SkinnedMeshContainer.h
+    Source/SkinnedMeshExampleBus.h
     Source/SkinnedMeshExampleComponent.cpp
     Source/SkinnedMeshExampleComponent.h
     Source/SsaoExampleComponent.cpp
@@ -186,6 +210,7 @@ set(FILES
     Source/SSRExampleComponent.h
     Source/StreamingImageExampleComponent.cpp
     Source/StreamingImageExampleComponent.h
+    Source/StreamingImageExampleBus.h
     Source/TonemappingExampleComponent.cpp
     Source/TonemappingExampleComponent.h
     Source/TransparencyExampleComponent.cpp
@@ -194,6 +219,12 @@ set(FILES
     Source/ShaderReloadTestComponent.h
     Source/Subpass_RPI_ExampleComponent.cpp
     Source/Subpass_RPI_ExampleComponent.h
+    Source/Utils/AssetCatalogIndex.cpp
+    Source/Utils/AssetCatalogIndex.h
+    Source/Utils/CullingLodStatistics.cpp
+    Source/Utils/CullingLodStatistics.h
+    Source/Utils/FrameTimeStatistics.cpp
+    Source/Utils/FrameTimeStatistics.h
     Source/Utils/ImGuiAssetBrowser.cpp
     Source/Utils/ImGuiAssetBrowser.h
     Source/Utils/ImGuiHistogramQueue.cpp
@@ -204,6 +235,13 @@ set(FILES
     Source/Utils/ImGuiSaveFilePath.h
     Source/Utils/ImGuiSidebar.cpp
     Source/Utils/ImGuiSidebar.h
+    Source/Utils/JsonFile.cpp
+    Source/Utils/JsonFile.h
+    Source/Utils/MaterialInstancePool.cpp
+    Source/Utils/MaterialInstancePool.h
+    Source/Utils/ParallelForChunks.h
+    Source/Utils/StreamingImageTelemetry.cpp
+    Source/Utils/StreamingImageTelemetry.h
     Source/Utils/Utils.cpp
     Source/Utils/Utils.h
     Source/Utils/ImGuiProgressList.cpp
@@ -140,8 +140,17 @@ namespace AtomSampleViewer
         fileIO->CreatePath("@user@");
         fileIO->CreatePath("@log@");
 
+        // Shards of a test suite run concurrently, so each one needs its own log file
+        AZStd::string logFileName = s_logFileBaseName;
+        int shardIndex = 0;
+        int shardCount = 1;
+        if (ReadTestShard(shardIndex, shardCount))
+        {
+            AzFramework::StringFunc::Path::ReplaceExtension(logFileName, AZStd::string::format("shard%dof%d.log", shardIndex + 1, shardCount).c_str());
+        }
+
         AZStd::string logPath;
-        AzFramework::StringFunc::Path::Join(logDirectory.c_str(), s_logFileBaseName, logPath);
+        AzFramework::StringFunc::Path::Join(logDirectory.c_str(), logFileName.c_str(), logPath);
 
         using namespace AzFramework;
         m_logFile.reset(aznew LogFile(logPath.c_str()));
@@ -167,8 +176,22 @@ namespace AtomSampleViewer
             constexpr const char* testSuiteSwitch = "runtestsuite";
             constexpr const char* testExitSwitch = "exitontestend";
             constexpr const char* testRandomSeed = "randomtestseed";
+            constexpr const char* testIncrementalSwitch = "incrementaltestsuite";
+            constexpr const char* testShardRunIdSwitch = "testshardrunid";
 
             bool exitOnTestEnd = commandLine.HasSwitch(testExitSwitch);
+            bool incrementalRun = commandLine.HasSwitch(testIncrementalSwitch);
+
+            int shardIndex = 0;
+            int shardCount = 1;
+            ReadTestShard(shardIndex, shardCount);
+
+            // Every shard of a run gets the same id, e.g. --testshardrunid 4f1c..., so results of earlier runs aren't merged
+            AZStd::string shardRunId;
+            if (commandLine.HasSwitch(testShardRunIdSwitch))
+            {
+                shardRunId = commandLine.GetSwitchValue(testShardRunIdSwitch, 0);
+            }
 
             if (commandLine.HasSwitch(testSuiteSwitch))
             {
@@ -180,13 +203,37 @@ namespace AtomSampleViewer
                     randomSeed = atoi(commandLine.GetSwitchValue(testRandomSeed, 0).c_str());
                 }
 
-                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed);
+                SampleComponentManagerRequestBus::Broadcast(&SampleComponentManagerRequestBus::Events::RunMainTestSuite, testSuitePath, exitOnTestEnd, randomSeed, incrementalRun, shardIndex, shardCount, shardRunId);
 
                 m_isTestMode = true;
             }
         }
     }
 
+    bool AtomSampleViewerApplication::ReadTestShard(int& shardIndex, int& shardCount) const
+    {
+        if (GetArgC() == nullptr || GetArgV() == nullptr)
+        {
+            return false;
+        }
+
+        AzFramework::CommandLine commandLine;
+        commandLine.Parse(*GetArgC(), *GetArgV());
+
+        // Usage: --testshardindex 2 --testshardcount 4 runs the third quarter of the test suite. The index is 0-based.
+        constexpr const char* testShardIndexSwitch = "testshardindex";
+        constexpr const char* testShardCountSwitch = "testshardcount";
+
+        if (!commandLine.HasSwitch(testShardCountSwitch))
+        {
+            return false;
+        }
+
+        shardCount = atoi(commandLine.GetSwitchValue(testShardCountSwitch, 0).c_str());
+        shardIndex = commandLine.HasSwitch(testShardIndexSwitch) ? atoi(commandLine.GetSwitchValue(testShardIndexSwitch, 0).c_str()) : 0;
+        return shardCount > 1;
+    }
+
     bool AtomSampleViewerApplication::OnOutput(const char* window, const char* message)
     {
         if (m_logFile)
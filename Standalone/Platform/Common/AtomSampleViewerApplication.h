@@ -83,6 +83,10 @@ namespace AtomSampleViewer
         void WriteStartupLog();
         void ReadAutomatedTestOptions();
 
+        // Reads the part of the test suite this process runs when the suite is split across several processes.
+        // Returns false if the test suite isn't sharded.
+        bool ReadTestShard(int& shardIndex, int& shardCount) const;
+
         struct LogMessage
         {
             AZStd::string window;
@@ -4,9 +4,11 @@ For complete copyright and license terms please see the LICENSE at the root of t
 
 SPDX-License-Identifier: Apache-2.0 OR MIT
 """
+import json
 import logging
 import os
 import subprocess
+import uuid
 
 import pytest
 
@@ -65,3 +67,54 @@ class TestAutomationMainSuite:
                 f"Log file: {atomsampleviewer_log_monitor.file_to_monitor}\n"
                 f"Expected screenshots: {expected_screenshots_path}\n"
                 f"Test screenshots: {test_screenshots_path}\n")
+
+    def test_ShardedAutomatedReviewTestSuite(self, request, workspace, launcher_platform, rhi):
+        # Runs the same suite split across several concurrent processes. Each shard writes its results to
+        # TestResults/Shards, and the last one to finish merges them into mergedTestResults.json.
+        shard_count = 2
+        test_script = '_FullTestSuite_.bv.lua'
+        test_script_path = os.path.join(workspace.paths.project(), 'scripts', test_script)
+        if not os.path.exists(test_script_path):
+            raise AtomSampleViewerException(f'Test script does not exist in path: {test_script_path}')
+
+        shard_results_path = os.path.join(workspace.paths.project(), 'TestResults', 'Shards')
+        merged_results_path = os.path.join(shard_results_path, 'mergedTestResults.json')
+        if os.path.exists(merged_results_path):
+            os.remove(merged_results_path)
+
+        def teardown():
+            process_utils.kill_processes_named(['AssetProcessor', 'AtomSampleViewerStandalone'], ignore_extensions=True)
+        request.addfinalizer(teardown)
+
+        # Execute test. All shards share a run id, so results left over from an earlier run are never merged.
+        shard_run_id = uuid.uuid4().hex
+        processes = []
+        for shard_index in range(shard_count):
+            cmd = os.path.join(workspace.paths.build_directory(),
+                               'AtomSampleViewerStandalone.exe '
+                               f'--project-path={workspace.paths.project()} '
+                               f'--rhi {rhi} '
+                               f'--runtestsuite scripts/{test_script}c '
+                               f'--testshardindex {shard_index} '
+                               f'--testshardcount {shard_count} '
+                               f'--testshardrunid {shard_run_id} '
+                               '--exitontestend')
+            processes.append(subprocess.Popen(cmd, stderr=subprocess.STDOUT, shell=True))
+
+        exit_codes = [process.wait(timeout=800) for process in processes]
+
+        if not os.path.exists(merged_results_path):
+            raise AtomSampleViewerException(
+                f"Shards finished with exit codes {exit_codes} but didn't merge their results into {merged_results_path}")
+
+        with open(merged_results_path) as merged_results_file:
+            merged_results = json.load(merged_results_file)
+
+        failed_scripts = [script['path'] for script in merged_results['scripts'] if not script['passed']]
+        if failed_scripts or any(exit_codes):
+            raise AtomSampleViewerException(
+                f"Sharded test suite failed using Render Hardware Interface (RHI): '{rhi}'\n"
+                f"Shard exit codes: {exit_codes}\n"
+                f"Failed scripts: {failed_scripts}\n"
+                f"Summary: {merged_results['summary']}\n"
+                "Please review the logs of each shard, named AtomSampleViewer.shard<N>of<Count>.log\n")
@@ -15,26 +15,35 @@ SAMPLES_TO_RUN = {
     {prefix = 'RPI', name = 'CullingAndLod', width = 1400, height = 800},
     {prefix = 'RPI', name = 'SponzaBenchmark', width = 1400, height = 800},
     {prefix = 'Performance', name = '100KDrawable_SingleView', width = 800, height = 600},
-    {prefix = 'Performance', name = '100KDraw_10KDrawable_MultiView', width = 800, height = 600}
+    {prefix = 'Performance', name = '100KDraw_10KDrawable_MultiView', width = 800, height = 600},
+    -- The same lattices, with cells that share a model and material drawn as instances
+    {prefix = 'Performance', name = '100KDrawable_SingleView', width = 800, height = 600, instanced = true},
+    {prefix = 'Performance', name = '100KDraw_10KDrawable_MultiView', width = 800, height = 600, instanced = true}
 }
 
 Print('Capturing data for ' .. tostring(#SAMPLES_TO_RUN) .. ' benchmarks')
 for index, sample in ipairs(SAMPLES_TO_RUN) do
     sample_path = sample['prefix'] .. '/' .. sample['name']
+    output_name = sample['name']
+    -- The samples read the cvar when they're opened
+    if (sample['instanced']) then
+        output_name = output_name .. '_Instanced'
+        ExecuteConsoleCommand('r_meshInstancingEnabled true')
+    end
     Print('Opening sample ' .. sample_path)
     OpenSample(sample_path)
     ResizeViewport(sample['width'], sample['height'])
 
-    output_path = g_baseFolder .. sample['name']
-    CaptureBenchmarkMetadata(sample['name'], output_path .. '/benchmark_metadata.json')
+    output_path = g_baseFolder .. output_name
+    CaptureBenchmarkMetadata(output_name, output_path .. '/benchmark_metadata.json')
     Print('Idling for ' .. tostring(IDLE_COUNT) .. ' frames..')
     IdleFrames(IDLE_COUNT)
     Print('Capturing timestamps for ' .. tostring(FRAME_COUNT) .. ' frames...')
-    for i = 1,FRAME_COUNT do
-        frame_timestamps = output_path .. '/frame' .. tostring(i) .. '_timestamps.json'
-        cpu_timings = output_path .. '/cpu_frame' .. tostring(i) .. '_time.json'
-        CapturePassTimestamp(frame_timestamps)
-        CaptureCpuFrameTime(cpu_timings)
+    -- The frames are recorded back to back and written to a single binary file once the capture is done. Use the
+    -- ProfilingCaptureConverter tool with "--format legacy" to get the frameN_timestamps.json and cpu_frameN_time.json files.
+    CaptureProfilingSeries(output_path .. '/profiling_capture.asvpcap', FRAME_COUNT)
+    if (sample['instanced']) then
+        ExecuteConsoleCommand('r_meshInstancingEnabled false')
     end
 end
 
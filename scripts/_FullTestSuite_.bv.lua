@@ -16,6 +16,9 @@
 -- NOTE: If the random seed is zero, then the order is not shuffled at all.
 -- The seed can be provided either in imGui or via commandline switch --randomtestseed
 
+-- The suite can also be split across several processes with the commandline switches --testshardindex and --testshardcount.
+-- Each shard shuffles the tests with the same seed, then runs every Nth test, so together the shards run each test exactly once.
+
 
 -- Fast check for a sample which doesn't have a dedicated test script
 function FastCheckSample(sampleName)
@@ -129,6 +132,14 @@ else
     random_shuffle(tests)
 end
 
-for k,test in pairs(tests) do
-    test()
+shardIndex = GetTestShardIndex()
+shardCount = GetTestShardCount()
+if (shardCount > 1) then
+    Print("========= Running shard " .. (shardIndex + 1) .. " of " .. shardCount .. " =========")
+end
+
+for k,test in ipairs(tests) do
+    if ((k - 1) % shardCount == shardIndex) then
+        test()
+    end
 end
@@ -0,0 +1,43 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Runs the AssetLoadTest sample with each asset switch strategy and writes the per-frame cost of the switches to a
+-- JSON file, so the frame time spikes of switching everything in one frame can be compared with amortized switching.
+
+-- optional settings
+local SecondsPerStrategyRegistryKey <const> = "/O3DE/ScriptAutomation/AssetSwitching/SecondsPerStrategy"
+local FrameBudgetMsRegistryKey <const> = "/O3DE/ScriptAutomation/AssetSwitching/FrameBudgetMs"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/AssetSwitching/OutputPath"
+
+-- default values
+DEFAULT_SECONDS_PER_STRATEGY = 30
+DEFAULT_FRAME_BUDGET_MS = 2.0
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/AssetSwitching"
+
+local secondsPerStrategy = g_SettingsRegistry:GetUInt(SecondsPerStrategyRegistryKey):value_or(DEFAULT_SECONDS_PER_STRATEGY)
+local frameBudgetMs      = g_SettingsRegistry:GetFloat(FrameBudgetMsRegistryKey):value_or(DEFAULT_FRAME_BUDGET_MS)
+local outputPath         = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local outputFilePath = outputPath .. '/AssetLoadTest_' .. string.lower(GetRenderApiName()) .. '.json'
+
+OpenSample('RPI/AssetLoadTest')
+ExecuteConsoleCommand("r_displayInfo=0")
+SetImguiValue('##SwitchBudget', frameBudgetMs)
+SetImguiValue('Reset Switch Statistics', true)
+
+for _, strategy in ipairs({ 'All At Once', 'Amortized' }) do
+    Print('Switching assets ' .. strategy .. ' for ' .. secondsPerStrategy .. ' seconds')
+    SetImguiValue(strategy, true)
+    IdleSeconds(secondsPerStrategy)
+end
+
+CaptureAssetSwitchStatistics(outputFilePath)
+Print('Asset switch statistics saved to ' .. NormalizePath(outputFilePath))
+OpenSample(nil)
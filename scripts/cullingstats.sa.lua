@@ -0,0 +1,51 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Steps the CullingAndLod sample through its object grids and a list of disk light counts and writes the per-view
+-- culling counts and estimated LOD histogram of each combination to a JSON file.
+-- Every setting can be overridden in the settings registry.
+
+-- optional settings
+local GridSizesRegistryKey <const> = "/O3DE/ScriptAutomation/CullingStats/GridSizes"
+local DiskLightCountsRegistryKey <const> = "/O3DE/ScriptAutomation/CullingStats/DiskLightCounts"
+local WarmupSecondsRegistryKey <const> = "/O3DE/ScriptAutomation/CullingStats/WarmupSeconds"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/CullingStats/OutputPath"
+
+-- default values, the grid sizes are the ones the sample has buttons for
+DEFAULT_GRID_SIZES = "20,50,100"
+DEFAULT_DISK_LIGHT_COUNTS = "0,20,100"
+DEFAULT_WARMUP_SECONDS = 2
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/CullingStats"
+
+local gridSizes       = g_SettingsRegistry:GetString(GridSizesRegistryKey):value_or(DEFAULT_GRID_SIZES)
+local diskLightCounts = g_SettingsRegistry:GetString(DiskLightCountsRegistryKey):value_or(DEFAULT_DISK_LIGHT_COUNTS)
+local warmupSeconds   = g_SettingsRegistry:GetUInt(WarmupSecondsRegistryKey):value_or(DEFAULT_WARMUP_SECONDS)
+local outputPath      = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local renderApiName = string.lower(GetRenderApiName())
+
+OpenSample('RPI/CullingAndLod')
+ExecuteConsoleCommand("r_displayInfo=0")
+-- A fixed camera keeps the captures comparable
+SetImguiValue('Begin Verification', true)
+
+for gridSize in string.gmatch(gridSizes, "%d+") do
+    SetImguiValue('Spawn ' .. gridSize .. 'x' .. gridSize .. ' Grid of objects', true)
+    for diskLightCount in string.gmatch(diskLightCounts, "%d+") do
+        Print('Culling a ' .. gridSize .. 'x' .. gridSize .. ' grid with ' .. diskLightCount .. ' disk lights')
+        SetImguiValue('Number', tonumber(diskLightCount))
+        IdleSeconds(warmupSeconds)
+        CaptureCullingStatistics(outputPath .. '/CullingAndLod_' .. gridSize .. '_' .. diskLightCount .. '_' .. renderApiName .. '.json')
+    end
+end
+
+Print('Culling statistics saved to ' .. NormalizePath(outputPath))
+SetImguiValue('End Verification', true)
+OpenSample(nil)
@@ -0,0 +1,43 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Steps an entity lattice sample through a list of instance counts and writes the scaling curve of CPU frame time,
+-- activation time and process memory to a JSON file. Every setting can be overridden in the settings registry.
+
+-- optional settings
+local SampleRegistryKey <const> = "/O3DE/ScriptAutomation/LatticeScaling/Sample"
+local InstanceCountsRegistryKey <const> = "/O3DE/ScriptAutomation/LatticeScaling/InstanceCounts"
+local WarmupFrameCountRegistryKey <const> = "/O3DE/ScriptAutomation/LatticeScaling/WarmupFrameCount"
+local CaptureFrameCountRegistryKey <const> = "/O3DE/ScriptAutomation/LatticeScaling/CaptureFrameCount"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/LatticeScaling/OutputPath"
+
+-- default values
+DEFAULT_SAMPLE = "Performance/100KDrawable_SingleView"
+DEFAULT_INSTANCE_COUNTS = "1000,8000,27000,64000,97336,125000,216000"
+DEFAULT_WARMUP_FRAME_COUNT = 60
+DEFAULT_CAPTURE_FRAME_COUNT = 120
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/LatticeScaling"
+
+local sample            = g_SettingsRegistry:GetString(SampleRegistryKey):value_or(DEFAULT_SAMPLE)
+local instanceCounts    = g_SettingsRegistry:GetString(InstanceCountsRegistryKey):value_or(DEFAULT_INSTANCE_COUNTS)
+local warmupFrameCount  = g_SettingsRegistry:GetUInt(WarmupFrameCountRegistryKey):value_or(DEFAULT_WARMUP_FRAME_COUNT)
+local captureFrameCount = g_SettingsRegistry:GetUInt(CaptureFrameCountRegistryKey):value_or(DEFAULT_CAPTURE_FRAME_COUNT)
+local outputPath        = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+-- The sample's own lattice is restored when the sweep finishes
+local sampleName = string.gsub(sample, "/", "_")
+local outputFilePath = outputPath .. '/' .. sampleName .. '_' .. string.lower(GetRenderApiName()) .. '.json'
+
+OpenSample(sample)
+ExecuteConsoleCommand("r_displayInfo=0")
+Print('Sweeping ' .. sample .. ' through ' .. instanceCounts .. ' instances')
+RunLatticeScalingSweep(instanceCounts, outputFilePath, warmupFrameCount, captureFrameCount)
+Print('Scaling curve saved to ' .. NormalizePath(outputFilePath))
+OpenSample(nil)
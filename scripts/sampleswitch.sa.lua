@@ -0,0 +1,51 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Cycles through a list of samples, first recreating the RPI scene on every switch and then keeping it between
+-- compatible samples, and writes the per-phase timings of every switch and the cold and warm means to a JSON file.
+-- Every setting can be overridden in the settings registry.
+
+-- optional settings
+local SamplesRegistryKey <const> = "/O3DE/ScriptAutomation/SampleSwitch/Samples"
+local CycleCountRegistryKey <const> = "/O3DE/ScriptAutomation/SampleSwitch/CycleCount"
+local IdleSecondsRegistryKey <const> = "/O3DE/ScriptAutomation/SampleSwitch/IdleSeconds"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/SampleSwitch/OutputPath"
+
+-- default values
+DEFAULT_SAMPLES = "RPI/Mesh,Features/Bloom,RPI/AuxGeom,Features/Exposure,RPI/Decals"
+DEFAULT_CYCLE_COUNT = 3
+DEFAULT_IDLE_SECONDS = 1
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/SampleSwitch"
+
+local samples     = g_SettingsRegistry:GetString(SamplesRegistryKey):value_or(DEFAULT_SAMPLES)
+local cycleCount  = g_SettingsRegistry:GetUInt(CycleCountRegistryKey):value_or(DEFAULT_CYCLE_COUNT)
+local idleSeconds = g_SettingsRegistry:GetUInt(IdleSecondsRegistryKey):value_or(DEFAULT_IDLE_SECONDS)
+local outputPath  = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local outputFilePath = outputPath .. '/SampleSwitch_' .. string.lower(GetRenderApiName()) .. '.json'
+
+ExecuteConsoleCommand("r_displayInfo=0")
+
+for _, warmSampleSwitch in ipairs({false, true}) do
+    Print('Switching samples with warm sample switch ' .. (warmSampleSwitch and 'enabled' or 'disabled'))
+    SetWarmSampleSwitch(warmSampleSwitch)
+    for cycle = 1, cycleCount do
+        for sample in string.gmatch(samples, "[^,]+") do
+            OpenSample(sample)
+            IdleSeconds(idleSeconds)
+        end
+    end
+    -- Start the next mode from the home screen so its first switch always builds a new scene
+    OpenSample(nil)
+end
+
+SetWarmSampleSwitch(false)
+CaptureSampleSwitchTimings(outputFilePath)
+Print('Sample switch timings saved to ' .. NormalizePath(outputFilePath))
@@ -0,0 +1,54 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Steps the SkinnedMesh sample's stress mode through a list of instance counts and writes the skinning memory use,
+-- out-of-memory retries and frame times of each step to a JSON file, to find where crowds stop scaling.
+-- Every setting can be overridden in the settings registry.
+
+-- optional settings
+local InstanceCountsRegistryKey <const> = "/O3DE/ScriptAutomation/SkinnedMeshStress/InstanceCounts"
+local UniqueMeshCountRegistryKey <const> = "/O3DE/ScriptAutomation/SkinnedMeshStress/UniqueMeshCount"
+local WarmupSecondsRegistryKey <const> = "/O3DE/ScriptAutomation/SkinnedMeshStress/WarmupSeconds"
+local CaptureSecondsRegistryKey <const> = "/O3DE/ScriptAutomation/SkinnedMeshStress/CaptureSeconds"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/SkinnedMeshStress/OutputPath"
+
+-- default values
+DEFAULT_INSTANCE_COUNTS = "16,64,256,512,1024,2048,4096"
+DEFAULT_UNIQUE_MESH_COUNT = 4
+DEFAULT_WARMUP_SECONDS = 2
+DEFAULT_CAPTURE_SECONDS = 5
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/SkinnedMeshStress"
+
+local instanceCounts  = g_SettingsRegistry:GetString(InstanceCountsRegistryKey):value_or(DEFAULT_INSTANCE_COUNTS)
+local uniqueMeshCount = g_SettingsRegistry:GetUInt(UniqueMeshCountRegistryKey):value_or(DEFAULT_UNIQUE_MESH_COUNT)
+local warmupSeconds   = g_SettingsRegistry:GetUInt(WarmupSecondsRegistryKey):value_or(DEFAULT_WARMUP_SECONDS)
+local captureSeconds  = g_SettingsRegistry:GetUInt(CaptureSecondsRegistryKey):value_or(DEFAULT_CAPTURE_SECONDS)
+local outputPath      = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local renderApiName = string.lower(GetRenderApiName())
+
+OpenSample('Features/SkinnedMesh')
+ExecuteConsoleCommand("r_displayInfo=0")
+SetImguiValue('Draw bones', false)
+SetImguiValue('Stress Mode', true)
+SetImguiValue('Unique Meshes', uniqueMeshCount)
+
+for instanceCount in string.gmatch(instanceCounts, "%d+") do
+    Print('Skinning ' .. instanceCount .. ' instances')
+    SetImguiValue('Instance Count', tonumber(instanceCount))
+    IdleSeconds(warmupSeconds)
+    SetImguiValue('Reset Frame Times', true)
+    IdleSeconds(captureSeconds)
+    CaptureSkinnedMeshStatistics(outputPath .. '/SkinnedMesh_' .. instanceCount .. '_' .. renderApiName .. '.json')
+end
+
+Print('Skinned mesh statistics saved to ' .. NormalizePath(outputPath))
+SetImguiValue('Stress Mode', false)
+OpenSample(nil)
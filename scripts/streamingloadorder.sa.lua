@@ -0,0 +1,52 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Reloads the images of the StreamingImage sample with FIFO and with prioritized load scheduling and writes the
+-- streaming telemetry of each load, including the time to useful frame, to a JSON file per load. The policies take
+-- turns so that neither one always loads from a warmer file cache. Every setting can be overridden in the settings
+-- registry.
+
+-- optional settings
+local RunCountRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingLoadOrder/RunCount"
+local MaxInFlightLoadsRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingLoadOrder/MaxInFlightLoads"
+local MaxKBPerFrameRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingLoadOrder/MaxKBPerFrame"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingLoadOrder/OutputPath"
+
+-- default values
+DEFAULT_RUN_COUNT = 3
+DEFAULT_MAX_IN_FLIGHT_LOADS = 4
+DEFAULT_MAX_KB_PER_FRAME = 4096
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/StreamingLoadOrder"
+
+local runCount         = g_SettingsRegistry:GetUInt(RunCountRegistryKey):value_or(DEFAULT_RUN_COUNT)
+local maxInFlightLoads = g_SettingsRegistry:GetUInt(MaxInFlightLoadsRegistryKey):value_or(DEFAULT_MAX_IN_FLIGHT_LOADS)
+local maxKBPerFrame    = g_SettingsRegistry:GetUInt(MaxKBPerFrameRegistryKey):value_or(DEFAULT_MAX_KB_PER_FRAME)
+local outputPath       = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local renderApiName = string.lower(GetRenderApiName())
+
+-- The sample pauses the script until all of its images are streamed in, also after each reload
+OpenSample('RPI/StreamingImage')
+ExecuteConsoleCommand("r_displayInfo=0")
+SetImguiValue('Max in-flight loads', maxInFlightLoads)
+SetImguiValue('Max KB per frame', maxKBPerFrame)
+
+for run = 1, runCount do
+    for _, policy in ipairs({'fifo', 'prioritized'}) do
+        Print('Loading images with ' .. policy .. ' scheduling, run ' .. run)
+        SetImguiValue('Prioritized loading', policy == 'prioritized')
+        SetImguiValue('Reload images', true)
+        IdleFrames(1)
+        CaptureStreamingTelemetry(outputPath .. '/StreamingLoad_' .. policy .. '_' .. run .. '_' .. renderApiName .. '.json')
+    end
+end
+
+Print('Load order telemetry saved to ' .. NormalizePath(outputPath))
+OpenSample(nil)
@@ -0,0 +1,46 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+--
+--
+----------------------------------------------------------------------------------------------------
+-- Opens the StreamingImage sample, waits for its images to stream in and then steps the streaming pool through a list
+-- of mip biases, recording the residency and pool memory at each one. The per-image streaming times, pool memory over
+-- time, throughput and the residency-vs-memory curve are written to a JSON file.
+-- Every setting can be overridden in the settings registry.
+
+-- optional settings
+local MipBiasesRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingResidency/MipBiases"
+local SettleSecondsRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingResidency/SettleSeconds"
+local OutputPathRegistryKey <const> = "/O3DE/ScriptAutomation/StreamingResidency/OutputPath"
+
+-- default values
+DEFAULT_MIP_BIASES = "0,1,2,3,4,5,6"
+DEFAULT_SETTLE_SECONDS = 3
+DEFAULT_OUTPUT_PATH = "@user@/scripts/PerformanceBenchmarks/StreamingResidency"
+
+local mipBiases     = g_SettingsRegistry:GetString(MipBiasesRegistryKey):value_or(DEFAULT_MIP_BIASES)
+local settleSeconds = g_SettingsRegistry:GetUInt(SettleSecondsRegistryKey):value_or(DEFAULT_SETTLE_SECONDS)
+local outputPath    = ResolvePath(g_SettingsRegistry:GetString(OutputPathRegistryKey):value_or(DEFAULT_OUTPUT_PATH))
+
+local outputFilePath = outputPath .. '/StreamingResidency_' .. string.lower(GetRenderApiName()) .. '.json'
+
+-- The sample pauses the script until all of its images are streamed in
+OpenSample('RPI/StreamingImage')
+ExecuteConsoleCommand("r_displayInfo=0")
+
+for mipBias in string.gmatch(mipBiases, "-?%d+") do
+    Print('Recording residency at mip bias ' .. mipBias)
+    SetImguiValue('Mip bias', tonumber(mipBias))
+    IdleSeconds(settleSeconds)
+    RecordStreamingResidency()
+end
+
+SetImguiValue('Mip bias', 0)
+CaptureStreamingTelemetry(outputFilePath)
+Print('Streaming telemetry saved to ' .. NormalizePath(outputFilePath))
+OpenSample(nil)